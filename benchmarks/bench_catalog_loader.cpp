@@ -0,0 +1,177 @@
+/// @file bench_catalog_loader.cpp
+/// @brief Throughput of CatalogLoader::load_hipparcos_csv (single-threaded and
+/// chunked across all cores) against the previous std::getline /
+/// std::istringstream parser.
+///
+/// Usage: bench_catalog_loader [row_count]   (default 2'500'000)
+///
+/// Writes a synthetic Hipparcos-style CSV to the temp directory, loads it
+/// with both parsers and prints MB/s and rows/s for each.
+
+#include "catalog/catalog_loader.hpp"
+#include "catalog/csv_scanner.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::catalog;
+
+namespace
+{
+    // -----------------------------------------------------------------
+    // Legacy parser (pre-CsvScanner), kept here as the baseline
+    // -----------------------------------------------------------------
+
+    std::string_view trim(std::string_view sv)
+    {
+        while (!sv.empty() && (sv.front() == ' ' || sv.front() == '\t' || sv.front() == '\r'))
+        {
+            sv.remove_prefix(1);
+        }
+        while (!sv.empty() && (sv.back() == ' ' || sv.back() == '\t' || sv.back() == '\r'))
+        {
+            sv.remove_suffix(1);
+        }
+        return sv;
+    }
+
+    template <typename T>
+    bool parse(std::string_view sv, T& value)
+    {
+        const auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), value);
+        return ec == std::errc{} && ptr == sv.data() + sv.size();
+    }
+
+    std::vector<StarEntry> legacy_load(const std::filesystem::path& path)
+    {
+        std::ifstream file(path);
+        std::vector<StarEntry> stars;
+        std::string line;
+        std::getline(file, line);
+
+        while (std::getline(file, line))
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+
+            std::istringstream stream(line);
+            std::string hip_str;
+            std::string ra_str;
+            std::string dec_str;
+            std::string mag_str;
+            std::string bv_str;
+
+            if (!std::getline(stream, hip_str, ',') ||
+                !std::getline(stream, ra_str, ',') ||
+                !std::getline(stream, dec_str, ',') ||
+                !std::getline(stream, mag_str, ',') ||
+                !std::getline(stream, bv_str))
+            {
+                continue;
+            }
+
+            u32 hip = 0;
+            f64 ra = 0.0;
+            f64 dec = 0.0;
+            f64 mag = 0.0;
+            f64 bv = 0.0;
+            if (!parse(trim(hip_str), hip) || !parse(trim(ra_str), ra) ||
+                !parse(trim(dec_str), dec) || !parse(trim(mag_str), mag) ||
+                !parse(trim(bv_str), bv))
+            {
+                continue;
+            }
+
+            stars.push_back(StarEntry{
+                .ra         = ra * astro_constants::kDegToRad,
+                .dec        = dec * astro_constants::kDegToRad,
+                .mag_v      = static_cast<f32>(mag),
+                .color_bv   = static_cast<f32>(bv),
+                .catalog_id = hip,
+            });
+        }
+        return stars;
+    }
+
+    // -----------------------------------------------------------------
+    // Synthetic input
+    // -----------------------------------------------------------------
+
+    void write_synthetic_csv(const std::filesystem::path& path, u64 rows)
+    {
+        std::mt19937_64 rng(1234);
+        std::uniform_real_distribution<f64> ra(0.0, 360.0);
+        std::uniform_real_distribution<f64> sin_dec(-1.0, 1.0);
+        std::uniform_real_distribution<f64> mag(-1.5, 12.5);
+        std::uniform_real_distribution<f64> bv(-0.4, 2.0);
+
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        std::fputs("HIP,RA_deg,Dec_deg,Vmag,BV\n", file);
+        for (u64 i = 1; i <= rows; ++i)
+        {
+            std::fprintf(file, "%llu,%.8f,%.8f,%.2f,%.3f\n",
+                         static_cast<unsigned long long>(i), ra(rng),
+                         std::asin(sin_dec(rng)) * astro_constants::kRadToDeg,
+                         mag(rng), bv(rng));
+        }
+        std::fclose(file);
+    }
+
+    template <typename Fn>
+    void report(const char* label, u64 bytes, Fn&& load)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const std::size_t rows = load();
+        const f64 sec = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("%-28s %10zu rows  %8.3f s  %8.1f MB/s  %6.2f Mrows/s\n",
+                    label, rows, sec,
+                    static_cast<f64>(bytes) / (1024.0 * 1024.0) / sec,
+                    static_cast<f64>(rows) / 1.0e6 / sec);
+    }
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    core::Logger::init();
+
+    const u64 rows = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2'500'000ull;
+    const auto path = std::filesystem::temp_directory_path() / "plx_bench_hipparcos.csv";
+
+    write_synthetic_csv(path, rows);
+    const u64 bytes = std::filesystem::file_size(path);
+    std::printf("Input: %llu rows, %.1f MB, scanner path: %s\n",
+                static_cast<unsigned long long>(rows),
+                static_cast<f64>(bytes) / (1024.0 * 1024.0),
+                CsvScanner::get_simd_path());
+
+    report("getline + istringstream", bytes, [&] { return legacy_load(path).size(); });
+    report("CatalogLoader, 1 thread", bytes, [&] {
+        const auto stars = CatalogLoader::load_hipparcos_csv(path, 1);
+        return stars ? stars->size() : std::size_t{0};
+    });
+    report("CatalogLoader, all cores", bytes, [&] {
+        const auto stars = CatalogLoader::load_hipparcos_csv(path, 0);
+        return stars ? stars->size() : std::size_t{0};
+    });
+
+    std::filesystem::remove(path);
+    core::Logger::shutdown();
+    return 0;
+}
@@ -0,0 +1,111 @@
+/// @file bench_parallel_projection.cpp
+/// @brief Starfield-style batch projection split across JobSystem workers.
+///
+/// Usage: bench_parallel_projection [star_count] [max_threads]
+///        (defaults 2'000'000 and hardware_concurrency())
+///
+/// Stars are cut into pixel-sized batches (as Starfield::update does), each
+/// projected into its own slot range by parallel_for jobs; the time per frame
+/// is reported for 1 (inline), 2, 4, ... threads up to hardware_concurrency().
+
+#include "astro/coordinates.hpp"
+#include "core/job_system.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+#include "rendering/camera.hpp"
+#include "rendering/projection_context.hpp"
+#include "rendering/star_vertex.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace parallax;
+
+int main(int argc, char** argv)
+{
+    const std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2'000'000ull;
+    constexpr u32 kBatchSize = 64;      // ~ stars per HEALPix pixel bucket
+    constexpr int kFrames = 10;
+
+    core::Logger::init();
+
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<f64> ra_dist(0.0, astro_constants::kTwoPi);
+    std::uniform_real_distribution<f64> z_dist(-1.0, 1.0);
+
+    // x/y/z columns, as StarCatalogSoA stores them
+    std::vector<f64> dir_x(count), dir_y(count), dir_z(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Vec3d d = astro::Coordinates::equatorial_to_unit_vector(
+            astro::EquatorialCoord{.ra = ra_dist(rng), .dec = std::asin(z_dist(rng))});
+        dir_x[i] = d.x;
+        dir_y[i] = d.y;
+        dir_z[i] = d.z;
+    }
+
+    rendering::Camera camera;
+    camera.set_fov(120.0);
+    const astro::ObserverLocation observer{.latitude_rad = 0.5, .longitude_rad = 0.0};
+    const rendering::ProjectionContext projection(
+        camera, astro::Coordinates::equatorial_to_horizontal_matrix(observer, 1.0));
+
+    const auto batch_count = static_cast<u32>((count + kBatchSize - 1) / kBatchSize);
+    std::vector<rendering::StarVertex> vertices(count);
+    std::vector<u32> visible(batch_count);
+
+    const auto project_range = [&](u32 begin, u32 end) {
+        for (u32 b = begin; b < end; ++b)
+        {
+            const std::size_t first = static_cast<std::size_t>(b) * kBatchSize;
+            const std::size_t n = std::min<std::size_t>(kBatchSize, count - first);
+            visible[b] = projection.project(std::span<const f64>(dir_x).subspan(first, n),
+                                            std::span<const f64>(dir_y).subspan(first, n),
+                                            std::span<const f64>(dir_z).subspan(first, n),
+                                            std::span<rendering::StarVertex>(vertices).subspan(first, n));
+        }
+    };
+
+    // Mean ms per frame of run_frame(), plus the visible count it produced
+    const auto time_frames = [&](auto&& run_frame) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < kFrames; ++frame)
+        {
+            run_frame();
+        }
+        const f64 ms = std::chrono::duration<f64, std::milli>(
+                           std::chrono::steady_clock::now() - start).count() / kFrames;
+        u64 total = 0;
+        for (const u32 v : visible)
+        {
+            total += v;
+        }
+        return std::pair{ms, total};
+    };
+
+    // Baseline: the same batches on the calling thread, no job system
+    const auto [single_ms, single_visible] = time_frames([&] { project_range(0, batch_count); });
+    std::printf(" 1 thread   %8.2f ms/frame   1.00x  (%llu visible)\n",
+                single_ms, static_cast<unsigned long long>(single_visible));
+
+    const u32 max_threads = (argc > 2) ? static_cast<u32>(std::strtoul(argv[2], nullptr, 10))
+                                       : std::max(1u, std::thread::hardware_concurrency());
+    for (u32 threads = 2; threads <= max_threads; threads *= 2)
+    {
+        core::JobSystem jobs(threads - 1);
+        const auto [ms, total] = time_frames([&] { jobs.parallel_for(batch_count, 16, project_range); });
+        std::printf("%2u threads  %8.2f ms/frame  %6.2fx  (%llu visible)\n",
+                    jobs.get_thread_count(), ms, single_ms / ms, static_cast<unsigned long long>(total));
+    }
+
+    core::Logger::shutdown();
+    return 0;
+}
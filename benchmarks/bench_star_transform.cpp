@@ -0,0 +1,125 @@
+/// @file bench_star_transform.cpp
+/// @brief Per-star Equatorial → Horizontal cost: scalar trig path against
+/// precomputed unit vectors rotated by one per-frame matrix, and the
+/// BatchTransform kernels (f64 / f32) on every supported SIMD path.
+///
+/// Usage: bench_star_transform [star_count]   (default 2'000'000)
+///
+/// All paths count stars above the horizon so the work cannot be elided.
+
+#include "astro/batch_transform.hpp"
+#include "astro/coordinates.hpp"
+#include "core/types.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::astro;
+
+namespace
+{
+    template <typename Fn>
+    void report(const char* label, std::size_t count, Fn&& run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const std::size_t above = run();
+        const f64 sec = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("%-34s %8.2f ms  %7.2f ns/star  %6.1f Mstars/s  (%zu above horizon)\n",
+                    label, sec * 1e3, sec * 1e9 / static_cast<f64>(count),
+                    static_cast<f64>(count) / 1.0e6 / sec, above);
+    }
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2'000'000ull;
+
+    std::mt19937_64 rng(99);
+    std::uniform_real_distribution<f64> ra_dist(0.0, astro_constants::kTwoPi);
+    std::uniform_real_distribution<f64> z_dist(-1.0, 1.0);
+
+    std::vector<EquatorialCoord> coords(count);
+    std::vector<Vec3d> directions(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        coords[i] = EquatorialCoord{.ra = ra_dist(rng), .dec = std::asin(z_dist(rng))};
+        directions[i] = Coordinates::equatorial_to_unit_vector(coords[i]);
+    }
+
+    const ObserverLocation observer{.latitude_rad = 28.76 * astro_constants::kDegToRad,
+                                    .longitude_rad = 0.0};
+    const f64 lst = 1.7;
+
+    report("equatorial_to_horizontal per star", count, [&] {
+        std::size_t above = 0;
+        for (const auto& eq : coords)
+        {
+            above += Coordinates::equatorial_to_horizontal(eq, observer, lst).alt >= 0.0 ? 1 : 0;
+        }
+        return above;
+    });
+
+    report("unit vector x frame matrix", count, [&] {
+        const Mat3d eq_to_hz = Coordinates::equatorial_to_horizontal_matrix(observer, lst);
+        std::size_t above = 0;
+        for (const auto& d : directions)
+        {
+            above += (eq_to_hz * d).z >= 0.0 ? 1 : 0;
+        }
+        return above;
+    });
+
+    // Batched SoA columns, as StarCatalogSoA stores them
+    std::vector<f64> ra(count), dec(count), alt(count), az(count);
+    std::vector<f32> ra_f(count), dec_f(count), alt_f(count), az_f(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ra[i] = coords[i].ra;
+        dec[i] = coords[i].dec;
+        ra_f[i] = static_cast<f32>(coords[i].ra);
+        dec_f[i] = static_cast<f32>(coords[i].dec);
+    }
+
+    for (const SimdPath path : {SimdPath::Scalar, SimdPath::Avx2})
+    {
+        if (!BatchTransform::set_path(path))
+        {
+            std::printf("%s path not supported on this CPU/build\n", BatchTransform::get_path_name(path));
+            continue;
+        }
+
+        const std::string label_f64 = std::string("BatchTransform f64, ") + BatchTransform::get_path_name(path);
+        report(label_f64.c_str(), count, [&] {
+            BatchTransform::equatorial_to_horizontal(std::span<const f64>(ra), std::span<const f64>(dec),
+                                                     observer, lst, std::span<f64>(alt), std::span<f64>(az));
+            std::size_t above = 0;
+            for (const f64 a : alt)
+            {
+                above += a >= 0.0 ? 1 : 0;
+            }
+            return above;
+        });
+
+        const std::string label_f32 = std::string("BatchTransform f32, ") + BatchTransform::get_path_name(path);
+        report(label_f32.c_str(), count, [&] {
+            BatchTransform::equatorial_to_horizontal(std::span<const f32>(ra_f), std::span<const f32>(dec_f),
+                                                     observer, lst, std::span<f32>(alt_f), std::span<f32>(az_f));
+            std::size_t above = 0;
+            for (const f32 a : alt_f)
+            {
+                above += a >= 0.0f ? 1 : 0;
+            }
+            return above;
+        });
+    }
+
+    return 0;
+}
@@ -3,12 +3,13 @@
 // -----------------------------------------------------------------
 // Starfield vertex shader
 //
-// Reads star data from a storage buffer (one vec4 per star).
+// Reads star data from a storage buffer (one packed uvec2 per star,
+// see rendering::PackedStarVertex).
 // Computes point size from brightness, converts B-V to RGB color.
 // -----------------------------------------------------------------
 
 layout(set = 0, binding = 0) readonly buffer StarBuffer {
-    vec4 stars[];  // xy = screen position, z = brightness, w = B-V color
+    uvec2 stars[];  // x = unorm16 screen x/y over [-1, 1], y = half brightness / B-V
 };
 
 layout(push_constant) uniform PushConstants {
@@ -94,13 +95,15 @@ vec3 bv_to_rgb(float bv)
 
 void main()
 {
-    vec4 star = stars[gl_InstanceIndex];
+    uvec2 packed_star = stars[gl_InstanceIndex];
+    vec2 screen = unpackUnorm2x16(packed_star.x) * 2.0 - 1.0;
+    vec2 brightness_color = unpackHalf2x16(packed_star.y);
 
-    // Screen position (already in NDC [-1, 1])
-    gl_Position = vec4(star.xy, 0.0, 1.0);
+    // Screen position (NDC [-1, 1])
+    gl_Position = vec4(screen, 0.0, 1.0);
 
     // Brightness with configurable scaling
-    float brightness = star.z * brightness_scale;
+    float brightness = brightness_color.x * brightness_scale;
 
     // Point size: sqrt scaling gives perceptually correct brightness-to-area
     // Brighter stars get bigger points
@@ -109,5 +112,5 @@ void main()
 
     // Output to fragment shader
     v_brightness = clamp(brightness, 0.0, 1.0);
-    v_color = bv_to_rgb(star.w);
+    v_color = bv_to_rgb(brightness_color.y);
 }
\ No newline at end of file
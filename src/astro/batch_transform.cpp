@@ -0,0 +1,134 @@
+/// @file batch_transform.cpp
+/// @brief BatchTransform dispatch and scalar fallback.
+
+#include "astro/batch_transform.hpp"
+
+#include "core/cpu_features.hpp"
+#include "core/types.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace parallax::astro
+{
+
+SimdPath BatchTransform::s_path = BatchTransform::detect_path();
+
+// -----------------------------------------------------------------
+// Double precision
+// -----------------------------------------------------------------
+
+void BatchTransform::equatorial_to_horizontal(std::span<const f64> ra,
+                                              std::span<const f64> dec,
+                                              const ObserverLocation& observer,
+                                              f64 local_sidereal_time_rad,
+                                              std::span<f64> alt,
+                                              std::span<f64> az)
+{
+    assert(dec.size() == ra.size() && alt.size() == ra.size() && az.size() == ra.size());
+
+    if (s_path == SimdPath::Avx2)
+    {
+        equatorial_to_horizontal_avx2(ra.data(), dec.data(), ra.size(),
+                                      std::sin(observer.latitude_rad),
+                                      std::cos(observer.latitude_rad),
+                                      local_sidereal_time_rad, alt.data(), az.data());
+        return;
+    }
+
+    for (std::size_t i = 0; i < ra.size(); ++i)
+    {
+        const auto hz = Coordinates::equatorial_to_horizontal(
+            EquatorialCoord{.ra = ra[i], .dec = dec[i]}, observer, local_sidereal_time_rad);
+        alt[i] = hz.alt;
+        az[i] = hz.az;
+    }
+}
+
+// -----------------------------------------------------------------
+// Single precision (scalar fallback computes in double, then rounds)
+// -----------------------------------------------------------------
+
+void BatchTransform::equatorial_to_horizontal(std::span<const f32> ra,
+                                              std::span<const f32> dec,
+                                              const ObserverLocation& observer,
+                                              f64 local_sidereal_time_rad,
+                                              std::span<f32> alt,
+                                              std::span<f32> az)
+{
+    assert(dec.size() == ra.size() && alt.size() == ra.size() && az.size() == ra.size());
+
+    if (s_path == SimdPath::Avx2)
+    {
+        // Reduce LST to [0, 2π) in double before narrowing so H = LST − RA
+        // stays small and keeps float precision
+        f64 lst = std::fmod(local_sidereal_time_rad, astro_constants::kTwoPi);
+        if (lst < 0.0)
+        {
+            lst += astro_constants::kTwoPi;
+        }
+        equatorial_to_horizontal_avx2(ra.data(), dec.data(), ra.size(),
+                                      static_cast<f32>(std::sin(observer.latitude_rad)),
+                                      static_cast<f32>(std::cos(observer.latitude_rad)),
+                                      static_cast<f32>(lst), alt.data(), az.data());
+        return;
+    }
+
+    for (std::size_t i = 0; i < ra.size(); ++i)
+    {
+        const auto hz = Coordinates::equatorial_to_horizontal(
+            EquatorialCoord{.ra = ra[i], .dec = dec[i]}, observer, local_sidereal_time_rad);
+        alt[i] = static_cast<f32>(hz.alt);
+        az[i] = static_cast<f32>(hz.az);
+    }
+}
+
+// -----------------------------------------------------------------
+// Path selection
+// -----------------------------------------------------------------
+
+SimdPath BatchTransform::get_path()
+{
+    return s_path;
+}
+
+bool BatchTransform::set_path(SimdPath path)
+{
+    if (!is_supported(path))
+    {
+        return false;
+    }
+    s_path = path;
+    return true;
+}
+
+bool BatchTransform::is_supported(SimdPath path)
+{
+    switch (path)
+    {
+    case SimdPath::Scalar:
+        return true;
+    case SimdPath::Avx2:
+        return avx2_compiled() && core::get_cpu_features().avx2 && core::get_cpu_features().fma;
+    }
+    return false;
+}
+
+const char* BatchTransform::get_path_name(SimdPath path)
+{
+    switch (path)
+    {
+    case SimdPath::Scalar:
+        return "scalar";
+    case SimdPath::Avx2:
+        return "AVX2";
+    }
+    return "unknown";
+}
+
+SimdPath BatchTransform::detect_path()
+{
+    return is_supported(SimdPath::Avx2) ? SimdPath::Avx2 : SimdPath::Scalar;
+}
+
+} // namespace parallax::astro
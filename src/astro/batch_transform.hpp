@@ -0,0 +1,104 @@
+#pragma once
+
+/// @file batch_transform.hpp
+/// @brief Array form of Coordinates::equatorial_to_horizontal with runtime-selected SIMD kernels.
+
+#include "astro/coordinates.hpp"
+#include "core/types.hpp"
+
+#include <span>
+
+namespace parallax::astro
+{
+    /// @brief Implementation used by BatchTransform.
+    enum class SimdPath : u8
+    {
+        Scalar,     ///< Coordinates::equatorial_to_horizontal per element (libm trig)
+        Avx2,       ///< AVX2 + FMA: 4 doubles or 8 floats per instruction
+    };
+
+    /// @brief Equatorial → Horizontal over arrays (SoA in, SoA out).
+    ///
+    /// The AVX2 kernels evaluate the same spherical-trig formulas as
+    /// Coordinates::equatorial_to_horizontal with vector polynomial
+    /// sin/cos (Cody-Waite reduction by π/2, Cephes minimax polynomials) and
+    /// atan2 (octant reduction, Cephes rational / polynomial atan). Altitude
+    /// is taken as atan2(up, hypot(north, east)), i.e. asin without the
+    /// conditioning loss near the zenith.
+    ///
+    /// Accuracy over the whole sky against an extended-precision reference
+    /// (see test_batch_transform.cpp), RA in [0, 2π):
+    /// - f64 path: kMaxErrorF64Arcsec (measured 1.6e-9″, round-off level).
+    /// - f32 path: kMaxErrorF32Arcsec (measured 0.13″, dominated by float
+    ///   rounding of the inputs and outputs). At the narrowest FOV (0.5°)
+    ///   across 3840 px one pixel is ≈ 0.47″, so this is kMaxErrorF32Pixels
+    ///   (< 0.5) px.
+    ///
+    /// The path is chosen at startup from CPUID (AVX2 and FMA, with OS YMM
+    /// support); set_path() overrides it, e.g. to test both. Non-x86 builds
+    /// have only the scalar path.
+    class BatchTransform
+    {
+    public:
+        BatchTransform() = delete;
+
+        /// @brief Bound on |alt error| and |az error| × cos(alt), double path.
+        static constexpr f64 kMaxErrorF64Arcsec = 1.0e-8;
+
+        /// @brief Same bound for the float path.
+        static constexpr f64 kMaxErrorF32Arcsec = 0.2;
+
+        /// @brief Float-path bound in pixels for 3840 px across a 0.5° FOV.
+        static constexpr f64 kMaxErrorF32Pixels = kMaxErrorF32Arcsec / (0.5 * 3600.0 / 3840.0);
+
+        /// @brief RA/Dec (radians) → Alt/Az (radians), double precision.
+        ///
+        /// All spans must have the same length. Output is within
+        /// kMaxErrorF64Arcsec of the exact transform on the SIMD paths.
+        static void equatorial_to_horizontal(std::span<const f64> ra,
+                                             std::span<const f64> dec,
+                                             const ObserverLocation& observer,
+                                             f64 local_sidereal_time_rad,
+                                             std::span<f64> alt,
+                                             std::span<f64> az);
+
+        /// @brief RA/Dec (radians) → Alt/Az (radians), single precision.
+        ///
+        /// For on-screen positions where sub-pixel accuracy is enough.
+        static void equatorial_to_horizontal(std::span<const f32> ra,
+                                             std::span<const f32> dec,
+                                             const ObserverLocation& observer,
+                                             f64 local_sidereal_time_rad,
+                                             std::span<f32> alt,
+                                             std::span<f32> az);
+
+        /// @brief Path in use (detected at startup).
+        [[nodiscard]] static SimdPath get_path();
+
+        /// @brief Force a path. Returns false (and changes nothing) if unsupported.
+        static bool set_path(SimdPath path);
+
+        /// @brief True if this CPU/build can run the path.
+        [[nodiscard]] static bool is_supported(SimdPath path);
+
+        /// @brief Human-readable path name ("scalar", "AVX2").
+        [[nodiscard]] static const char* get_path_name(SimdPath path);
+
+    private:
+        /// @brief AVX2 kernels (batch_transform_avx2.cpp, built with AVX2/FMA flags).
+        static void equatorial_to_horizontal_avx2(const f64* ra, const f64* dec, std::size_t count,
+                                                  f64 sin_lat, f64 cos_lat, f64 lst,
+                                                  f64* alt, f64* az);
+        static void equatorial_to_horizontal_avx2(const f32* ra, const f32* dec, std::size_t count,
+                                                  f32 sin_lat, f32 cos_lat, f32 lst,
+                                                  f32* alt, f32* az);
+
+        /// @brief True if batch_transform_avx2.cpp was built with AVX2 code.
+        [[nodiscard]] static bool avx2_compiled();
+
+        [[nodiscard]] static SimdPath detect_path();
+
+        static SimdPath s_path;
+    };
+
+} // namespace parallax::astro
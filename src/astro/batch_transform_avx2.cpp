@@ -0,0 +1,372 @@
+/// @file batch_transform_avx2.cpp
+/// @brief AVX2 + FMA kernels for BatchTransform.
+///
+/// This translation unit is the only one built with AVX2/FMA code generation
+/// (per-file flags in CMake), so nothing here may run before the CPUID check
+/// in BatchTransform::is_supported(). Without those flags the kernels
+/// compile to stubs and avx2_compiled() reports false.
+///
+/// Polynomials are the Cephes minimax fits (S. L. Moshier):
+/// - sin/cos on |r| ≤ π/4 after Cody-Waite reduction by π/2 (three-part
+///   constant, exact for |x| ≲ 1e5, far beyond the ±4π seen here);
+/// - atan on |t| ≤ 0.66 (double, rational 4/5) or |t| ≤ tan(π/8) (float,
+///   polynomial), with the octant folding of atan2 done by blends.
+
+#include "astro/batch_transform.hpp"
+
+#include "core/types.hpp"
+
+#include <cassert>
+#include <cstddef>
+
+#if defined(__AVX2__) && defined(__FMA__)
+    #include <immintrin.h>
+    #define PLX_BATCH_TRANSFORM_AVX2 1
+#endif
+
+namespace parallax::astro
+{
+
+#if defined(PLX_BATCH_TRANSFORM_AVX2)
+
+namespace
+{
+    // -----------------------------------------------------------------
+    // Double precision: 4 lanes
+    // -----------------------------------------------------------------
+
+    struct SinCosPd
+    {
+        __m256d sin;
+        __m256d cos;
+    };
+
+    inline __m256d sign_mask_pd()
+    {
+        return _mm256_set1_pd(-0.0);
+    }
+
+    SinCosPd sincos_pd(__m256d x)
+    {
+        // n = round(x · 2/π), r = x − n · π/2 (three-part π/2)
+        const __m256d n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(0.63661977236758134308)),
+                                          _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256d r = _mm256_fnmadd_pd(n, _mm256_set1_pd(1.57079625129699707031e0), x);
+        r = _mm256_fnmadd_pd(n, _mm256_set1_pd(7.54978941586159635336e-8), r);
+        r = _mm256_fnmadd_pd(n, _mm256_set1_pd(5.39030285815811905290e-15), r);
+
+        const __m256d z = _mm256_mul_pd(r, r);
+
+        // sin(r) = r + r·z·S(z)
+        __m256d s = _mm256_set1_pd(1.58962301576546568060e-10);
+        s = _mm256_fmadd_pd(s, z, _mm256_set1_pd(-2.50507477628578072866e-8));
+        s = _mm256_fmadd_pd(s, z, _mm256_set1_pd(2.75573136213857245213e-6));
+        s = _mm256_fmadd_pd(s, z, _mm256_set1_pd(-1.98412698295895385996e-4));
+        s = _mm256_fmadd_pd(s, z, _mm256_set1_pd(8.33333333332211858878e-3));
+        s = _mm256_fmadd_pd(s, z, _mm256_set1_pd(-1.66666666666666307295e-1));
+        s = _mm256_fmadd_pd(_mm256_mul_pd(r, z), s, r);
+
+        // cos(r) = 1 − z/2 + z²·C(z)
+        __m256d c = _mm256_set1_pd(-1.13585365213876817300e-11);
+        c = _mm256_fmadd_pd(c, z, _mm256_set1_pd(2.08757008419747316778e-9));
+        c = _mm256_fmadd_pd(c, z, _mm256_set1_pd(-2.75573141792967388112e-7));
+        c = _mm256_fmadd_pd(c, z, _mm256_set1_pd(2.48015872888517045348e-5));
+        c = _mm256_fmadd_pd(c, z, _mm256_set1_pd(-1.38888888888730564116e-3));
+        c = _mm256_fmadd_pd(c, z, _mm256_set1_pd(4.16666666666665929218e-2));
+        c = _mm256_fmadd_pd(_mm256_mul_pd(z, z), c,
+                            _mm256_fnmadd_pd(_mm256_set1_pd(0.5), z, _mm256_set1_pd(1.0)));
+
+        // Quadrant q = n mod 4: swap on odd q, sin negative for q ∈ {2, 3},
+        // cos negative for q ∈ {1, 2}
+        const __m256i q = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n));
+        const __m256d swap = _mm256_castsi256_pd(
+            _mm256_cmpeq_epi64(_mm256_and_si256(q, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(1)));
+        const __m256d sin_sign = _mm256_castsi256_pd(
+            _mm256_slli_epi64(_mm256_and_si256(q, _mm256_set1_epi64x(2)), 62));
+        const __m256d cos_sign = _mm256_castsi256_pd(
+            _mm256_slli_epi64(_mm256_and_si256(_mm256_add_epi64(q, _mm256_set1_epi64x(1)),
+                                               _mm256_set1_epi64x(2)), 62));
+
+        return SinCosPd{
+            .sin = _mm256_xor_pd(_mm256_blendv_pd(s, c, swap), sin_sign),
+            .cos = _mm256_xor_pd(_mm256_blendv_pd(c, s, swap), cos_sign),
+        };
+    }
+
+    __m256d atan2_pd(__m256d y, __m256d x)
+    {
+        const __m256d sign = sign_mask_pd();
+        const __m256d ax = _mm256_andnot_pd(sign, x);
+        const __m256d ay = _mm256_andnot_pd(sign, y);
+
+        // t = min/max ∈ [0, 1] (0 when both are zero)
+        const __m256d swap = _mm256_cmp_pd(ay, ax, _CMP_GT_OQ);
+        const __m256d num = _mm256_min_pd(ax, ay);
+        const __m256d den = _mm256_max_pd(ax, ay);
+        const __m256d zero_den = _mm256_cmp_pd(den, _mm256_setzero_pd(), _CMP_EQ_OQ);
+        const __m256d t = _mm256_blendv_pd(_mm256_div_pd(num, den), _mm256_setzero_pd(), zero_den);
+
+        // t > 0.66: atan(t) = π/4 + atan((t − 1)/(t + 1))
+        const __m256d big = _mm256_cmp_pd(t, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d tr = _mm256_blendv_pd(
+            t, _mm256_div_pd(_mm256_sub_pd(t, one), _mm256_add_pd(t, one)), big);
+        const __m256d z = _mm256_mul_pd(tr, tr);
+
+        __m256d p = _mm256_set1_pd(-8.750608600031904122785e-1);
+        p = _mm256_fmadd_pd(p, z, _mm256_set1_pd(-1.615753718733365076637e1));
+        p = _mm256_fmadd_pd(p, z, _mm256_set1_pd(-7.500855792314704667340e1));
+        p = _mm256_fmadd_pd(p, z, _mm256_set1_pd(-1.228866684490136173410e2));
+        p = _mm256_fmadd_pd(p, z, _mm256_set1_pd(-6.485021904942025371773e1));
+
+        __m256d q = _mm256_add_pd(z, _mm256_set1_pd(2.485846490142306297962e1));
+        q = _mm256_fmadd_pd(q, z, _mm256_set1_pd(1.650270098316988542046e2));
+        q = _mm256_fmadd_pd(q, z, _mm256_set1_pd(4.328810604912902668951e2));
+        q = _mm256_fmadd_pd(q, z, _mm256_set1_pd(4.853903996359136964868e2));
+        q = _mm256_fmadd_pd(q, z, _mm256_set1_pd(1.945506571482613964425e2));
+
+        __m256d a = _mm256_fmadd_pd(_mm256_mul_pd(tr, z), _mm256_div_pd(p, q), tr);
+        a = _mm256_add_pd(a, _mm256_and_pd(big, _mm256_set1_pd(astro_constants::kPi / 4.0)));
+
+        // Undo the octant folding: swap → π/2 − a, x < 0 → π − a, sign of y
+        a = _mm256_blendv_pd(a, _mm256_sub_pd(_mm256_set1_pd(astro_constants::kHalfPi), a), swap);
+        a = _mm256_blendv_pd(a, _mm256_sub_pd(_mm256_set1_pd(astro_constants::kPi), a), x);
+        return _mm256_or_pd(a, _mm256_and_pd(sign, y));
+    }
+
+    void kernel_pd(const f64* ra, const f64* dec, f64* alt, f64* az,
+                   __m256d sin_lat, __m256d cos_lat, __m256d lst)
+    {
+        const __m256d hour_angle = _mm256_sub_pd(lst, _mm256_loadu_pd(ra));
+        const SinCosPd d = sincos_pd(_mm256_loadu_pd(dec));
+        const SinCosPd h = sincos_pd(hour_angle);
+
+        const __m256d cos_dec_cos_ha = _mm256_mul_pd(d.cos, h.cos);
+        const __m256d up = _mm256_fmadd_pd(d.sin, sin_lat, _mm256_mul_pd(cos_dec_cos_ha, cos_lat));
+        const __m256d north = _mm256_fmsub_pd(d.sin, cos_lat, _mm256_mul_pd(cos_dec_cos_ha, sin_lat));
+        const __m256d east = _mm256_xor_pd(_mm256_mul_pd(d.cos, h.sin), sign_mask_pd());
+
+        const __m256d horiz = _mm256_sqrt_pd(_mm256_fmadd_pd(north, north, _mm256_mul_pd(east, east)));
+
+        __m256d azimuth = atan2_pd(east, north);
+        const __m256d negative = _mm256_cmp_pd(azimuth, _mm256_setzero_pd(), _CMP_LT_OQ);
+        azimuth = _mm256_add_pd(azimuth, _mm256_and_pd(negative, _mm256_set1_pd(astro_constants::kTwoPi)));
+
+        _mm256_storeu_pd(alt, atan2_pd(up, horiz));
+        _mm256_storeu_pd(az, azimuth);
+    }
+
+    // -----------------------------------------------------------------
+    // Single precision: 8 lanes
+    // -----------------------------------------------------------------
+
+    struct SinCosPs
+    {
+        __m256 sin;
+        __m256 cos;
+    };
+
+    inline __m256 sign_mask_ps()
+    {
+        return _mm256_set1_ps(-0.0f);
+    }
+
+    SinCosPs sincos_ps(__m256 x)
+    {
+        const __m256 n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.636619772f)),
+                                         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(1.5703125f), x);
+        r = _mm256_fnmadd_ps(n, _mm256_set1_ps(4.837512969970703125e-4f), r);
+        r = _mm256_fnmadd_ps(n, _mm256_set1_ps(7.54978995489188216e-8f), r);
+
+        const __m256 z = _mm256_mul_ps(r, r);
+
+        __m256 s = _mm256_set1_ps(-1.9515295891e-4f);
+        s = _mm256_fmadd_ps(s, z, _mm256_set1_ps(8.3321608736e-3f));
+        s = _mm256_fmadd_ps(s, z, _mm256_set1_ps(-1.6666654611e-1f));
+        s = _mm256_fmadd_ps(_mm256_mul_ps(r, z), s, r);
+
+        __m256 c = _mm256_set1_ps(2.443315711809948e-5f);
+        c = _mm256_fmadd_ps(c, z, _mm256_set1_ps(-1.388731625493765e-3f));
+        c = _mm256_fmadd_ps(c, z, _mm256_set1_ps(4.166664568298827e-2f));
+        c = _mm256_fmadd_ps(_mm256_mul_ps(z, z), c,
+                            _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), z, _mm256_set1_ps(1.0f)));
+
+        const __m256i q = _mm256_cvtps_epi32(n);
+        const __m256 swap = _mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+        const __m256 sin_sign = _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+        const __m256 cos_sign = _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)),
+                                               _mm256_set1_epi32(2)), 30));
+
+        return SinCosPs{
+            .sin = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sin_sign),
+            .cos = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cos_sign),
+        };
+    }
+
+    __m256 atan2_ps(__m256 y, __m256 x)
+    {
+        const __m256 sign = sign_mask_ps();
+        const __m256 ax = _mm256_andnot_ps(sign, x);
+        const __m256 ay = _mm256_andnot_ps(sign, y);
+
+        const __m256 swap = _mm256_cmp_ps(ay, ax, _CMP_GT_OQ);
+        const __m256 num = _mm256_min_ps(ax, ay);
+        const __m256 den = _mm256_max_ps(ax, ay);
+        const __m256 zero_den = _mm256_cmp_ps(den, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        const __m256 t = _mm256_blendv_ps(_mm256_div_ps(num, den), _mm256_setzero_ps(), zero_den);
+
+        // t > tan(π/8): atan(t) = π/4 + atan((t − 1)/(t + 1))
+        const __m256 big = _mm256_cmp_ps(t, _mm256_set1_ps(0.414213562f), _CMP_GT_OQ);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 tr = _mm256_blendv_ps(
+            t, _mm256_div_ps(_mm256_sub_ps(t, one), _mm256_add_ps(t, one)), big);
+        const __m256 z = _mm256_mul_ps(tr, tr);
+
+        __m256 p = _mm256_set1_ps(8.05374449538e-2f);
+        p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-1.38776856032e-1f));
+        p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(1.99777106478e-1f));
+        p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-3.33329491539e-1f));
+
+        __m256 a = _mm256_fmadd_ps(_mm256_mul_ps(tr, z), p, tr);
+        a = _mm256_add_ps(a, _mm256_and_ps(big, _mm256_set1_ps(static_cast<f32>(astro_constants::kPi / 4.0))));
+
+        a = _mm256_blendv_ps(a, _mm256_sub_ps(_mm256_set1_ps(static_cast<f32>(astro_constants::kHalfPi)), a), swap);
+        a = _mm256_blendv_ps(a, _mm256_sub_ps(_mm256_set1_ps(static_cast<f32>(astro_constants::kPi)), a), x);
+        return _mm256_or_ps(a, _mm256_and_ps(sign, y));
+    }
+
+    void kernel_ps(const f32* ra, const f32* dec, f32* alt, f32* az,
+                   __m256 sin_lat, __m256 cos_lat, __m256 lst)
+    {
+        const __m256 hour_angle = _mm256_sub_ps(lst, _mm256_loadu_ps(ra));
+        const SinCosPs d = sincos_ps(_mm256_loadu_ps(dec));
+        const SinCosPs h = sincos_ps(hour_angle);
+
+        const __m256 cos_dec_cos_ha = _mm256_mul_ps(d.cos, h.cos);
+        const __m256 up = _mm256_fmadd_ps(d.sin, sin_lat, _mm256_mul_ps(cos_dec_cos_ha, cos_lat));
+        const __m256 north = _mm256_fmsub_ps(d.sin, cos_lat, _mm256_mul_ps(cos_dec_cos_ha, sin_lat));
+        const __m256 east = _mm256_xor_ps(_mm256_mul_ps(d.cos, h.sin), sign_mask_ps());
+
+        const __m256 horiz = _mm256_sqrt_ps(_mm256_fmadd_ps(north, north, _mm256_mul_ps(east, east)));
+
+        __m256 azimuth = atan2_ps(east, north);
+        const __m256 negative = _mm256_cmp_ps(azimuth, _mm256_setzero_ps(), _CMP_LT_OQ);
+        azimuth = _mm256_add_ps(azimuth, _mm256_and_ps(negative,
+                                                       _mm256_set1_ps(static_cast<f32>(astro_constants::kTwoPi))));
+
+        _mm256_storeu_ps(alt, atan2_ps(up, horiz));
+        _mm256_storeu_ps(az, azimuth);
+    }
+
+} // anonymous namespace
+
+// -----------------------------------------------------------------
+// Drivers: full vectors, then one zero-padded vector for the tail so
+// every element goes through the same kernel
+// -----------------------------------------------------------------
+
+void BatchTransform::equatorial_to_horizontal_avx2(const f64* ra, const f64* dec, std::size_t count,
+                                                   f64 sin_lat, f64 cos_lat, f64 lst,
+                                                   f64* alt, f64* az)
+{
+    constexpr std::size_t kLanes = 4;
+    const __m256d v_sin_lat = _mm256_set1_pd(sin_lat);
+    const __m256d v_cos_lat = _mm256_set1_pd(cos_lat);
+    const __m256d v_lst = _mm256_set1_pd(lst);
+
+    std::size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        kernel_pd(ra + i, dec + i, alt + i, az + i, v_sin_lat, v_cos_lat, v_lst);
+    }
+
+    if (i < count)
+    {
+        f64 tail_ra[kLanes] = {};
+        f64 tail_dec[kLanes] = {};
+        f64 tail_alt[kLanes];
+        f64 tail_az[kLanes];
+        for (std::size_t k = 0; k < count - i; ++k)
+        {
+            tail_ra[k] = ra[i + k];
+            tail_dec[k] = dec[i + k];
+        }
+        kernel_pd(tail_ra, tail_dec, tail_alt, tail_az, v_sin_lat, v_cos_lat, v_lst);
+        for (std::size_t k = 0; k < count - i; ++k)
+        {
+            alt[i + k] = tail_alt[k];
+            az[i + k] = tail_az[k];
+        }
+    }
+}
+
+void BatchTransform::equatorial_to_horizontal_avx2(const f32* ra, const f32* dec, std::size_t count,
+                                                   f32 sin_lat, f32 cos_lat, f32 lst,
+                                                   f32* alt, f32* az)
+{
+    constexpr std::size_t kLanes = 8;
+    const __m256 v_sin_lat = _mm256_set1_ps(sin_lat);
+    const __m256 v_cos_lat = _mm256_set1_ps(cos_lat);
+    const __m256 v_lst = _mm256_set1_ps(lst);
+
+    std::size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        kernel_ps(ra + i, dec + i, alt + i, az + i, v_sin_lat, v_cos_lat, v_lst);
+    }
+
+    if (i < count)
+    {
+        f32 tail_ra[kLanes] = {};
+        f32 tail_dec[kLanes] = {};
+        f32 tail_alt[kLanes];
+        f32 tail_az[kLanes];
+        for (std::size_t k = 0; k < count - i; ++k)
+        {
+            tail_ra[k] = ra[i + k];
+            tail_dec[k] = dec[i + k];
+        }
+        kernel_ps(tail_ra, tail_dec, tail_alt, tail_az, v_sin_lat, v_cos_lat, v_lst);
+        for (std::size_t k = 0; k < count - i; ++k)
+        {
+            alt[i + k] = tail_alt[k];
+            az[i + k] = tail_az[k];
+        }
+    }
+}
+
+bool BatchTransform::avx2_compiled()
+{
+    return true;
+}
+
+#else
+
+// -----------------------------------------------------------------
+// Built without AVX2/FMA (non-x86 target): never selected
+// -----------------------------------------------------------------
+
+void BatchTransform::equatorial_to_horizontal_avx2(const f64*, const f64*, std::size_t,
+                                                   f64, f64, f64, f64*, f64*)
+{
+    assert(false && "AVX2 kernel not compiled");
+}
+
+void BatchTransform::equatorial_to_horizontal_avx2(const f32*, const f32*, std::size_t,
+                                                   f32, f32, f32, f32*, f32*)
+{
+    assert(false && "AVX2 kernel not compiled");
+}
+
+bool BatchTransform::avx2_compiled()
+{
+    return false;
+}
+
+#endif
+
+} // namespace parallax::astro
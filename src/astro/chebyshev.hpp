@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file chebyshev.hpp
+/// @brief Chebyshev series on [-1, 1]: fitting at Chebyshev nodes, and
+/// evaluation of a 3-component series with its derivative.
+
+#include "core/types.hpp"
+
+#include <cmath>
+#include <span>
+
+namespace parallax::astro
+{
+    /// @brief Largest series the evaluator accepts (JPL DE files use ≤ 14 per component).
+    inline constexpr u32 kMaxChebyshevCoefficients = 18;
+
+    /// @brief A 3-component Chebyshev series and its derivative at one point.
+    struct ChebyshevResult
+    {
+        Vec3d value;
+        Vec3d derivative;   ///< d/dx on [-1, 1]; scale by 2 / interval length for d/dt
+    };
+
+    /// @brief k-th of n Chebyshev nodes (zeros of T_n), descending from near +1.
+    [[nodiscard]] inline f64 chebyshev_node(u32 k, u32 n)
+    {
+        return std::cos(astro_constants::kPi * (static_cast<f64>(k) + 0.5) / static_cast<f64>(n));
+    }
+
+    /// @brief Coefficients of the degree n−1 series interpolating samples
+    /// taken at chebyshev_node(k, n), k = 0..n−1 (n = samples.size()).
+    ///
+    /// Interpolation at the nodes is within a small factor of the minimax
+    /// polynomial, and the coefficients come out of one cosine sum each.
+    inline void fit_chebyshev(std::span<const f64> samples, std::span<f64> coefficients)
+    {
+        const auto n = static_cast<u32>(samples.size());
+        for (u32 j = 0; j < n; ++j)
+        {
+            f64 sum = 0.0;
+            for (u32 k = 0; k < n; ++k)
+            {
+                sum += samples[k] * std::cos(astro_constants::kPi * static_cast<f64>(j)
+                                             * (static_cast<f64>(k) + 0.5) / static_cast<f64>(n));
+            }
+            coefficients[j] = sum * ((j == 0) ? 1.0 : 2.0) / static_cast<f64>(n);
+        }
+    }
+
+    /// @brief Evaluate x, y, z series stored back to back (count coefficients
+    /// each, the JPL DE layout) at x in [-1, 1].
+    ///
+    /// T_k and T'_k come from one recurrence shared by the three components,
+    /// so a 13-term series costs ~130 flops and no transcendental calls.
+    [[nodiscard]] inline ChebyshevResult evaluate_chebyshev(const f64* coefficients, u32 count, f64 x)
+    {
+        f64 t[kMaxChebyshevCoefficients];
+        f64 dt[kMaxChebyshevCoefficients];
+        t[0] = 1.0;
+        dt[0] = 0.0;
+        if (count > 1)
+        {
+            t[1] = x;
+            dt[1] = 1.0;
+        }
+        for (u32 k = 2; k < count; ++k)
+        {
+            t[k] = 2.0 * x * t[k - 1] - t[k - 2];
+            dt[k] = 2.0 * t[k - 1] + 2.0 * x * dt[k - 1] - dt[k - 2];
+        }
+
+        ChebyshevResult result{.value = Vec3d{0.0}, .derivative = Vec3d{0.0}};
+        for (u32 axis = 0; axis < 3; ++axis)
+        {
+            const f64* c = coefficients + static_cast<std::size_t>(axis) * count;
+            f64 value = 0.0;
+            f64 derivative = 0.0;
+            for (u32 k = 0; k < count; ++k)
+            {
+                value += c[k] * t[k];
+                derivative += c[k] * dt[k];
+            }
+            result.value[static_cast<int>(axis)] = value;
+            result.derivative[static_cast<int>(axis)] = derivative;
+        }
+        return result;
+    }
+
+} // namespace parallax::astro
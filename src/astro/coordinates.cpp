@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <cmath>
 
+#include <glm/matrix.hpp>
+
 namespace parallax::astro
 {
 
@@ -174,6 +176,65 @@ std::optional<Vec2f> Coordinates::horizontal_to_screen(
     return Vec2f{screen_x, screen_y};
 }
 
+// -----------------------------------------------------------------
+// Vector form of the Equatorial → Horizontal transform
+//
+// Rotate about the pole by LST (x' toward the meridian, y' = -sin H):
+//   x' =  cos(LST) × x + sin(LST) × y = cos(dec) × cos(H)
+//   y' = -sin(LST) × x + cos(LST) × y = -cos(dec) × sin(H)
+//
+// then tilt by the latitude:
+//   north = -sin(lat) × x' + cos(lat) × z   (= az_x above)
+//   east  =  y'                             (= az_y above)
+//   up    =  cos(lat) × x' + sin(lat) × z   (= sin(alt))
+// -----------------------------------------------------------------
+
+Vec3d Coordinates::equatorial_to_unit_vector(const EquatorialCoord& eq)
+{
+    const f64 cos_dec = std::cos(eq.dec);
+    return Vec3d{cos_dec * std::cos(eq.ra), cos_dec * std::sin(eq.ra), std::sin(eq.dec)};
+}
+
+Mat3d Coordinates::equatorial_to_horizontal_matrix(
+    const ObserverLocation& observer,
+    f64 local_sidereal_time_rad)
+{
+    const f64 sin_lat = std::sin(observer.latitude_rad);
+    const f64 cos_lat = std::cos(observer.latitude_rad);
+    const f64 sin_lst = std::sin(local_sidereal_time_rad);
+    const f64 cos_lst = std::cos(local_sidereal_time_rad);
+
+    // Written as rows; glm matrices are column-major
+    const Mat3d rows{
+        Vec3d{-sin_lat * cos_lst, -sin_lat * sin_lst, cos_lat},    // north
+        Vec3d{-sin_lst,            cos_lst,           0.0},        // east
+        Vec3d{ cos_lat * cos_lst,  cos_lat * sin_lst, sin_lat},    // up
+    };
+    return glm::transpose(rows);
+}
+
+HorizontalCoord Coordinates::unit_vector_to_horizontal(const Vec3d& v)
+{
+    return HorizontalCoord{
+        .alt = std::asin(std::clamp(v.z, -1.0, 1.0)),
+        .az  = normalize_radians(std::atan2(v.y, v.x)),
+    };
+}
+
+Vec3d Coordinates::horizontal_to_unit_vector(const HorizontalCoord& hz)
+{
+    const f64 cos_alt = std::cos(hz.alt);
+    return Vec3d{cos_alt * std::cos(hz.az), cos_alt * std::sin(hz.az), std::sin(hz.alt)};
+}
+
+EquatorialCoord Coordinates::unit_vector_to_equatorial(const Vec3d& v)
+{
+    return EquatorialCoord{
+        .ra  = normalize_radians(std::atan2(v.y, v.x)),
+        .dec = std::asin(std::clamp(v.z, -1.0, 1.0)),
+    };
+}
+
 // -----------------------------------------------------------------
 // Normalize angle to [0, 2π)
 // -----------------------------------------------------------------
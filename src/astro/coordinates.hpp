@@ -76,6 +76,40 @@ namespace parallax::astro
             f64 fov_rad
         );
 
+        // -----------------------------------------------------------------
+        // Vector form
+        //
+        // For many stars at one instant, convert each star to a unit vector
+        // once (at load time) and rotate it with a matrix built once per
+        // frame, instead of calling equatorial_to_horizontal per star.
+        // -----------------------------------------------------------------
+
+        /// @brief Equatorial direction → unit vector (x → RA 0h, z → north pole).
+        [[nodiscard]] static Vec3d equatorial_to_unit_vector(const EquatorialCoord& eq);
+
+        /// @brief Rotation taking equatorial unit vectors to the local horizontal
+        /// frame (x = north, y = east, z = zenith).
+        ///
+        /// Equivalent to equatorial_to_horizontal(): for u = equatorial_to_unit_vector(eq),
+        /// unit_vector_to_horizontal(M × u) gives the same Alt/Az, and (M × u).z
+        /// is sin(alt), so the horizon test needs no trig.
+        ///
+        /// @param observer Observer geographic location.
+        /// @param local_sidereal_time_rad Local Mean Sidereal Time (radians).
+        [[nodiscard]] static Mat3d equatorial_to_horizontal_matrix(
+            const ObserverLocation& observer,
+            f64 local_sidereal_time_rad
+        );
+
+        /// @brief Horizontal-frame unit vector (north, east, zenith) → Alt/Az.
+        [[nodiscard]] static HorizontalCoord unit_vector_to_horizontal(const Vec3d& v);
+
+        /// @brief Alt/Az → horizontal-frame unit vector (north, east, zenith).
+        [[nodiscard]] static Vec3d horizontal_to_unit_vector(const HorizontalCoord& hz);
+
+        /// @brief Equatorial unit vector → RA/Dec (inverse of equatorial_to_unit_vector).
+        [[nodiscard]] static EquatorialCoord unit_vector_to_equatorial(const Vec3d& v);
+
     private:
         /// @brief Normalize an angle to the range [0, 2π).
         [[nodiscard]] static f64 normalize_radians(f64 angle);
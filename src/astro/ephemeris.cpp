@@ -0,0 +1,612 @@
+/// @file ephemeris.cpp
+/// @brief Ephemeris implementation: compact planetary and lunar series,
+/// Chebyshev window fitting, background refits.
+
+#include "astro/ephemeris.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+using parallax::f64;
+using parallax::i32;
+using parallax::u32;
+using parallax::Vec3d;
+using parallax::astro::Body;
+
+constexpr f64 kJ2000 = 2451545.0;
+constexpr f64 kDaysPerCentury = 36525.0;
+constexpr f64 kDegToRad = parallax::astro_constants::kDegToRad;
+constexpr f64 kArcsecToRad = parallax::astro_constants::kArcSecToRad;
+constexpr f64 kAuKm = 149597870.7;
+
+/// Obliquity of the ecliptic at J2000 (IAU 2006, 84381.406″)
+constexpr f64 kObliquityJ2000 = 84381.406 * kArcsecToRad;
+
+/// Earth/Moon mass ratio (DE430)
+constexpr f64 kEarthMoonMassRatio = 81.30056907419062;
+
+/// Step for the central-difference velocity of the series fallback (days)
+constexpr f64 kFallbackStepDays = 0.01;
+
+std::size_t index_of(Body body)
+{
+    return static_cast<std::size_t>(body);
+}
+
+// -----------------------------------------------------------------
+// Window per body: length (days) and coefficients per axis. Sized so
+// the fit stays ~100× below the accuracy of the series it replaces
+// (see test_ephemeris). The Sun has none: it is minus the Earth
+// -----------------------------------------------------------------
+struct WindowSpec
+{
+    f64 length_days;
+    u32 coefficient_count;
+};
+
+constexpr WindowSpec kWindows[] = {
+    {0.0, 0},       // Sun
+    {4.0, 13},      // Moon
+    {8.0, 12},      // Mercury
+    {16.0, 11},     // Venus
+    {16.0, 13},     // Earth (carries the Moon's monthly wobble)
+    {32.0, 11},     // Mars
+    {32.0, 8},      // Jupiter
+    {32.0, 7},      // Saturn
+    {64.0, 7},      // Uranus
+    {64.0, 6},      // Neptune
+};
+static_assert(std::size(kWindows) == static_cast<std::size_t>(Body::Count));
+
+constexpr const char* kBodyNames[] = {
+    "Sun", "Moon", "Mercury", "Venus", "Earth", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune",
+};
+static_assert(std::size(kBodyNames) == static_cast<std::size_t>(Body::Count));
+
+// -----------------------------------------------------------------
+// Planets: Keplerian elements and rates per Julian century, J2000
+// ecliptic and equinox (Standish, "Keplerian Elements for Approximate
+// Positions of the Major Planets", table 1, 1800–2050). The Earth row
+// is the Earth-Moon barycentre
+// -----------------------------------------------------------------
+struct OrbitalElements
+{
+    f64 a, e, i, mean_longitude, perihelion_longitude, node_longitude;   // AU, deg
+    f64 a_rate, e_rate, i_rate, mean_longitude_rate, perihelion_rate, node_rate;
+};
+
+constexpr OrbitalElements kPlanets[] = {
+    // Mercury
+    {0.38709927, 0.20563593, 7.00497902, 252.25032350, 77.45779628, 48.33076593,
+     0.00000037, 0.00001906, -0.00594749, 149472.67411175, 0.16047689, -0.12534081},
+    // Venus
+    {0.72333566, 0.00677672, 3.39467605, 181.97909950, 131.60246718, 76.67984255,
+     0.00000390, -0.00004107, -0.00078890, 58517.81538729, 0.00268329, -0.27769418},
+    // Earth-Moon barycentre
+    {1.00000261, 0.01671123, -0.00001531, 100.46457166, 102.93768193, 0.0,
+     0.00000562, -0.00004392, -0.01294668, 35999.37244981, 0.32327364, 0.0},
+    // Mars
+    {1.52371034, 0.09339410, 1.84969142, -4.55343205, -23.94362959, 49.55953891,
+     0.00001847, 0.00007882, -0.00813131, 19140.30268499, 0.44441088, -0.29257343},
+    // Jupiter
+    {5.20288700, 0.04838624, 1.30439695, 34.39644051, 14.72847983, 100.47390909,
+     -0.00011607, -0.00013253, -0.00183714, 3034.74612775, 0.21252668, 0.20469106},
+    // Saturn
+    {9.53667594, 0.05386179, 2.48599187, 49.95424423, 92.59887831, 113.66242448,
+     -0.00125060, -0.00050991, 0.00193609, 1222.49362201, -0.41897216, -0.28867794},
+    // Uranus
+    {19.18916464, 0.04725744, 0.77263783, 313.23810451, 170.95427630, 74.01692503,
+     -0.00196176, -0.00004397, -0.00242939, 428.48202785, 0.40805281, 0.04240589},
+    // Neptune
+    {30.06992276, 0.00859048, 1.77004347, -55.12002969, 44.96476227, 131.78422574,
+     0.00026291, 0.00005105, 0.00035372, 218.45945325, -0.32241464, -0.00508664},
+};
+
+/// Ecliptic J2000 → equatorial J2000 (rotation about x by −ε₀)
+Vec3d ecliptic_to_equatorial(const Vec3d& v)
+{
+    const f64 c = std::cos(kObliquityJ2000);
+    const f64 s = std::sin(kObliquityJ2000);
+    return Vec3d{v.x, c * v.y - s * v.z, s * v.y + c * v.z};
+}
+
+/// Heliocentric position of a planet (or the EM barycentre), equatorial J2000
+Vec3d kepler_position(const OrbitalElements& el, f64 t)
+{
+    const f64 a = el.a + el.a_rate * t;
+    const f64 e = el.e + el.e_rate * t;
+    const f64 i = (el.i + el.i_rate * t) * kDegToRad;
+    const f64 mean_longitude = el.mean_longitude + el.mean_longitude_rate * t;
+    const f64 perihelion = el.perihelion_longitude + el.perihelion_rate * t;
+    const f64 node = (el.node_longitude + el.node_rate * t) * kDegToRad;
+
+    const f64 argument_of_perihelion = perihelion * kDegToRad - node;
+    f64 mean_anomaly = std::remainder(mean_longitude - perihelion, 360.0) * kDegToRad;
+
+    // Kepler's equation by Newton iteration (e < 0.21: a handful of steps)
+    f64 ecc_anomaly = mean_anomaly + e * std::sin(mean_anomaly);
+    for (i32 iter = 0; iter < 10; ++iter)
+    {
+        const f64 delta = (ecc_anomaly - e * std::sin(ecc_anomaly) - mean_anomaly)
+                          / (1.0 - e * std::cos(ecc_anomaly));
+        ecc_anomaly -= delta;
+        if (std::abs(delta) < 1.0e-15)
+        {
+            break;
+        }
+    }
+
+    // In the orbital plane, x toward perihelion
+    const f64 xp = a * (std::cos(ecc_anomaly) - e);
+    const f64 yp = a * std::sqrt(1.0 - e * e) * std::sin(ecc_anomaly);
+
+    const f64 cw = std::cos(argument_of_perihelion);
+    const f64 sw = std::sin(argument_of_perihelion);
+    const f64 cn = std::cos(node);
+    const f64 sn = std::sin(node);
+    const f64 ci = std::cos(i);
+    const f64 si = std::sin(i);
+
+    const Vec3d ecliptic{
+        (cw * cn - sw * sn * ci) * xp + (-sw * cn - cw * sn * ci) * yp,
+        (cw * sn + sw * cn * ci) * xp + (-sw * sn + cw * cn * ci) * yp,
+        (sw * si) * xp + (cw * si) * yp,
+    };
+    return ecliptic_to_equatorial(ecliptic);
+}
+
+// -----------------------------------------------------------------
+// Moon: largest periodic terms of Meeus, "Astronomical Algorithms"
+// ch. 47 (ELP-2000/82 abridged). Multipliers of D, M, M', F, then the
+// coefficient: longitude and latitude in 1e-6 degree, distance in m
+// -----------------------------------------------------------------
+struct LunarTerm
+{
+    i32 d, m, mp, f;
+    f64 longitude;
+    f64 distance;
+};
+
+struct LatitudeTerm
+{
+    i32 d, m, mp, f;
+    f64 latitude;
+};
+
+constexpr LunarTerm kLunarTerms[] = {
+    {0, 0, 1, 0, 6288774, -20905355},
+    {2, 0, -1, 0, 1274027, -3699111},
+    {2, 0, 0, 0, 658314, -2955968},
+    {0, 0, 2, 0, 213618, -569925},
+    {0, 1, 0, 0, -185116, 48888},
+    {0, 0, 0, 2, -114332, -3149},
+    {2, 0, -2, 0, 58793, 246158},
+    {2, -1, -1, 0, 57066, -152138},
+    {2, 0, 1, 0, 53322, -170733},
+    {2, -1, 0, 0, 45758, -204586},
+    {0, 1, -1, 0, -40923, -129620},
+    {1, 0, 0, 0, -34720, 108743},
+    {0, 1, 1, 0, -30383, 104755},
+    {2, 0, 0, -2, 15327, 10321},
+    {0, 0, 1, 2, -12528, 0},
+    {0, 0, 1, -2, 10980, 79661},
+    {4, 0, -1, 0, 10675, -34782},
+    {0, 0, 3, 0, 10034, -23210},
+    {4, 0, -2, 0, 8548, -21636},
+    {2, 1, -1, 0, -7888, 24208},
+    {2, 1, 0, 0, -6766, 30824},
+    {1, 0, -1, 0, -5163, -8379},
+    {1, 1, 0, 0, 4987, -16675},
+    {2, -1, 1, 0, 4036, -12831},
+    {2, 0, 2, 0, 3994, -10445},
+    {4, 0, 0, 0, 3861, -11650},
+    {2, 0, -3, 0, 3665, 14403},
+    {0, 1, -2, 0, -2689, -7003},
+};
+
+constexpr LatitudeTerm kLatitudeTerms[] = {
+    {0, 0, 0, 1, 5128122},
+    {0, 0, 1, 1, 280602},
+    {0, 0, 1, -1, 277693},
+    {2, 0, 0, -1, 173237},
+    {2, 0, -1, 1, 55413},
+    {2, 0, -1, -1, 46271},
+    {2, 0, 0, 1, 32573},
+    {0, 0, 2, 1, 17198},
+    {2, 0, 1, -1, 9266},
+    {0, 0, 2, -1, 8822},
+    {2, -1, 0, -1, 8216},
+    {2, 0, -2, -1, 4324},
+    {2, 0, 1, 1, 4200},
+    {2, 1, 0, -1, -3359},
+    {2, -1, -1, 1, 2463},
+};
+
+/// Terms with the Sun's mean anomaly shrink as the Earth's orbit circularizes
+f64 eccentricity_factor(i32 m, f64 e)
+{
+    const i32 order = std::abs(m);
+    return (order == 0) ? 1.0 : (order == 1) ? e : e * e;
+}
+
+/// Geocentric Moon, equatorial J2000 (AU)
+Vec3d moon_position(f64 t)
+{
+    const f64 mean_longitude = 218.3164477 + 481267.88123421 * t;
+    const f64 d  = (297.8501921 + 445267.1114034 * t) * kDegToRad;    // Mean elongation
+    const f64 m  = (357.5291092 + 35999.0502909 * t) * kDegToRad;     // Sun's mean anomaly
+    const f64 mp = (134.9633964 + 477198.8675055 * t) * kDegToRad;    // Moon's mean anomaly
+    const f64 f  = (93.2720950 + 483202.0175233 * t) * kDegToRad;     // Argument of latitude
+    const f64 e  = 1.0 - 0.002516 * t - 0.0000074 * t * t;
+
+    f64 sum_longitude = 0.0;
+    f64 sum_distance = 0.0;
+    for (const LunarTerm& term : kLunarTerms)
+    {
+        const f64 arg = term.d * d + term.m * m + term.mp * mp + term.f * f;
+        const f64 scale = eccentricity_factor(term.m, e);
+        sum_longitude += scale * term.longitude * std::sin(arg);
+        sum_distance += scale * term.distance * std::cos(arg);
+    }
+
+    f64 sum_latitude = 0.0;
+    for (const LatitudeTerm& term : kLatitudeTerms)
+    {
+        const f64 arg = term.d * d + term.m * m + term.mp * mp + term.f * f;
+        sum_latitude += eccentricity_factor(term.m, e) * term.latitude * std::sin(arg);
+    }
+
+    // Ecliptic of date → J2000: take out the general precession in longitude
+    // (IAU 2006 p_A; the ecliptic's own motion is < 0.5″ per century here)
+    const f64 precession = (5028.796195 * t + 1.1054348 * t * t) * kArcsecToRad;
+    const f64 longitude = (mean_longitude + sum_longitude * 1.0e-6) * kDegToRad - precession;
+    const f64 latitude = sum_latitude * 1.0e-6 * kDegToRad;
+    const f64 distance = (385000.56 + sum_distance * 1.0e-3) / kAuKm;
+
+    const f64 cb = std::cos(latitude);
+    return ecliptic_to_equatorial(Vec3d{
+        distance * cb * std::cos(longitude),
+        distance * cb * std::sin(longitude),
+        distance * std::sin(latitude),
+    });
+}
+
+} // anonymous namespace
+
+namespace parallax::astro
+{
+
+// -----------------------------------------------------------------
+// Construction / Destruction
+// -----------------------------------------------------------------
+
+Ephemeris::Ephemeris(core::JobSystem& jobs, const EphemerisConfig& config)
+    : m_jobs{jobs}
+    , m_config{config}
+{
+    // A window placed with the margin behind the current time must not
+    // already be due for a refit
+    m_config.refit_margin = std::clamp(m_config.refit_margin, 0.0, 0.45);
+    m_config.window_scale = std::max(m_config.window_scale, 1.0e-3);
+}
+
+Ephemeris::~Ephemeris()
+{
+    if (m_refit_in_flight)
+    {
+        m_jobs.wait(m_refit_counter);
+    }
+}
+
+// -----------------------------------------------------------------
+// Per-frame update: swap in finished refits, start the next
+// -----------------------------------------------------------------
+
+void Ephemeris::update(f64 jd_tt)
+{
+    if (m_primed && jd_tt != m_last_time)
+    {
+        m_direction = (jd_tt > m_last_time) ? 1.0 : -1.0;
+    }
+    m_last_time = jd_tt;
+
+    if (!m_primed)
+    {
+        for (u32 b = 0; b < kBodyCount; ++b)
+        {
+            m_segments[b] = fit(static_cast<Body>(b), jd_tt, m_direction);
+        }
+        m_primed = true;
+        ++m_refit_count;
+        return;
+    }
+
+    if (m_refit_in_flight && m_refit_counter.is_done())
+    {
+        wait_for_refit();
+    }
+    if (m_refit_in_flight)
+    {
+        return;
+    }
+
+    u32 mask = 0;
+    for (u32 b = 0; b < kBodyCount; ++b)
+    {
+        if (needs_refit(static_cast<Body>(b), jd_tt))
+        {
+            mask |= 1u << b;
+        }
+    }
+    if (mask == 0)
+    {
+        return;
+    }
+
+    m_refit_mask = mask;
+    m_refit_time = jd_tt;
+    m_refit_direction = m_direction;
+    m_refit_in_flight = true;
+    m_jobs.submit(core::Job{.function = &Ephemeris::refit_job, .context = this}, m_refit_counter);
+
+    // Without worker threads the job only runs inside wait(): refit inline
+    if (m_jobs.get_thread_count() == 1)
+    {
+        wait_for_refit();
+    }
+}
+
+void Ephemeris::wait_for_refit()
+{
+    if (!m_refit_in_flight)
+    {
+        return;
+    }
+
+    m_jobs.wait(m_refit_counter);
+    for (u32 b = 0; b < kBodyCount; ++b)
+    {
+        if ((m_refit_mask & (1u << b)) != 0)
+        {
+            m_segments[b] = m_pending[b];
+        }
+    }
+    m_refit_in_flight = false;
+    ++m_refit_count;
+}
+
+void Ephemeris::refit_job(void* context)
+{
+    auto& self = *static_cast<Ephemeris*>(context);
+    for (u32 b = 0; b < kBodyCount; ++b)
+    {
+        if ((self.m_refit_mask & (1u << b)) != 0)
+        {
+            self.m_pending[b] = self.fit(static_cast<Body>(b), self.m_refit_time, self.m_refit_direction);
+        }
+    }
+}
+
+// -----------------------------------------------------------------
+// Fitting
+// -----------------------------------------------------------------
+
+Ephemeris::Segment Ephemeris::fit(Body body, f64 jd_tt, f64 direction) const
+{
+    const WindowSpec& spec = kWindows[index_of(body)];
+    Segment segment{};
+    if (spec.coefficient_count == 0)
+    {
+        return segment;
+    }
+
+    segment.length = spec.length_days * m_config.window_scale;
+    segment.count = spec.coefficient_count;
+    const f64 behind = m_config.refit_margin * segment.length;
+    segment.start = (direction > 0.0) ? jd_tt - behind : jd_tt + behind - segment.length;
+
+    std::array<f64, kMaxChebyshevCoefficients> samples[3];
+    for (u32 k = 0; k < segment.count; ++k)
+    {
+        const f64 x = chebyshev_node(k, segment.count);
+        const Vec3d position = series_position(body, segment.start + 0.5 * (x + 1.0) * segment.length);
+        for (u32 axis = 0; axis < 3; ++axis)
+        {
+            samples[axis][k] = position[static_cast<int>(axis)];
+        }
+    }
+
+    for (u32 axis = 0; axis < 3; ++axis)
+    {
+        fit_chebyshev(std::span<const f64>(samples[axis].data(), segment.count),
+                      std::span<f64>(segment.coefficients.data() + axis * segment.count, segment.count));
+    }
+    return segment;
+}
+
+bool Ephemeris::needs_refit(Body body, f64 jd_tt) const
+{
+    const Segment& segment = m_segments[index_of(body)];
+    if (kWindows[index_of(body)].coefficient_count == 0)
+    {
+        return false;
+    }
+    if (segment.length == 0.0)
+    {
+        return true;
+    }
+
+    const f64 end = segment.start + segment.length;
+    const f64 margin = m_config.refit_margin * segment.length;
+    if (jd_tt < segment.start || jd_tt > end)
+    {
+        return true;
+    }
+    return (m_direction > 0.0) ? jd_tt > end - margin : jd_tt < segment.start + margin;
+}
+
+// -----------------------------------------------------------------
+// Queries
+// -----------------------------------------------------------------
+
+StateVector Ephemeris::native_state(Body body, f64 jd_tt) const
+{
+    const Segment& segment = m_segments[index_of(body)];
+    const f64 offset = jd_tt - segment.start;
+    if (segment.length > 0.0 && offset >= 0.0 && offset <= segment.length)
+    {
+        const f64 x = 2.0 * offset / segment.length - 1.0;
+        const ChebyshevResult result = evaluate_chebyshev(segment.coefficients.data(), segment.count, x);
+        return StateVector{
+            .position = result.value,
+            .velocity = result.derivative * (2.0 / segment.length),
+        };
+    }
+
+    ++m_fallback_count;
+    const Vec3d ahead = series_position(body, jd_tt + kFallbackStepDays);
+    const Vec3d behind = series_position(body, jd_tt - kFallbackStepDays);
+    return StateVector{
+        .position = series_position(body, jd_tt),
+        .velocity = (ahead - behind) / (2.0 * kFallbackStepDays),
+    };
+}
+
+StateVector Ephemeris::get_geocentric(Body body, f64 jd_tt) const
+{
+    switch (body)
+    {
+        case Body::Earth:
+            return StateVector{.position = Vec3d{0.0}, .velocity = Vec3d{0.0}};
+        case Body::Moon:
+            return native_state(Body::Moon, jd_tt);
+        case Body::Sun:
+        {
+            const StateVector earth = native_state(Body::Earth, jd_tt);
+            return StateVector{.position = -earth.position, .velocity = -earth.velocity};
+        }
+        default:
+        {
+            const StateVector planet = native_state(body, jd_tt);
+            const StateVector earth = native_state(Body::Earth, jd_tt);
+            return StateVector{
+                .position = planet.position - earth.position,
+                .velocity = planet.velocity - earth.velocity,
+            };
+        }
+    }
+}
+
+StateVector Ephemeris::get_heliocentric(Body body, f64 jd_tt) const
+{
+    switch (body)
+    {
+        case Body::Sun:
+            return StateVector{.position = Vec3d{0.0}, .velocity = Vec3d{0.0}};
+        case Body::Moon:
+        {
+            const StateVector moon = native_state(Body::Moon, jd_tt);
+            const StateVector earth = native_state(Body::Earth, jd_tt);
+            return StateVector{
+                .position = earth.position + moon.position,
+                .velocity = earth.velocity + moon.velocity,
+            };
+        }
+        default:
+            return native_state(body, jd_tt);
+    }
+}
+
+bool Ephemeris::covers(f64 jd_tt) const
+{
+    for (u32 b = 0; b < kBodyCount; ++b)
+    {
+        const Segment& segment = m_segments[b];
+        if (kWindows[b].coefficient_count == 0)
+        {
+            continue;
+        }
+        if (segment.length == 0.0 || jd_tt < segment.start || jd_tt > segment.start + segment.length)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+u64 Ephemeris::get_refit_count() const
+{
+    return m_refit_count;
+}
+
+u64 Ephemeris::get_fallback_count() const
+{
+    return m_fallback_count;
+}
+
+const char* Ephemeris::get_body_name(Body body)
+{
+    return (body < Body::Count) ? kBodyNames[index_of(body)] : "Unknown";
+}
+
+// -----------------------------------------------------------------
+// Model: direct series
+// -----------------------------------------------------------------
+
+Vec3d Ephemeris::series_position(Body body, f64 jd_tt)
+{
+    const f64 t = (jd_tt - kJ2000) / kDaysPerCentury;
+    switch (body)
+    {
+        case Body::Sun:
+            return Vec3d{0.0};
+        case Body::Moon:
+            return moon_position(t);
+        case Body::Earth:
+            // Barycentre minus the Earth's share of the Moon's offset
+            return kepler_position(kPlanets[2], t) - moon_position(t) / (1.0 + kEarthMoonMassRatio);
+        case Body::Mercury:
+            return kepler_position(kPlanets[0], t);
+        case Body::Venus:
+            return kepler_position(kPlanets[1], t);
+        case Body::Mars:
+            return kepler_position(kPlanets[3], t);
+        case Body::Jupiter:
+            return kepler_position(kPlanets[4], t);
+        case Body::Saturn:
+            return kepler_position(kPlanets[5], t);
+        case Body::Uranus:
+            return kepler_position(kPlanets[6], t);
+        case Body::Neptune:
+            return kepler_position(kPlanets[7], t);
+        default:
+            return Vec3d{0.0};
+    }
+}
+
+Vec3d Ephemeris::direct_geocentric(Body body, f64 jd_tt)
+{
+    switch (body)
+    {
+        case Body::Earth:
+            return Vec3d{0.0};
+        case Body::Moon:
+            return series_position(Body::Moon, jd_tt);
+        default:
+            return series_position(body, jd_tt) - series_position(Body::Earth, jd_tt);
+    }
+}
+
+Vec3d Ephemeris::direct_heliocentric(Body body, f64 jd_tt)
+{
+    if (body == Body::Moon)
+    {
+        return series_position(Body::Earth, jd_tt) + series_position(Body::Moon, jd_tt);
+    }
+    return series_position(body, jd_tt);
+}
+
+} // namespace parallax::astro
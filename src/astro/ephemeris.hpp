@@ -0,0 +1,174 @@
+#pragma once
+
+/// @file ephemeris.hpp
+/// @brief Sun, Moon and planet positions: analytic series refitted as
+/// Chebyshev polynomials over sliding windows, refits on a background job.
+
+#include "astro/chebyshev.hpp"
+#include "core/job_system.hpp"
+#include "core/types.hpp"
+
+#include <array>
+
+namespace parallax::astro
+{
+    /// @brief Solar-system bodies the ephemeris serves.
+    enum class Body : u8
+    {
+        Sun,
+        Moon,
+        Mercury,
+        Venus,
+        Earth,
+        Mars,
+        Jupiter,
+        Saturn,
+        Uranus,
+        Neptune,
+        Count
+    };
+
+    /// @brief Position (AU) and velocity (AU/day), J2000 mean equator and
+    /// equinox axes (GCRS to ~25 mas), geometric (no light time or aberration).
+    struct StateVector
+    {
+        Vec3d position;
+        Vec3d velocity;
+    };
+
+    /// @brief Window sizing and refit policy.
+    struct EphemerisConfig
+    {
+        /// Multiplies every body's window length (coefficient counts stay
+        /// fixed, so < 1 is more accurate and refits more often).
+        f64 window_scale = 1.0;
+
+        /// A refit starts once the time is within this fraction of a window
+        /// of its leading edge; the new window is placed with the same
+        /// fraction behind the current time.
+        f64 refit_margin = 0.25;
+    };
+
+    /// @brief Per-frame ephemeris: a few dozen flops per body instead of a
+    /// full series evaluation.
+    ///
+    /// Each body (the Sun rides on the Earth) owns one Chebyshev segment:
+    /// a window of a few days to two months and 6–13 coefficients per axis,
+    /// sized to hold the fit well below a milliarcsecond of the series it
+    /// replaces. Velocity is the derivative of the same polynomial.
+    ///
+    /// update() runs once per frame. When the simulation time nears the edge
+    /// of a window (in whichever direction time is running) the stale bodies
+    /// are refitted on a JobSystem job and swapped in by a later update().
+    /// Until then, or after a jump outside every window, queries fall back to
+    /// the direct series, so a query never blocks and is never wrong. A
+    /// JobSystem without worker threads would never run the job on its own,
+    /// so there update() refits inline instead.
+    ///
+    /// The series (Model section) are compact, not JPL grade: Keplerian
+    /// elements with secular rates for the planets (Standish, 1800–2050,
+    /// arcminute level) and the 28/15 largest lunar terms (Meeus ch. 47,
+    /// ~10″). A DE file can replace them without changing the fitting.
+    ///
+    /// update() and the queries must be called from the same thread (the
+    /// one that owns the JobSystem); the job only writes a private buffer.
+    class Ephemeris
+    {
+    public:
+        explicit Ephemeris(core::JobSystem& jobs, const EphemerisConfig& config = {});
+
+        /// @brief Wait for a refit still in flight.
+        ~Ephemeris();
+
+        Ephemeris(const Ephemeris&) = delete;
+        Ephemeris& operator=(const Ephemeris&) = delete;
+        Ephemeris(Ephemeris&&) = delete;
+        Ephemeris& operator=(Ephemeris&&) = delete;
+
+        /// @brief Swap in finished refits and start one if a window is running out.
+        ///
+        /// The first call fits every body inline so the first frame is served
+        /// from polynomials.
+        void update(f64 jd_tt);
+
+        /// @brief Block until a refit in flight has finished and swap it in.
+        void wait_for_refit();
+
+        /// @brief State relative to the Earth's centre.
+        [[nodiscard]] StateVector get_geocentric(Body body, f64 jd_tt) const;
+
+        /// @brief State relative to the Sun's centre.
+        [[nodiscard]] StateVector get_heliocentric(Body body, f64 jd_tt) const;
+
+        /// @brief True if every body's current window contains jd_tt.
+        [[nodiscard]] bool covers(f64 jd_tt) const;
+
+        /// @brief Refits swapped in so far (the inline first fit counts).
+        [[nodiscard]] u64 get_refit_count() const;
+
+        /// @brief Queries answered from the direct series (outside the window).
+        [[nodiscard]] u64 get_fallback_count() const;
+
+        /// @brief Human-readable body name.
+        [[nodiscard]] static const char* get_body_name(Body body);
+
+        // -----------------------------------------------------------------
+        // Model (stateless): the direct series the windows are fitted to.
+        // Moon geocentric, everything else heliocentric (Sun = origin)
+        // -----------------------------------------------------------------
+
+        /// @brief Position from the series in the body's native frame (AU).
+        [[nodiscard]] static Vec3d series_position(Body body, f64 jd_tt);
+
+        /// @brief Geocentric position from the series (AU).
+        [[nodiscard]] static Vec3d direct_geocentric(Body body, f64 jd_tt);
+
+        /// @brief Heliocentric position from the series (AU).
+        [[nodiscard]] static Vec3d direct_heliocentric(Body body, f64 jd_tt);
+
+    private:
+        static constexpr u32 kBodyCount = static_cast<u32>(Body::Count);
+
+        /// @brief One body's current window: coefficients in DE layout (x, y, z).
+        struct Segment
+        {
+            f64 start = 0.0;        ///< TT Julian Date of the window's start
+            f64 length = 0.0;       ///< Days; 0 = no fit yet
+            u32 count = 0;          ///< Coefficients per axis
+            std::array<f64, 3 * kMaxChebyshevCoefficients> coefficients{};
+        };
+
+        /// @brief Native-frame state of one body: fitted window or series fallback.
+        [[nodiscard]] StateVector native_state(Body body, f64 jd_tt) const;
+
+        /// @brief Fit one body over a window placed around jd_tt.
+        [[nodiscard]] Segment fit(Body body, f64 jd_tt, f64 direction) const;
+
+        /// @brief True if the body's window will not last until the next refit lands.
+        [[nodiscard]] bool needs_refit(Body body, f64 jd_tt) const;
+
+        static void refit_job(void* context);
+
+        core::JobSystem& m_jobs;
+        EphemerisConfig m_config;
+
+        std::array<Segment, kBodyCount> m_segments{};
+
+        // Refit in flight: inputs set before submit, m_pending written by
+        // the job, read back only after m_refit_counter reaches zero
+        core::JobCounter m_refit_counter;
+        bool m_refit_in_flight = false;
+        u32 m_refit_mask = 0;
+        f64 m_refit_time = 0.0;
+        f64 m_refit_direction = 1.0;
+        std::array<Segment, kBodyCount> m_pending{};
+
+        f64 m_last_time = 0.0;
+        f64 m_direction = 1.0;      ///< +1 time running forward, −1 backward
+        bool m_primed = false;
+
+        u64 m_refit_count = 0;
+        mutable u64 m_fallback_count = 0;
+    };
+
+} // namespace parallax::astro
@@ -0,0 +1,466 @@
+/// @file jpl_ephemeris.cpp
+/// @brief JplEphemeris implementation: header validation, record LRU, in-place evaluation.
+
+#include "astro/jpl_ephemeris.hpp"
+
+#include "core/logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+
+using parallax::f64;
+using parallax::i32;
+using parallax::u32;
+
+// -----------------------------------------------------------------
+// Header record layout (byte offsets, fields in the file's byte order)
+//
+//   [0, 252)      3 title lines of 84 characters
+//   [252, 2652)   400 constant names of 6 characters
+//   [2652, 2676)  start JD, end JD, days per record (f64)
+//   [2676, 2680)  number of constants (i32)
+//   [2680, 2696)  AU in km, Earth/Moon mass ratio (f64)
+//   [2696, 2840)  12 × (offset, coefficients, sub-intervals): the 11
+//                 series of DeSeries, then nutations (2 axes) (i32)
+//   [2840, 2844)  DE number (i32)
+//   [2844, 2856)  librations (offset, coefficients, sub-intervals) (i32)
+//   then, when there are more than 400 constants, the remaining names,
+//   then lunar mantle velocity and TT−TDB pointers (DE430t and later)
+// -----------------------------------------------------------------
+constexpr std::size_t kSpanOffset = 2652;
+constexpr std::size_t kConstantCountOffset = 2676;
+constexpr std::size_t kAuOffset = 2680;
+constexpr std::size_t kEarthMoonRatioOffset = 2688;
+constexpr std::size_t kPointerOffset = 2696;
+constexpr std::size_t kDeNumberOffset = 2840;
+constexpr std::size_t kLibrationOffset = 2844;
+constexpr std::size_t kHeaderBytes = 2856;
+constexpr std::size_t kConstantNameBytes = 6;
+constexpr i32 kNamesInHeader = 400;
+
+constexpr u32 kPointerCount = 12;       // 11 series + nutations
+constexpr u32 kNutationIndex = 11;
+
+/// Record start JDs are exact multiples of the step in every JPL file
+constexpr f64 kRecordTimeTolerance = 1.0e-6;
+
+template <typename T>
+T read_field(const parallax::u8* data, std::size_t offset)
+{
+    T value{};
+    std::memcpy(&value, data + offset, sizeof(T));
+    return value;
+}
+
+i32 byte_swap(i32 value)
+{
+    const auto v = static_cast<u32>(value);
+    return static_cast<i32>((v >> 24) | ((v >> 8) & 0xFF00u) | ((v << 8) & 0xFF0000u) | (v << 24));
+}
+
+bool plausible_de_number(i32 value)
+{
+    return value > 0 && value < 10000;
+}
+
+} // anonymous namespace
+
+namespace parallax::astro
+{
+
+// -----------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------
+
+JplEphemeris::JplEphemeris(const std::filesystem::path& path, u32 cache_records)
+    : m_file{std::make_unique<core::MemoryMappedFile>(path)}
+    , m_cache_capacity{std::max(cache_records, 1u)}
+{
+    if (!m_file->is_open())
+    {
+        return;
+    }
+
+    m_open = parse_header();
+    if (!m_open)
+    {
+        PLX_CORE_ERROR("JPL ephemeris {}: not a usable DE file", path.string());
+        m_file.reset();
+        return;
+    }
+
+    m_cache.reserve(m_cache_capacity);
+    PLX_CORE_INFO("JPL ephemeris DE{} loaded: {} (JD {:.1f} – {:.1f}, {} records of {:.0f} days)",
+                  m_de_number, path.string(), m_start_jd, m_end_jd, m_record_count, m_record_days);
+}
+
+// -----------------------------------------------------------------
+// Header validation
+// -----------------------------------------------------------------
+
+bool JplEphemeris::parse_header()
+{
+    const u8* data = m_file->data();
+    const std::size_t size = m_file->size();
+    if (size < kHeaderBytes)
+    {
+        PLX_CORE_ERROR("JPL ephemeris: file too small for a header ({} bytes)", size);
+        return false;
+    }
+
+    const i32 de_number = read_field<i32>(data, kDeNumberOffset);
+    if (!plausible_de_number(de_number))
+    {
+        if (plausible_de_number(byte_swap(de_number)))
+        {
+            PLX_CORE_ERROR("JPL ephemeris: big-endian files are not supported");
+        }
+        return false;
+    }
+    m_de_number = static_cast<u32>(de_number);
+
+    m_start_jd = read_field<f64>(data, kSpanOffset);
+    m_end_jd = read_field<f64>(data, kSpanOffset + 8);
+    m_record_days = read_field<f64>(data, kSpanOffset + 16);
+    m_au_km = read_field<f64>(data, kAuOffset);
+    m_earth_moon_ratio = read_field<f64>(data, kEarthMoonRatioOffset);
+    if (!(m_record_days > 0.0) || !(m_end_jd > m_start_jd) || !(m_au_km > 0.0) || !(m_earth_moon_ratio > 0.0))
+    {
+        PLX_CORE_ERROR("JPL ephemeris: invalid time span or constants in header");
+        return false;
+    }
+
+    // The record length is not stored: it is where the last series ends.
+    // Ends are computed in u64 (three i32 factors cannot wrap it) and must
+    // leave room for the two header records plus one data record in the file
+    const u64 max_record_end = std::min<u64>(size / (3 * sizeof(f64)), std::numeric_limits<u32>::max()) + 1;
+    u64 record_end = 0;
+    const auto extend = [&](std::size_t offset, u32 axes) -> bool {
+        const i32 start = read_field<i32>(data, offset);
+        const i32 count = read_field<i32>(data, offset + 4);
+        const i32 subintervals = read_field<i32>(data, offset + 8);
+        if (start == 0 || count == 0 || subintervals == 0)
+        {
+            return true;        // Series absent from this file
+        }
+        if (start < 3 || count < 0 || subintervals < 0)
+        {
+            return false;
+        }
+        const u64 end = static_cast<u64>(start)
+                      + static_cast<u64>(count) * axes * static_cast<u64>(subintervals);
+        if (end > max_record_end)
+        {
+            return false;
+        }
+        record_end = std::max(record_end, end);
+        return true;
+    };
+
+    for (u32 i = 0; i < kPointerCount; ++i)
+    {
+        const std::size_t offset = kPointerOffset + i * 12;
+        if (!extend(offset, (i == kNutationIndex) ? 2 : 3))
+        {
+            PLX_CORE_ERROR("JPL ephemeris: invalid coefficient pointer {}", i);
+            return false;
+        }
+        if (i < kSeriesCount)
+        {
+            m_layout[i] = SeriesLayout{
+                .offset = static_cast<u32>(read_field<i32>(data, offset)),
+                .coefficient_count = static_cast<u32>(read_field<i32>(data, offset + 4)),
+                .subintervals = static_cast<u32>(read_field<i32>(data, offset + 8)),
+            };
+        }
+    }
+    if (!extend(kLibrationOffset, 3))
+    {
+        PLX_CORE_ERROR("JPL ephemeris: invalid libration pointer");
+        return false;
+    }
+
+    // Lunar mantle and TT−TDB pointers follow any names beyond the first 400
+    const i32 constant_count = read_field<i32>(data, kConstantCountOffset);
+    const std::size_t extra_offset = kHeaderBytes
+        + static_cast<std::size_t>(std::max(constant_count - kNamesInHeader, 0)) * kConstantNameBytes;
+    if (extra_offset + 24 <= size)
+    {
+        const u64 known_end = record_end;
+        if (!extend(extra_offset, 3) || !extend(extra_offset + 12, 1))
+        {
+            record_end = known_end;     // Older files: whatever is there is not a pointer
+        }
+    }
+
+    m_record_doubles = (record_end > 0) ? static_cast<u32>(record_end - 1) : 0;
+    const std::size_t record_bytes = static_cast<std::size_t>(m_record_doubles) * sizeof(f64);
+    if (m_record_doubles < 2 || record_bytes < kHeaderBytes)
+    {
+        PLX_CORE_ERROR("JPL ephemeris: implausible record length ({} coefficients)", m_record_doubles);
+        return false;
+    }
+
+    for (u32 i = 0; i < kSeriesCount; ++i)
+    {
+        const SeriesLayout& layout = m_layout[i];
+        if (layout.coefficient_count > kMaxChebyshevCoefficients || layout.subintervals == 0)
+        {
+            PLX_CORE_ERROR("JPL ephemeris: series {} has {} coefficients × {} sub-intervals (unsupported)",
+                           i, layout.coefficient_count, layout.subintervals);
+            return false;
+        }
+    }
+
+    m_record_count = static_cast<u32>(std::llround((m_end_jd - m_start_jd) / m_record_days));
+    const std::size_t needed = (2 + static_cast<std::size_t>(m_record_count)) * record_bytes;
+    if (m_record_count == 0 || size < needed)
+    {
+        PLX_CORE_ERROR("JPL ephemeris: {} records of {} bytes need {} bytes, file has {}",
+                       m_record_count, record_bytes, needed, size);
+        return false;
+    }
+
+    // A wrong record length shows up at once in the first record's span
+    const f64 first_start = read_field<f64>(data, 2 * record_bytes);
+    const f64 first_end = read_field<f64>(data, 2 * record_bytes + 8);
+    if (std::abs(first_start - m_start_jd) > kRecordTimeTolerance
+        || std::abs(first_end - (m_start_jd + m_record_days)) > kRecordTimeTolerance)
+    {
+        PLX_CORE_ERROR("JPL ephemeris: first record spans JD {} – {}, header says {} + {} days",
+                       first_start, first_end, m_start_jd, m_record_days);
+        return false;
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------
+// Record LRU
+// -----------------------------------------------------------------
+
+std::optional<JplEphemeris::DecodedRecord> JplEphemeris::find_record(u32 index) const
+{
+    const std::lock_guard lock(m_cache_mutex);
+    ++m_clock;
+
+    for (DecodedRecord& cached : m_cache)
+    {
+        if (cached.index == index)
+        {
+            cached.last_use = m_clock;
+            ++m_stats.hits;
+            return cached;
+        }
+    }
+    ++m_stats.misses;
+
+    // Records are 8-byte aligned: the mapping is page aligned and records
+    // are whole f64s long
+    const std::size_t record_bytes = static_cast<std::size_t>(m_record_doubles) * sizeof(f64);
+    const auto* record = reinterpret_cast<const f64*>(m_file->data() + (2 + static_cast<std::size_t>(index)) * record_bytes);
+
+    const f64 expected_start = m_start_jd + static_cast<f64>(index) * m_record_days;
+    if (std::abs(record[0] - expected_start) > kRecordTimeTolerance
+        || std::abs(record[1] - (expected_start + m_record_days)) > kRecordTimeTolerance)
+    {
+        PLX_CORE_ERROR("JPL ephemeris: record {} spans JD {} – {}, expected {} (file corrupt?)",
+                       index, record[0], record[1], expected_start);
+        return std::nullopt;
+    }
+
+    const DecodedRecord decoded{
+        .index = index,
+        .start_jd = record[0],
+        .coefficients = record,
+        .last_use = m_clock,
+    };
+
+    if (m_cache.size() < m_cache_capacity)
+    {
+        m_cache.push_back(decoded);
+    }
+    else
+    {
+        *std::min_element(m_cache.begin(), m_cache.end(), [](const DecodedRecord& a, const DecodedRecord& b) {
+            return a.last_use < b.last_use;
+        }) = decoded;
+    }
+    return decoded;
+}
+
+// -----------------------------------------------------------------
+// Queries
+// -----------------------------------------------------------------
+
+std::optional<StateVector> JplEphemeris::get_series(DeSeries series, f64 jd_tdb) const
+{
+    if (!m_open || series >= DeSeries::Count || !(jd_tdb >= m_start_jd && jd_tdb <= m_end_jd))
+    {
+        return std::nullopt;
+    }
+
+    const SeriesLayout& layout = m_layout[static_cast<std::size_t>(series)];
+    if (layout.coefficient_count == 0)
+    {
+        return std::nullopt;
+    }
+
+    // The end of the span belongs to the last record
+    const auto index = std::min(static_cast<u32>((jd_tdb - m_start_jd) / m_record_days), m_record_count - 1);
+    const auto record = find_record(index);
+    if (!record)
+    {
+        return std::nullopt;
+    }
+
+    const f64 sub_days = m_record_days / static_cast<f64>(layout.subintervals);
+    const f64 local = jd_tdb - record->start_jd;
+    const auto sub = std::min(static_cast<u32>(std::max(local, 0.0) / sub_days), layout.subintervals - 1);
+    const f64 x = 2.0 * (local - static_cast<f64>(sub) * sub_days) / sub_days - 1.0;
+
+    const f64* coefficients = record->coefficients + (layout.offset - 1)
+                            + static_cast<std::size_t>(sub) * 3 * layout.coefficient_count;
+    const ChebyshevResult result = evaluate_chebyshev(coefficients, layout.coefficient_count, x);
+
+    return StateVector{
+        .position = result.value,
+        .velocity = result.derivative * (2.0 / sub_days),
+    };
+}
+
+std::optional<StateVector> JplEphemeris::get_barycentric(Body body, f64 jd_tdb) const
+{
+    const auto to_au = [this](const StateVector& km) {
+        return StateVector{.position = km.position / m_au_km, .velocity = km.velocity / m_au_km};
+    };
+
+    switch (body)
+    {
+        case Body::Earth:
+        case Body::Moon:
+        {
+            const auto barycenter = get_series(DeSeries::EarthMoonBarycenter, jd_tdb);
+            const auto moon = get_series(DeSeries::Moon, jd_tdb);
+            if (!barycenter || !moon)
+            {
+                return std::nullopt;
+            }
+
+            // Earth sits 1/(1 + EMRAT) of the Earth-Moon distance from the barycentre
+            const f64 earth_share = 1.0 / (1.0 + m_earth_moon_ratio);
+            const StateVector earth{
+                .position = barycenter->position - moon->position * earth_share,
+                .velocity = barycenter->velocity - moon->velocity * earth_share,
+            };
+            if (body == Body::Earth)
+            {
+                return to_au(earth);
+            }
+            return to_au(StateVector{
+                .position = earth.position + moon->position,
+                .velocity = earth.velocity + moon->velocity,
+            });
+        }
+        default:
+            break;
+    }
+
+    DeSeries series = DeSeries::Sun;
+    switch (body)
+    {
+        case Body::Sun:     series = DeSeries::Sun; break;
+        case Body::Mercury: series = DeSeries::Mercury; break;
+        case Body::Venus:   series = DeSeries::Venus; break;
+        case Body::Mars:    series = DeSeries::Mars; break;
+        case Body::Jupiter: series = DeSeries::Jupiter; break;
+        case Body::Saturn:  series = DeSeries::Saturn; break;
+        case Body::Uranus:  series = DeSeries::Uranus; break;
+        case Body::Neptune: series = DeSeries::Neptune; break;
+        default:            return std::nullopt;
+    }
+
+    const auto state = get_series(series, jd_tdb);
+    return state ? std::optional<StateVector>{to_au(*state)} : std::nullopt;
+}
+
+std::optional<StateVector> JplEphemeris::get_geocentric(Body body, f64 jd_tdb) const
+{
+    if (body == Body::Moon)
+    {
+        const auto moon = get_series(DeSeries::Moon, jd_tdb);
+        if (!moon)
+        {
+            return std::nullopt;
+        }
+        return StateVector{.position = moon->position / m_au_km, .velocity = moon->velocity / m_au_km};
+    }
+
+    const auto earth = get_barycentric(Body::Earth, jd_tdb);
+    const auto target = get_barycentric(body, jd_tdb);
+    if (!earth || !target)
+    {
+        return std::nullopt;
+    }
+    return StateVector{
+        .position = target->position - earth->position,
+        .velocity = target->velocity - earth->velocity,
+    };
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+bool JplEphemeris::is_open() const
+{
+    return m_open;
+}
+
+f64 JplEphemeris::get_start_jd() const
+{
+    return m_start_jd;
+}
+
+f64 JplEphemeris::get_end_jd() const
+{
+    return m_end_jd;
+}
+
+f64 JplEphemeris::get_record_days() const
+{
+    return m_record_days;
+}
+
+u32 JplEphemeris::get_record_count() const
+{
+    return m_record_count;
+}
+
+u32 JplEphemeris::get_de_number() const
+{
+    return m_de_number;
+}
+
+f64 JplEphemeris::get_au_km() const
+{
+    return m_au_km;
+}
+
+f64 JplEphemeris::get_earth_moon_ratio() const
+{
+    return m_earth_moon_ratio;
+}
+
+DeCacheStats JplEphemeris::get_cache_stats() const
+{
+    const std::lock_guard lock(m_cache_mutex);
+    return m_stats;
+}
+
+} // namespace parallax::astro
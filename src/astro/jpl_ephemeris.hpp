@@ -0,0 +1,158 @@
+#pragma once
+
+/// @file jpl_ephemeris.hpp
+/// @brief JPL DE binary ephemeris (DE430/440/441 layout) read in place from a memory mapping.
+
+#include "astro/ephemeris.hpp"
+#include "core/memory_mapped_file.hpp"
+#include "core/types.hpp"
+
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace parallax::astro
+{
+    /// @brief Series stored in a DE file, in file order (the header's IPT table).
+    enum class DeSeries : u8
+    {
+        Mercury,
+        Venus,
+        EarthMoonBarycenter,
+        Mars,
+        Jupiter,
+        Saturn,
+        Uranus,
+        Neptune,
+        Pluto,
+        Moon,           ///< Geocentric
+        Sun,
+        Count
+    };
+
+    /// @brief Record cache counters.
+    struct DeCacheStats
+    {
+        u64 hits = 0;
+        u64 misses = 0;     ///< Records decoded (validated and located)
+    };
+
+    /// @brief Reader for JPL's native binary ephemeris files (e.g. linux_p1550p2650.440).
+    ///
+    /// The file is memory-mapped; Chebyshev coefficients are evaluated where
+    /// they lie in the mapping, so a query copies nothing and only the pages
+    /// of records actually used become resident (DE441 is 2.6 GB).
+    ///
+    /// Layout: record 1 is the header (titles, constant names, time span,
+    /// AU, Earth/Moon mass ratio, coefficient pointers), record 2 the
+    /// constant values, then one record per fixed time span (32 days in
+    /// DE440) holding its start and end JD followed by every series'
+    /// coefficients: for each sub-interval, x, y, z back to back. Only
+    /// little-endian files (as JPL distributes them) are accepted.
+    ///
+    /// "Decoding" a record means checking its stored time span against the
+    /// header grid and resolving its coefficient base; the last few decoded
+    /// records are kept in an LRU so consecutive queries (per frame, per body)
+    /// skip that work. Queries are safe from any number of threads: the LRU
+    /// is guarded by a mutex held only for the lookup, evaluation runs
+    /// outside it on the read-only mapping.
+    ///
+    /// Construction never throws: check is_open() (failures are logged).
+    /// Times are TDB Julian Dates (TT to ±1.7 ms).
+    class JplEphemeris
+    {
+    public:
+        /// @brief Map and validate a DE file.
+        /// @param cache_records Decoded records kept in the LRU (at least 1).
+        explicit JplEphemeris(const std::filesystem::path& path, u32 cache_records = kDefaultCacheRecords);
+
+        JplEphemeris(const JplEphemeris&) = delete;
+        JplEphemeris& operator=(const JplEphemeris&) = delete;
+        JplEphemeris(JplEphemeris&&) = delete;
+        JplEphemeris& operator=(JplEphemeris&&) = delete;
+
+        /// @brief True if the file was mapped and its header validated.
+        [[nodiscard]] bool is_open() const;
+
+        /// @brief One series as stored: km and km/day, ICRF, barycentric
+        /// except the Moon (geocentric). nullopt outside the file's span.
+        [[nodiscard]] std::optional<StateVector> get_series(DeSeries series, f64 jd_tdb) const;
+
+        /// @brief Body relative to the Earth's centre, AU and AU/day (as Ephemeris).
+        [[nodiscard]] std::optional<StateVector> get_geocentric(Body body, f64 jd_tdb) const;
+
+        /// @brief Body relative to the solar-system barycentre, AU and AU/day.
+        [[nodiscard]] std::optional<StateVector> get_barycentric(Body body, f64 jd_tdb) const;
+
+        /// @brief First and last TDB Julian Date covered.
+        [[nodiscard]] f64 get_start_jd() const;
+        [[nodiscard]] f64 get_end_jd() const;
+
+        /// @brief Days per record.
+        [[nodiscard]] f64 get_record_days() const;
+
+        /// @brief Data records in the file.
+        [[nodiscard]] u32 get_record_count() const;
+
+        /// @brief DE number from the header (e.g. 440).
+        [[nodiscard]] u32 get_de_number() const;
+
+        /// @brief Kilometres per AU, as the file defines it.
+        [[nodiscard]] f64 get_au_km() const;
+
+        /// @brief Earth/Moon mass ratio, as the file defines it.
+        [[nodiscard]] f64 get_earth_moon_ratio() const;
+
+        [[nodiscard]] DeCacheStats get_cache_stats() const;
+
+        static constexpr u32 kDefaultCacheRecords = 8;
+
+    private:
+        static constexpr u32 kSeriesCount = static_cast<u32>(DeSeries::Count);
+
+        /// @brief Where a series lives in every record (header IPT entry).
+        struct SeriesLayout
+        {
+            u32 offset = 0;             ///< First coefficient, in f64 units from the record start
+            u32 coefficient_count = 0;  ///< Per axis and sub-interval
+            u32 subintervals = 0;
+        };
+
+        /// @brief A validated record: its span and a pointer into the mapping.
+        struct DecodedRecord
+        {
+            u32 index = 0;
+            f64 start_jd = 0.0;
+            const f64* coefficients = nullptr;
+            u64 last_use = 0;           ///< LRU clock
+        };
+
+        [[nodiscard]] bool parse_header();
+
+        /// @brief Cached or freshly decoded record for a record index.
+        [[nodiscard]] std::optional<DecodedRecord> find_record(u32 index) const;
+
+        std::unique_ptr<core::MemoryMappedFile> m_file;
+        bool m_open = false;
+
+        f64 m_start_jd = 0.0;
+        f64 m_end_jd = 0.0;
+        f64 m_record_days = 0.0;
+        u32 m_record_count = 0;
+        u32 m_record_doubles = 0;       ///< Coefficients per record (1018 in DE440)
+        u32 m_de_number = 0;
+        f64 m_au_km = 0.0;
+        f64 m_earth_moon_ratio = 0.0;
+        std::array<SeriesLayout, kSeriesCount> m_layout{};
+
+        mutable std::mutex m_cache_mutex;       ///< Guards the LRU and the counters below
+        mutable std::vector<DecodedRecord> m_cache;
+        u32 m_cache_capacity = 0;
+        mutable u64 m_clock = 0;
+        mutable DeCacheStats m_stats;
+    };
+
+} // namespace parallax::astro
@@ -0,0 +1,119 @@
+/// @file julian_date.cpp
+/// @brief JulianDate implementation: normalization and conversions.
+
+#include "astro/julian_date.hpp"
+
+#include <cmath>
+
+namespace
+{
+
+constexpr parallax::i64 kJ2000Day = 2451545;
+
+} // anonymous namespace
+
+namespace parallax::astro
+{
+
+// -----------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------
+
+JulianDate::JulianDate(i64 day, f64 seconds)
+    : m_day{day}
+    , m_seconds{seconds}
+{
+    normalize();
+}
+
+JulianDate::JulianDate(f64 jd)
+{
+    const f64 day = std::floor(jd);
+    m_day = static_cast<i64>(day);
+    m_seconds = (jd - day) * kSecondsPerDay;    // jd − floor(jd) is exact
+    normalize();
+}
+
+JulianDate JulianDate::from_parts(f64 jd1, f64 jd2)
+{
+    // Whole days of each part go to the day number, fractions to seconds,
+    // so neither part's precision is lost in a sum
+    const f64 day1 = std::floor(jd1);
+    const f64 day2 = std::floor(jd2);
+    return JulianDate(static_cast<i64>(day1) + static_cast<i64>(day2),
+                      ((jd1 - day1) + (jd2 - day2)) * kSecondsPerDay);
+}
+
+// -----------------------------------------------------------------
+// Arithmetic: only the seconds counter moves, the day number carries
+// -----------------------------------------------------------------
+
+JulianDate& JulianDate::operator+=(f64 seconds)
+{
+    m_seconds += seconds;
+    if (m_seconds < 0.0 || m_seconds >= kSecondsPerDay)
+    {
+        normalize();
+    }
+    return *this;
+}
+
+JulianDate& JulianDate::operator-=(f64 seconds)
+{
+    return *this += -seconds;
+}
+
+void JulianDate::normalize()
+{
+    const f64 days = std::floor(m_seconds / kSecondsPerDay);
+    m_day += static_cast<i64>(days);
+    m_seconds -= days * kSecondsPerDay;
+
+    // Rounding in the division can leave the counter a hair outside [0, 86400)
+    if (m_seconds >= kSecondsPerDay)
+    {
+        m_seconds -= kSecondsPerDay;
+        ++m_day;
+    }
+    else if (m_seconds < 0.0)
+    {
+        m_seconds += kSecondsPerDay;
+        --m_day;
+        if (m_seconds >= kSecondsPerDay)
+        {
+            m_seconds = 0.0;    // −tiny + 86400 rounded up to 86400
+            ++m_day;
+        }
+    }
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+i64 JulianDate::get_day() const
+{
+    return m_day;
+}
+
+f64 JulianDate::get_seconds() const
+{
+    return m_seconds;
+}
+
+f64 JulianDate::get_day_fraction() const
+{
+    return m_seconds / kSecondsPerDay;
+}
+
+f64 JulianDate::get_jd() const
+{
+    return static_cast<f64>(m_day) + m_seconds / kSecondsPerDay;
+}
+
+f64 JulianDate::days_since_j2000() const
+{
+    return static_cast<f64>(m_day - kJ2000Day) + m_seconds / kSecondsPerDay;
+}
+
+} // namespace parallax::astro
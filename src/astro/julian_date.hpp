@@ -0,0 +1,77 @@
+#pragma once
+
+/// @file julian_date.hpp
+/// @brief Julian Date split into a whole day and seconds, so time can be
+/// advanced by small steps for ever without drifting.
+
+#include "core/types.hpp"
+
+#include <compare>
+
+namespace parallax::astro
+{
+    /// @brief A Julian Date as integer day number + seconds since that day began (noon).
+    ///
+    /// A plain f64 JD near 2.46e6 has a resolution of 40 µs, and adding a
+    /// 16 ms frame step (dt / 86400) rounds away up to 20 µs every frame, in
+    /// a direction that depends on dt. Here the step lands on a seconds
+    /// counter below 86400, which resolves 15 ps; steps that are exact in
+    /// binary (integers, 1/64 s) accumulate exactly, and the day number
+    /// carries instead of the counter growing.
+    ///
+    /// Always normalized: 0 ≤ seconds < 86400, so the defaulted comparisons
+    /// order instants correctly.
+    class JulianDate
+    {
+    public:
+        static constexpr f64 kSecondsPerDay = 86400.0;
+
+        constexpr JulianDate() = default;
+
+        /// @brief From a whole JD day number and seconds past its start (any sign or size).
+        JulianDate(i64 day, f64 seconds);
+
+        /// @brief From a plain JD (keeps that value's 40 µs resolution).
+        explicit JulianDate(f64 jd);
+
+        /// @brief From a two-part JD (SOFA style: jd1 + jd2, any split).
+        [[nodiscard]] static JulianDate from_parts(f64 jd1, f64 jd2);
+
+        JulianDate& operator+=(f64 seconds);
+        JulianDate& operator-=(f64 seconds);
+
+        [[nodiscard]] friend JulianDate operator+(JulianDate date, f64 seconds) { return date += seconds; }
+        [[nodiscard]] friend JulianDate operator-(JulianDate date, f64 seconds) { return date -= seconds; }
+
+        /// @brief Seconds from b to a.
+        [[nodiscard]] friend f64 operator-(const JulianDate& a, const JulianDate& b)
+        {
+            return static_cast<f64>(a.m_day - b.m_day) * kSecondsPerDay + (a.m_seconds - b.m_seconds);
+        }
+
+        friend auto operator<=>(const JulianDate&, const JulianDate&) = default;
+        friend bool operator==(const JulianDate&, const JulianDate&) = default;
+
+        /// @brief Whole day number (the JD rounded down).
+        [[nodiscard]] i64 get_day() const;
+
+        /// @brief Seconds since the day began, in [0, 86400).
+        [[nodiscard]] f64 get_seconds() const;
+
+        /// @brief Fraction of the day, in [0, 1).
+        [[nodiscard]] f64 get_day_fraction() const;
+
+        /// @brief As a plain JD (rounded to ~40 µs; fine for slowly varying terms).
+        [[nodiscard]] f64 get_jd() const;
+
+        /// @brief Days since J2000.0 (JD 2451545.0), without the rounding of get_jd().
+        [[nodiscard]] f64 days_since_j2000() const;
+
+    private:
+        void normalize();
+
+        i64 m_day = 0;
+        f64 m_seconds = 0.0;
+    };
+
+} // namespace parallax::astro
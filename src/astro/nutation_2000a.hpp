@@ -0,0 +1,43 @@
+#pragma once
+
+/// @file nutation_2000a.hpp
+/// @brief IAU 2000A nutation series (MHB2000): luni-solar and planetary terms.
+
+#include "core/types.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace parallax::astro
+{
+    /// @brief Luni-solar term: multipliers of the Delaunay arguments l, l', F,
+    /// D, Ω, then longitude (sin, sin·t, cos) and obliquity (cos, cos·t, sin)
+    /// coefficients in 0.1 µas.
+    struct LuniSolarNutationTerm
+    {
+        i32 nl, nlp, nf, nd, nom;
+        f64 ps, pst, pc;
+        f64 ec, ect, es;
+    };
+
+    /// @brief Planetary term: multipliers of l, F, D, Ω, the mean longitudes
+    /// of Mercury to Neptune and the general precession p_A, then longitude
+    /// (sin, cos) and obliquity (sin, cos) coefficients in 0.1 µas.
+    struct PlanetaryNutationTerm
+    {
+        i32 nl, nf, nd, nom;
+        i32 nme, nve, nea, nma, nju, nsa, nur, nne, npa;
+        f64 ps, pc;
+        f64 es, ec;
+    };
+
+    inline constexpr std::size_t kLuniSolarNutationTermCount = 678;
+    inline constexpr std::size_t kPlanetaryNutationTermCount = 687;
+
+    /// @brief Luni-solar series, in SOFA iauNut00a order (roughly largest first).
+    extern const std::array<LuniSolarNutationTerm, kLuniSolarNutationTermCount> kLuniSolarNutation2000A;
+
+    /// @brief Planetary series, in SOFA iauNut00a order (roughly largest first).
+    extern const std::array<PlanetaryNutationTerm, kPlanetaryNutationTermCount> kPlanetaryNutation2000A;
+
+} // namespace parallax::astro
@@ -0,0 +1,350 @@
+/// @file precession.cpp
+/// @brief IAU 2006 precession, IAU 2000A nutation, Earth rotation; cached per-frame matrices.
+///
+/// Formulas and coefficients follow the IAU SOFA library (the function each
+/// step reproduces is named alongside it).
+
+#include "astro/precession.hpp"
+#include "astro/nutation_2000a.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+
+using parallax::f64;
+using parallax::Mat3d;
+using parallax::Vec3d;
+
+constexpr f64 kJ2000 = 2451545.0;
+constexpr f64 kDaysPerCentury = 36525.0;
+constexpr f64 kTwoPi = parallax::astro_constants::kTwoPi;
+constexpr f64 kArcsecToRad = parallax::astro_constants::kPi / (180.0 * 3600.0);
+constexpr f64 kArcsecPerTurn = 1296000.0;
+
+/// Nutation coefficients are in units of 0.1 µas
+constexpr f64 kCoeffToRad = kArcsecToRad / 1.0e7;
+
+f64 centuries_since_j2000(f64 jd)
+{
+    return (jd - kJ2000) / kDaysPerCentury;
+}
+
+f64 normalize_radians(f64 angle)
+{
+    const f64 wrapped = std::fmod(angle, kTwoPi);
+    return wrapped < 0.0 ? wrapped + kTwoPi : wrapped;
+}
+
+// -----------------------------------------------------------------
+// Rotations of the coordinate axes (SOFA iauRx / iauRz): a vector's
+// components in the new frame are R × v. Written as rows; glm matrices
+// are column-major
+// -----------------------------------------------------------------
+
+Mat3d rotate_x(f64 angle)
+{
+    const f64 s = std::sin(angle);
+    const f64 c = std::cos(angle);
+    return glm::transpose(Mat3d{
+        Vec3d{1.0, 0.0, 0.0},
+        Vec3d{0.0,   c,   s},
+        Vec3d{0.0,  -s,   c},
+    });
+}
+
+Mat3d rotate_z(f64 angle)
+{
+    const f64 s = std::sin(angle);
+    const f64 c = std::cos(angle);
+    return glm::transpose(Mat3d{
+        Vec3d{  c,   s, 0.0},
+        Vec3d{ -s,   c, 0.0},
+        Vec3d{0.0, 0.0, 1.0},
+    });
+}
+
+/// Largest coefficient of a term, in µas
+template <typename Term>
+f64 term_amplitude_uas(const Term& term)
+{
+    const f64 largest = std::max({std::abs(term.ps), std::abs(term.pc), std::abs(term.ec), std::abs(term.es)});
+    return largest * 0.1;
+}
+
+/// Fundamental argument in arcseconds (polynomial) → radians in [0, 2π)
+f64 fundamental_argument(f64 arcsec)
+{
+    return std::fmod(arcsec, kArcsecPerTurn) * kArcsecToRad;
+}
+
+/// Delaunay arguments l, l', F, D, Ω (Simon et al. 1994, as in IERS 2003)
+struct DelaunayArguments
+{
+    f64 el, elp, f, d, om;
+};
+
+DelaunayArguments delaunay_arguments(f64 t)
+{
+    return DelaunayArguments{
+        .el  = fundamental_argument(485868.249036
+            + t * (1717915923.2178 + t * (31.8792 + t * (0.051635 + t * (-0.00024470))))),
+        .elp = fundamental_argument(1287104.79305
+            + t * (129596581.0481 + t * (-0.5532 + t * (0.000136 + t * (-0.00001149))))),
+        .f   = fundamental_argument(335779.526232
+            + t * (1739527262.8478 + t * (-12.7512 + t * (-0.001037 + t * (0.00000417))))),
+        .d   = fundamental_argument(1072260.70369
+            + t * (1602961601.2090 + t * (-6.3706 + t * (0.006593 + t * (-0.00003169))))),
+        .om  = fundamental_argument(450160.398036
+            + t * (-6962890.5431 + t * (7.4722 + t * (0.007702 + t * (-0.00005939))))),
+    };
+}
+
+} // anonymous namespace
+
+namespace parallax::astro
+{
+
+// -----------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------
+
+Precession::Precession(const PrecessionConfig& config)
+    : m_config{config}
+{
+}
+
+// -----------------------------------------------------------------
+// Per-frame update: N×P×B only when TT leaves the window, Earth
+// rotation every time
+// -----------------------------------------------------------------
+
+const Mat3d& Precession::update(f64 jd_ut1, f64 jd_tt)
+{
+    return update(JulianDate(jd_ut1), JulianDate(jd_tt));
+}
+
+const Mat3d& Precession::update(const JulianDate& ut1, const JulianDate& tt)
+{
+    const f64 jd_tt = tt.get_jd();
+    if (!m_valid || std::abs(jd_tt - m_cached_tt) > m_config.tolerance_days)
+    {
+        rebuild(jd_tt);
+    }
+
+    m_gast = normalize_radians(gmst(ut1, jd_tt) + m_equation_of_equinoxes);
+    m_celestial_to_terrestrial = rotate_z(m_gast) * m_npb;
+    return m_celestial_to_terrestrial;
+}
+
+void Precession::rebuild(f64 jd_tt)
+{
+    // One series evaluation serves both the matrix and the equation of the equinoxes
+    const Nutation nut = nutation(jd_tt, m_config.nutation_threshold_uas);
+    m_npb = bias_precession_nutation_matrix(jd_tt, nut);
+    m_equation_of_equinoxes = equation_of_equinoxes(jd_tt, nut, mean_obliquity(jd_tt));
+    m_cached_tt = jd_tt;
+    m_valid = true;
+    ++m_rebuild_count;
+}
+
+Mat3d Precession::get_celestial_to_horizontal(const ObserverLocation& observer) const
+{
+    // GAST is already in the terrestrial matrix: only longitude remains
+    return Coordinates::equatorial_to_horizontal_matrix(observer, observer.longitude_rad)
+         * m_celestial_to_terrestrial;
+}
+
+const Mat3d& Precession::get_celestial_to_terrestrial() const
+{
+    return m_celestial_to_terrestrial;
+}
+
+const Mat3d& Precession::get_bias_precession_nutation() const
+{
+    return m_npb;
+}
+
+f64 Precession::get_gast() const
+{
+    return m_gast;
+}
+
+u64 Precession::get_rebuild_count() const
+{
+    return m_rebuild_count;
+}
+
+// -----------------------------------------------------------------
+// Precession (iauPfw06, iauObl06)
+// -----------------------------------------------------------------
+
+PrecessionAngles Precession::precession_angles(f64 jd_tt)
+{
+    const f64 t = centuries_since_j2000(jd_tt);
+
+    const f64 gamma_bar = (-0.052928
+        + (10.556378 + (0.4932044 + (-0.00031238 + (-0.000002788 + 0.0000000260 * t) * t) * t) * t) * t);
+    const f64 phi_bar = (84381.412819
+        + (-46.811016 + (0.0511268 + (0.00053289 + (-0.000000440 - 0.0000000176 * t) * t) * t) * t) * t);
+    const f64 psi_bar = (-0.041775
+        + (5038.481484 + (1.5584175 + (-0.00018522 + (-0.000026452 - 0.0000000148 * t) * t) * t) * t) * t);
+
+    return PrecessionAngles{
+        .gamma_bar = gamma_bar * kArcsecToRad,
+        .phi_bar = phi_bar * kArcsecToRad,
+        .psi_bar = psi_bar * kArcsecToRad,
+        .epsilon_a = mean_obliquity(jd_tt),
+    };
+}
+
+f64 Precession::mean_obliquity(f64 jd_tt)
+{
+    const f64 t = centuries_since_j2000(jd_tt);
+    return (84381.406
+        + (-46.836769 + (-0.0001831 + (0.00200340 + (-0.000000576 - 0.0000000434 * t) * t) * t) * t) * t)
+        * kArcsecToRad;
+}
+
+// -----------------------------------------------------------------
+// Nutation (iauNut00a)
+// -----------------------------------------------------------------
+
+Nutation Precession::nutation(f64 jd_tt, f64 threshold_uas)
+{
+    const f64 t = centuries_since_j2000(jd_tt);
+    const DelaunayArguments args = delaunay_arguments(t);
+
+    // Luni-solar series, smallest terms first as SOFA sums them
+    f64 dp = 0.0;
+    f64 de = 0.0;
+    for (auto it = kLuniSolarNutation2000A.rbegin(); it != kLuniSolarNutation2000A.rend(); ++it)
+    {
+        const LuniSolarNutationTerm& term = *it;
+        if (threshold_uas > 0.0 && term_amplitude_uas(term) < threshold_uas)
+        {
+            continue;
+        }
+
+        const f64 arg = std::fmod(term.nl * args.el + term.nlp * args.elp + term.nf * args.f
+                                  + term.nd * args.d + term.nom * args.om, kTwoPi);
+        const f64 sarg = std::sin(arg);
+        const f64 carg = std::cos(arg);
+
+        dp += (term.ps + term.pst * t) * sarg + term.pc * carg;
+        de += (term.ec + term.ect * t) * carg + term.es * sarg;
+    }
+
+    // Planetary arguments: MHB2000's linear l, F, D, Ω and Neptune,
+    // IERS 2003 for the other planets and general precession (iauFa*03)
+    const f64 al   = std::fmod(2.35555598 + 8328.6914269554 * t, kTwoPi);
+    const f64 af   = std::fmod(1.627905234 + 8433.466158131 * t, kTwoPi);
+    const f64 ad   = std::fmod(5.198466741 + 7771.3771468121 * t, kTwoPi);
+    const f64 aom  = std::fmod(2.18243920 - 33.757045 * t, kTwoPi);
+    const f64 alme = std::fmod(4.402608842 + 2608.7903141574 * t, kTwoPi);
+    const f64 alve = std::fmod(3.176146697 + 1021.3285546211 * t, kTwoPi);
+    const f64 alea = std::fmod(1.753470314 + 628.3075849991 * t, kTwoPi);
+    const f64 alma = std::fmod(6.203480913 + 334.0612426700 * t, kTwoPi);
+    const f64 alju = std::fmod(0.599546497 + 52.9690962641 * t, kTwoPi);
+    const f64 alsa = std::fmod(0.874016757 + 21.3299104960 * t, kTwoPi);
+    const f64 alur = std::fmod(5.481293872 + 7.4781598567 * t, kTwoPi);
+    const f64 alne = std::fmod(5.321159000 + 3.8127774000 * t, kTwoPi);
+    const f64 apa  = (0.024381750 + 0.00000538691 * t) * t;
+
+    f64 dp_planetary = 0.0;
+    f64 de_planetary = 0.0;
+    for (auto it = kPlanetaryNutation2000A.rbegin(); it != kPlanetaryNutation2000A.rend(); ++it)
+    {
+        const PlanetaryNutationTerm& term = *it;
+        if (threshold_uas > 0.0 && term_amplitude_uas(term) < threshold_uas)
+        {
+            continue;
+        }
+
+        const f64 arg = std::fmod(term.nl * al + term.nf * af + term.nd * ad + term.nom * aom
+                                  + term.nme * alme + term.nve * alve + term.nea * alea + term.nma * alma
+                                  + term.nju * alju + term.nsa * alsa + term.nur * alur + term.nne * alne
+                                  + term.npa * apa, kTwoPi);
+        const f64 sarg = std::sin(arg);
+        const f64 carg = std::cos(arg);
+
+        dp_planetary += term.ps * sarg + term.pc * carg;
+        de_planetary += term.es * sarg + term.ec * carg;
+    }
+
+    return Nutation{
+        .dpsi = dp * kCoeffToRad + dp_planetary * kCoeffToRad,
+        .deps = de * kCoeffToRad + de_planetary * kCoeffToRad,
+    };
+}
+
+// -----------------------------------------------------------------
+// Bias-precession-nutation matrix (iauPnm06a, iauFw2m)
+// -----------------------------------------------------------------
+
+Mat3d Precession::bias_precession_nutation_matrix(f64 jd_tt, f64 threshold_uas)
+{
+    return bias_precession_nutation_matrix(jd_tt, nutation(jd_tt, threshold_uas));
+}
+
+Mat3d Precession::bias_precession_nutation_matrix(f64 jd_tt, const Nutation& nutation)
+{
+    const PrecessionAngles angles = precession_angles(jd_tt);
+    Nutation nut = nutation;
+
+    // IAU 2006 adjustments to IAU 2000 nutation (J2 secular rate, iauNut06a)
+    const f64 t = centuries_since_j2000(jd_tt);
+    const f64 fj2 = -2.7774e-6 * t;
+    nut.dpsi += nut.dpsi * (0.4697e-6 + fj2);
+    nut.deps += nut.deps * fj2;
+
+    // Fukushima-Williams angles with nutation added → true equator and equinox
+    return rotate_x(-(angles.epsilon_a + nut.deps))
+         * rotate_z(-(angles.psi_bar + nut.dpsi))
+         * rotate_x(angles.phi_bar)
+         * rotate_z(angles.gamma_bar);
+}
+
+// -----------------------------------------------------------------
+// Earth rotation (iauEra00, iauGmst06, iauEe06a)
+// -----------------------------------------------------------------
+
+f64 Precession::earth_rotation_angle(f64 jd_ut1)
+{
+    return earth_rotation_angle(JulianDate(jd_ut1));
+}
+
+f64 Precession::earth_rotation_angle(const JulianDate& ut1)
+{
+    // The whole-turn part of 1.00273781191135448 × days is dropped exactly
+    // by keeping only the day fraction
+    const f64 days = ut1.days_since_j2000();
+    const f64 day_fraction = ut1.get_day_fraction();
+    return normalize_radians(kTwoPi * (day_fraction + 0.7790572732640 + 0.00273781191135448 * days));
+}
+
+f64 Precession::gmst(f64 jd_ut1, f64 jd_tt)
+{
+    return gmst(JulianDate(jd_ut1), jd_tt);
+}
+
+f64 Precession::gmst(const JulianDate& ut1, f64 jd_tt)
+{
+    const f64 t = centuries_since_j2000(jd_tt);
+    const f64 polynomial = (0.014506
+        + (4612.156534 + (1.3915817 + (-0.00000044 + (-0.000029956 - 0.0000000368 * t) * t) * t) * t) * t);
+    return normalize_radians(earth_rotation_angle(ut1) + polynomial * kArcsecToRad);
+}
+
+f64 Precession::equation_of_equinoxes(f64 jd_tt, const Nutation& nutation, f64 epsilon_a)
+{
+    const f64 om = delaunay_arguments(centuries_since_j2000(jd_tt)).om;
+
+    // Complementary terms: the two largest of iauEect00 (the rest sum to < 30 µas)
+    const f64 complementary = (2640.96e-6 * std::sin(om) + 63.52e-6 * std::sin(2.0 * om)) * kArcsecToRad;
+    return nutation.dpsi * std::cos(epsilon_a) + complementary;
+}
+
+} // namespace parallax::astro
@@ -0,0 +1,136 @@
+#pragma once
+
+/// @file precession.hpp
+/// @brief IAU 2006 precession + IAU 2000A nutation: J2000 (GCRS) → true equator and equinox of date,
+/// and the Earth-rotation step to the terrestrial frame, cached per frame.
+
+#include "astro/coordinates.hpp"
+#include "astro/julian_date.hpp"
+#include "core/types.hpp"
+
+namespace parallax::astro
+{
+    /// @brief Fukushima-Williams precession angles, frame bias included (radians).
+    struct PrecessionAngles
+    {
+        f64 gamma_bar;      ///< γ̄: GCRS pole → ecliptic pole of date, along the GCRS equator
+        f64 phi_bar;        ///< φ̄: obliquity of the ecliptic of date on the GCRS equator
+        f64 psi_bar;        ///< ψ̄: precession in longitude along the ecliptic of date
+        f64 epsilon_a;      ///< ε_A: mean obliquity of date
+    };
+
+    /// @brief Nutation in longitude and obliquity (radians).
+    struct Nutation
+    {
+        f64 dpsi;
+        f64 deps;
+    };
+
+    /// @brief How the cached matrix trades accuracy for speed.
+    struct PrecessionConfig
+    {
+        /// Nutation terms whose largest coefficient is below this (µas) are
+        /// skipped. 0 keeps all 1365 IAU 2000A terms (678 luni-solar, 687
+        /// planetary). Worst error over 2000–2050: 1 keeps 776 (≤ 0.04 mas),
+        /// 100 keeps 98 (≤ 2 mas), 1e3 keeps 36 and no planetary terms
+        /// (≤ 10 mas), 1e4 keeps 13 (≤ 50 mas), 1e6 keeps only the 18.6-year
+        /// and semi-annual terms (≤ 0.71″).
+        f64 nutation_threshold_uas = 0.0;
+
+        /// The bias-precession-nutation matrix is rebuilt once TT has moved
+        /// this far (days). It drifts up to ~0.11″/day, so the default
+        /// (10 min) stays below 1 mas.
+        f64 tolerance_days = 10.0 / 1440.0;
+    };
+
+    /// @brief Celestial → terrestrial rotation, rebuilt only when time moves enough.
+    ///
+    /// Equinox-based IAU 2006/2000A chain (as SOFA's pnm06a + gst06a):
+    ///
+    ///     terrestrial = R3(GAST) × N × P × B × GCRS
+    ///
+    /// The slowly varying N × P × B product is cached and only recomputed
+    /// when TT leaves the tolerance window; Earth rotation (GAST) changes
+    /// 15″ per second, so it is applied fresh on every update(), but that is
+    /// one angle and one rotation about z. Per star the cost stays one 3×3
+    /// multiply (get_celestial_to_horizontal()).
+    ///
+    /// Polar motion is ignored (< 0.5″).
+    class Precession
+    {
+    public:
+        explicit Precession(const PrecessionConfig& config = {});
+
+        /// @brief Bring the matrices to this instant.
+        /// @param jd_ut1 Julian Date in UT1 (Earth rotation).
+        /// @param jd_tt Julian Date in TT (precession and nutation).
+        /// @return GCRS → terrestrial (Greenwich meridian) rotation.
+        const Mat3d& update(f64 jd_ut1, f64 jd_tt);
+
+        /// @brief As update(f64, f64), with Earth rotation at the split date's
+        /// full resolution (a plain JD quantizes it to ~0.6″).
+        const Mat3d& update(const JulianDate& ut1, const JulianDate& tt);
+
+        /// @brief GCRS → local horizontal frame (x = north, y = east, z = zenith)
+        /// for the last update(); drop-in for Coordinates::equatorial_to_horizontal_matrix.
+        [[nodiscard]] Mat3d get_celestial_to_horizontal(const ObserverLocation& observer) const;
+
+        /// @brief GCRS → terrestrial rotation from the last update().
+        [[nodiscard]] const Mat3d& get_celestial_to_terrestrial() const;
+
+        /// @brief Cached bias-precession-nutation matrix (GCRS → true of date).
+        [[nodiscard]] const Mat3d& get_bias_precession_nutation() const;
+
+        /// @brief Greenwich apparent sidereal time from the last update() (radians).
+        [[nodiscard]] f64 get_gast() const;
+
+        /// @brief Times the bias-precession-nutation matrix has been rebuilt.
+        [[nodiscard]] u64 get_rebuild_count() const;
+
+        // -----------------------------------------------------------------
+        // Model (stateless; SOFA function named in each comment)
+        // -----------------------------------------------------------------
+
+        /// @brief Fukushima-Williams angles, IAU 2006 (iauPfw06).
+        [[nodiscard]] static PrecessionAngles precession_angles(f64 jd_tt);
+
+        /// @brief Mean obliquity of the ecliptic, IAU 2006 (iauObl06).
+        [[nodiscard]] static f64 mean_obliquity(f64 jd_tt);
+
+        /// @brief IAU 2000A nutation (iauNut00a), terms below threshold_uas skipped.
+        [[nodiscard]] static Nutation nutation(f64 jd_tt, f64 threshold_uas = 0.0);
+
+        /// @brief GCRS → true equator and equinox of date (iauPnm06a).
+        [[nodiscard]] static Mat3d bias_precession_nutation_matrix(f64 jd_tt, f64 threshold_uas = 0.0);
+
+        /// @brief As above, with IAU 2000A nutation already evaluated for jd_tt.
+        [[nodiscard]] static Mat3d bias_precession_nutation_matrix(f64 jd_tt, const Nutation& nutation);
+
+        /// @brief Earth rotation angle, IAU 2000 (iauEra00), radians in [0, 2π).
+        [[nodiscard]] static f64 earth_rotation_angle(f64 jd_ut1);
+        [[nodiscard]] static f64 earth_rotation_angle(const JulianDate& ut1);
+
+        /// @brief Greenwich mean sidereal time, IAU 2006 (iauGmst06), radians in [0, 2π).
+        [[nodiscard]] static f64 gmst(f64 jd_ut1, f64 jd_tt);
+        [[nodiscard]] static f64 gmst(const JulianDate& ut1, f64 jd_tt);
+
+        /// @brief Equation of the equinoxes: Δψ cos ε_A plus the two largest
+        /// complementary terms (iauEe06a to ~30 µas).
+        [[nodiscard]] static f64 equation_of_equinoxes(f64 jd_tt, const Nutation& nutation, f64 epsilon_a);
+
+    private:
+        void rebuild(f64 jd_tt);
+
+        PrecessionConfig m_config;
+
+        f64 m_cached_tt = 0.0;              ///< TT the cached matrix was built for
+        bool m_valid = false;
+        Mat3d m_npb{1.0};                   ///< Bias-precession-nutation (GCRS → true of date)
+        f64 m_equation_of_equinoxes = 0.0;  ///< Cached with m_npb
+
+        f64 m_gast = 0.0;
+        Mat3d m_celestial_to_terrestrial{1.0};
+        u64 m_rebuild_count = 0;
+    };
+
+} // namespace parallax::astro
@@ -0,0 +1,539 @@
+/// @file time_scales.cpp
+/// @brief Leap-second table, ΔT model, IERS finals parsing and the per-frame offset cache.
+
+#include "astro/time_scales.hpp"
+
+#include "core/logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace
+{
+
+using namespace parallax;
+using astro::JulianDate;
+
+// -----------------------------------------------------------------
+// Leap seconds: UTC date (MJD) from which TAI − UTC applies
+// (IERS Bulletin C; 1972-01-01 is the start of the integer-second UTC)
+// -----------------------------------------------------------------
+struct LeapSecond
+{
+    i64 mjd;
+    f64 tai_minus_utc;
+};
+
+constexpr std::array<LeapSecond, 28> kLeapSeconds = {{
+    {41317, 10.0},  // 1972-01-01
+    {41499, 11.0},  // 1972-07-01
+    {41683, 12.0},  // 1973-01-01
+    {42048, 13.0},  // 1974-01-01
+    {42413, 14.0},  // 1975-01-01
+    {42778, 15.0},  // 1976-01-01
+    {43144, 16.0},  // 1977-01-01
+    {43509, 17.0},  // 1978-01-01
+    {43874, 18.0},  // 1979-01-01
+    {44239, 19.0},  // 1980-01-01
+    {44786, 20.0},  // 1981-07-01
+    {45151, 21.0},  // 1982-07-01
+    {45516, 22.0},  // 1983-07-01
+    {46247, 23.0},  // 1985-07-01
+    {47161, 24.0},  // 1988-01-01
+    {47892, 25.0},  // 1990-01-01
+    {48257, 26.0},  // 1991-01-01
+    {48804, 27.0},  // 1992-07-01
+    {49169, 28.0},  // 1993-07-01
+    {49534, 29.0},  // 1994-07-01
+    {50083, 30.0},  // 1996-01-01
+    {50630, 31.0},  // 1997-07-01
+    {51179, 32.0},  // 1999-01-01
+    {53736, 33.0},  // 2006-01-01
+    {54832, 34.0},  // 2009-01-01
+    {56109, 35.0},  // 2012-07-01
+    {57204, 36.0},  // 2015-07-01
+    {57754, 37.0},  // 2017-01-01
+}};
+
+constexpr i64 kFirstLeapMjd = kLeapSeconds.front().mjd;
+
+/// JD day number of MJD 0's noon: MJD = JD − 2400000.5
+constexpr i64 kMjdDayOffset = 2400000;
+
+/// MJD of the UTC day containing utc (days start at midnight, JDs at noon)
+i64 civil_mjd(const JulianDate& utc)
+{
+    return utc.get_day() - kMjdDayOffset - 1 + (utc.get_seconds() >= 43200.0 ? 1 : 0);
+}
+
+/// 0h UTC of an MJD
+JulianDate midnight(i64 mjd)
+{
+    return JulianDate(mjd + kMjdDayOffset, 43200.0);
+}
+
+f64 tai_minus_utc_on(i64 mjd)
+{
+    const auto it = std::upper_bound(kLeapSeconds.begin(), kLeapSeconds.end(), mjd,
+                                     [](i64 value, const LeapSecond& leap) { return value < leap.mjd; });
+    return it == kLeapSeconds.begin() ? kLeapSeconds.front().tai_minus_utc : std::prev(it)->tai_minus_utc;
+}
+
+f64 decimal_year(const JulianDate& date)
+{
+    // J2000.0 is 2000-01-01 12h, i.e. 2000.0 + half a day
+    return 2000.0 + (date.days_since_j2000() + 0.5) / 365.2425;
+}
+
+f64 scale_minus_utc(const astro::TimeScaleOffsets& offsets, astro::TimeScale scale)
+{
+    switch (scale)
+    {
+        case astro::TimeScale::Utc: return 0.0;
+        case astro::TimeScale::Tai: return offsets.tai_minus_utc;
+        case astro::TimeScale::Tt:  return offsets.tai_minus_utc + astro::TimeScales::kTtMinusTaiSec;
+        case astro::TimeScale::Ut1: return offsets.ut1_minus_utc;
+    }
+    return 0.0;
+}
+
+// -----------------------------------------------------------------
+// IERS finals (finals2000A.all etc.): fixed columns, 1-based
+//   8–15   MJD (F8.2)
+//   58     UT1 − UTC flag ('I' observed, 'P' predicted)
+//   59–68  UT1 − UTC in seconds (F10.7)
+// -----------------------------------------------------------------
+constexpr std::size_t kMjdColumn = 7;
+constexpr std::size_t kMjdWidth = 8;
+constexpr std::size_t kUt1Column = 58;
+constexpr std::size_t kUt1Width = 10;
+
+/// The field, trimmed; empty if blank or past the end of the line
+std::string_view get_field(std::string_view line, std::size_t column, std::size_t width)
+{
+    if (line.size() <= column)
+    {
+        return {};
+    }
+    std::string_view field = line.substr(column, width);
+    while (!field.empty() && field.front() == ' ')
+    {
+        field.remove_prefix(1);
+    }
+    while (!field.empty() && field.back() == ' ')
+    {
+        field.remove_suffix(1);
+    }
+    return field;
+}
+
+bool parse_f64(std::string_view field, f64& out)
+{
+    const auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), out);
+    return !field.empty() && ec == std::errc{} && ptr == field.data() + field.size();
+}
+
+} // anonymous namespace
+
+namespace parallax::astro
+{
+
+// -----------------------------------------------------------------
+// Construction and configuration
+// -----------------------------------------------------------------
+
+TimeScales::TimeScales()
+{
+    refresh_extrapolation();
+}
+
+bool TimeScales::load_iers_table(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        PLX_CORE_ERROR("IERS table not found: {}", path.string());
+        return false;
+    }
+
+    std::vector<IersEntry> entries;
+    std::string line;
+    u32 line_number = 0;
+    while (std::getline(file, line))
+    {
+        ++line_number;
+        f64 mjd = 0.0;
+        f64 ut1_minus_utc = 0.0;
+        if (!parse_f64(get_field(line, kMjdColumn, kMjdWidth), mjd))
+        {
+            PLX_CORE_ERROR("IERS table {}: no MJD on line {}", path.string(), line_number);
+            return false;
+        }
+
+        const std::string_view ut1_field = get_field(line, kUt1Column, kUt1Width);
+        if (ut1_field.empty())
+        {
+            // Rows past the predictions have no UT1 value: the table ends
+            if (!entries.empty())
+            {
+                break;
+            }
+            continue;
+        }
+        if (!parse_f64(ut1_field, ut1_minus_utc))
+        {
+            PLX_CORE_ERROR("IERS table {}: bad UT1 − UTC '{}' on line {}", path.string(), ut1_field, line_number);
+            return false;
+        }
+
+        const auto day = static_cast<i64>(mjd);
+        if (day < kFirstLeapMjd)
+        {
+            continue;
+        }
+        if (!entries.empty() && day != entries.back().mjd + 1)
+        {
+            PLX_CORE_ERROR("IERS table {}: MJD {} does not follow {} (line {})",
+                           path.string(), day, entries.back().mjd, line_number);
+            return false;
+        }
+        entries.push_back(IersEntry{
+            .mjd = day,
+            .ut1_minus_tai = ut1_minus_utc - tai_minus_utc_on(day),
+        });
+    }
+
+    if (entries.size() < 2)
+    {
+        PLX_CORE_ERROR("IERS table {}: fewer than two days with UT1 − UTC", path.string());
+        return false;
+    }
+
+    m_iers = std::move(entries);
+    refresh_extrapolation();
+    PLX_CORE_INFO("IERS table loaded: UT1 − UTC for MJD {}–{} from {}",
+                  m_iers.front().mjd, m_iers.back().mjd, path.string());
+    return true;
+}
+
+void TimeScales::clear_iers_table()
+{
+    m_iers.clear();
+    refresh_extrapolation();
+}
+
+bool TimeScales::has_iers_table() const
+{
+    return !m_iers.empty();
+}
+
+void TimeScales::set_dut1(f64 seconds)
+{
+    m_dut1 = seconds;
+    refresh_extrapolation();
+}
+
+void TimeScales::refresh_extrapolation()
+{
+    // ΔT's trend continues from the last day UT1 is known; the cached frame
+    // segment was built from the old tables
+    m_extrapolation_mjd = m_iers.empty() ? kLeapSecondsAssumedUntilMjd : m_iers.back().mjd;
+    const f64 tai_minus_utc = tai_minus_utc_on(m_extrapolation_mjd);
+    const f64 ut1_minus_utc = m_iers.empty() ? m_dut1 : m_iers.back().ut1_minus_tai + tai_minus_utc;
+
+    m_extrapolation_delta_t = tai_minus_utc + kTtMinusTaiSec - ut1_minus_utc;
+    m_extrapolation_model = delta_t_model(decimal_year(midnight(m_extrapolation_mjd)));
+    m_frame_segment = Segment{};
+}
+
+// -----------------------------------------------------------------
+// Segments: one UTC day with linear offsets
+// -----------------------------------------------------------------
+
+TimeScaleOffsets TimeScales::Segment::at(const JulianDate& utc) const
+{
+    const f64 dt = utc - begin;
+    return TimeScaleOffsets{
+        .tai_minus_utc = tai_minus_utc + tai_rate * dt,
+        .ut1_minus_utc = ut1_minus_utc + ut1_rate * dt,
+    };
+}
+
+f64 TimeScales::extrapolated_delta_t(const JulianDate& utc) const
+{
+    return m_extrapolation_delta_t + delta_t_model(decimal_year(utc)) - m_extrapolation_model;
+}
+
+TimeScales::Segment TimeScales::locate(const JulianDate& utc) const
+{
+    m_searches.fetch_add(1, std::memory_order_relaxed);
+
+    const i64 mjd = civil_mjd(utc);
+    Segment segment{
+        .begin = midnight(mjd),
+        .end = midnight(mjd + 1),
+    };
+
+    // Offsets at both ends of the day; the segment interpolates between them
+    f64 tai0 = 0.0;
+    f64 tai1 = 0.0;
+    f64 ut10 = 0.0;
+    f64 ut11 = 0.0;
+
+    if (mjd < kFirstLeapMjd)
+    {
+        // Before 1972: UTC followed UT1, so TT − UTC is ΔT itself
+        tai0 = delta_t_model(decimal_year(segment.begin)) - kTtMinusTaiSec;
+        tai1 = delta_t_model(decimal_year(segment.end)) - kTtMinusTaiSec;
+    }
+    else
+    {
+        tai0 = tai_minus_utc_on(mjd);
+        tai1 = tai0;    // Leap seconds only ever start at midnight
+
+        if (!m_iers.empty() && mjd >= m_iers.front().mjd && mjd < m_iers.back().mjd)
+        {
+            // Contiguous daily rows: direct index
+            const auto index = static_cast<std::size_t>(mjd - m_iers.front().mjd);
+            ut10 = m_iers[index].ut1_minus_tai + tai0;
+            ut11 = m_iers[index + 1].ut1_minus_tai + tai0;
+        }
+        else if (mjd < m_extrapolation_mjd)
+        {
+            ut10 = m_dut1;
+            ut11 = m_dut1;
+        }
+        else
+        {
+            ut10 = tai0 + kTtMinusTaiSec - extrapolated_delta_t(segment.begin);
+            ut11 = tai1 + kTtMinusTaiSec - extrapolated_delta_t(segment.end);
+        }
+    }
+
+    segment.tai_minus_utc = tai0;
+    segment.tai_rate = (tai1 - tai0) / JulianDate::kSecondsPerDay;
+    segment.ut1_minus_utc = ut10;
+    segment.ut1_rate = (ut11 - ut10) / JulianDate::kSecondsPerDay;
+    return segment;
+}
+
+TimeScaleOffsets TimeScales::offsets_at(const JulianDate& utc) const
+{
+    if (m_frame_segment.contains(utc))
+    {
+        return m_frame_segment.at(utc);
+    }
+    return locate(utc).at(utc);
+}
+
+// -----------------------------------------------------------------
+// Queries
+// -----------------------------------------------------------------
+
+TimeScaleOffsets TimeScales::get_offsets(const JulianDate& utc) const
+{
+    return offsets_at(utc);
+}
+
+f64 TimeScales::get_delta_t(const JulianDate& utc) const
+{
+    const TimeScaleOffsets offsets = offsets_at(utc);
+    return offsets.tai_minus_utc + kTtMinusTaiSec - offsets.ut1_minus_utc;
+}
+
+JulianDate TimeScales::convert(const JulianDate& time, TimeScale from, TimeScale to) const
+{
+    if (from == to)
+    {
+        return time;
+    }
+
+    // Offsets are tabulated against UTC: two fixed-point steps land on the
+    // right side of a leap second (offsets change by at most 1 s there)
+    JulianDate utc = time;
+    if (from != TimeScale::Utc)
+    {
+        utc = time - scale_minus_utc(offsets_at(time), from);
+        utc = time - scale_minus_utc(offsets_at(utc), from);
+    }
+    return utc + scale_minus_utc(offsets_at(utc), to);
+}
+
+void TimeScales::convert(std::span<const f64> jd, TimeScale from, TimeScale to, std::span<f64> out) const
+{
+    const std::size_t count = std::min(jd.size(), out.size());
+    std::size_t i = 0;
+    while (i < count)
+    {
+        // The day of jd[i], and its span expressed in the source scale
+        const JulianDate first = convert(JulianDate(jd[i]), from, TimeScale::Utc);
+        const Segment segment = m_frame_segment.contains(first) ? m_frame_segment : locate(first);
+
+        const TimeScaleOffsets at_begin = segment.at(segment.begin);
+        const TimeScaleOffsets at_end = segment.at(segment.end);
+        const f64 from_begin = scale_minus_utc(at_begin, from);
+        const f64 from_end = scale_minus_utc(at_end, from);
+        const f64 to_begin = scale_minus_utc(at_begin, to);
+        const f64 to_end = scale_minus_utc(at_end, to);
+
+        const f64 lo = (segment.begin + from_begin).get_jd();
+        const f64 hi = (segment.end + from_end).get_jd();
+
+        // Within the day source → target is affine: out = jd + a + b·(jd − lo)
+        // (offsets in days, linear in the source time)
+        const f64 span_days = hi - lo;
+        const f64 a = (to_begin - from_begin) / JulianDate::kSecondsPerDay;
+        const f64 b = span_days > 0.0
+            ? ((to_end - from_end) - (to_begin - from_begin)) / JulianDate::kSecondsPerDay / span_days
+            : 0.0;
+
+        std::size_t end = i + 1;
+        while (end < count && jd[end] >= lo && jd[end] < hi)
+        {
+            ++end;
+        }
+
+        // The first element may sit in a leap second's gap between days
+        if (jd[i] >= lo && jd[i] < hi)
+        {
+            for (std::size_t k = i; k < end; ++k)
+            {
+                out[k] = jd[k] + a + b * (jd[k] - lo);
+            }
+        }
+        else
+        {
+            out[i] = convert(JulianDate(jd[i]), from, to).get_jd();
+            end = i + 1;
+        }
+        i = end;
+    }
+}
+
+// -----------------------------------------------------------------
+// Per-frame cache
+// -----------------------------------------------------------------
+
+void TimeScales::update(const JulianDate& utc)
+{
+    if (!m_frame_segment.contains(utc))
+    {
+        m_frame_segment = locate(utc);
+    }
+
+    const TimeScaleOffsets offsets = m_frame_segment.at(utc);
+    m_frame = FrameTimes{
+        .utc = utc,
+        .tai = utc + offsets.tai_minus_utc,
+        .tt = utc + (offsets.tai_minus_utc + kTtMinusTaiSec),
+        .ut1 = utc + offsets.ut1_minus_utc,
+    };
+}
+
+const FrameTimes& TimeScales::get_frame() const
+{
+    return m_frame;
+}
+
+u64 TimeScales::get_search_count() const
+{
+    return m_searches.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------
+// ΔT — Espenak & Meeus, Five Millennium Canon of Solar Eclipses (2006)
+// -----------------------------------------------------------------
+
+f64 TimeScales::delta_t_model(f64 year)
+{
+    const auto long_term = [](f64 y) {
+        const f64 u = (y - 1820.0) / 100.0;
+        return -20.0 + 32.0 * u * u;
+    };
+
+    if (year < -500.0)
+    {
+        return long_term(year);
+    }
+    if (year < 500.0)
+    {
+        const f64 u = year / 100.0;
+        return 10583.6 + u * (-1014.41 + u * (33.78311 + u * (-5.952053
+             + u * (-0.1798452 + u * (0.022174192 + u * 0.0090316521)))));
+    }
+    if (year < 1600.0)
+    {
+        const f64 u = (year - 1000.0) / 100.0;
+        return 1574.2 + u * (-556.01 + u * (71.23472 + u * (0.319781
+             + u * (-0.8503463 + u * (-0.005050998 + u * 0.0083572073)))));
+    }
+    if (year < 1700.0)
+    {
+        const f64 t = year - 1600.0;
+        return 120.0 + t * (-0.9808 + t * (-0.01532 + t / 7129.0));
+    }
+    if (year < 1800.0)
+    {
+        const f64 t = year - 1700.0;
+        return 8.83 + t * (0.1603 + t * (-0.0059285 + t * (0.00013336 - t / 1174000.0)));
+    }
+    if (year < 1860.0)
+    {
+        const f64 t = year - 1800.0;
+        return 13.72 + t * (-0.332447 + t * (0.0068612 + t * (0.0041116 + t * (-0.00037436
+             + t * (0.0000121272 + t * (-0.0000001699 + t * 0.000000000875))))));
+    }
+    if (year < 1900.0)
+    {
+        const f64 t = year - 1860.0;
+        return 7.62 + t * (0.5737 + t * (-0.251754 + t * (0.01680668 + t * (-0.0004473624 + t / 233174.0))));
+    }
+    if (year < 1920.0)
+    {
+        const f64 t = year - 1900.0;
+        return -2.79 + t * (1.494119 + t * (-0.0598939 + t * (0.0061966 - t * 0.000197)));
+    }
+    if (year < 1941.0)
+    {
+        const f64 t = year - 1920.0;
+        return 21.20 + t * (0.84493 + t * (-0.076100 + t * 0.0020936));
+    }
+    if (year < 1961.0)
+    {
+        const f64 t = year - 1950.0;
+        return 29.07 + t * (0.407 + t * (-1.0 / 233.0 + t / 2547.0));
+    }
+    if (year < 1986.0)
+    {
+        const f64 t = year - 1975.0;
+        return 45.45 + t * (1.067 + t * (-1.0 / 260.0 - t / 718.0));
+    }
+    if (year < 2005.0)
+    {
+        const f64 t = year - 2000.0;
+        return 63.86 + t * (0.3345 + t * (-0.060374 + t * (0.0017275 + t * (0.000651814 + t * 0.00002373599))));
+    }
+    if (year < 2050.0)
+    {
+        const f64 t = year - 2000.0;
+        return 62.92 + t * (0.32217 + t * 0.005589);
+    }
+    if (year < 2150.0)
+    {
+        return long_term(year) - 0.5628 * (2150.0 - year);
+    }
+    return long_term(year);
+}
+
+f64 TimeScales::leap_seconds(const JulianDate& utc)
+{
+    return tai_minus_utc_on(civil_mjd(utc));
+}
+
+} // namespace parallax::astro
@@ -0,0 +1,174 @@
+#pragma once
+
+/// @file time_scales.hpp
+/// @brief UTC / TAI / TT / UT1 conversions: leap seconds, ΔT and DUT1, cached per frame.
+
+#include "astro/julian_date.hpp"
+#include "core/types.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace parallax::astro
+{
+    /// @brief Time scale of a JulianDate.
+    enum class TimeScale : u8
+    {
+        Utc,    ///< Civil time, with leap seconds since 1972
+        Tai,    ///< International Atomic Time
+        Tt,     ///< Terrestrial Time = TAI + 32.184 s (ephemerides, precession)
+        Ut1,    ///< Earth rotation angle (sidereal time)
+    };
+
+    /// @brief Offsets of TAI and UT1 from UTC at one instant, in seconds.
+    struct TimeScaleOffsets
+    {
+        f64 tai_minus_utc = 0.0;
+        f64 ut1_minus_utc = 0.0;    ///< DUT1
+    };
+
+    /// @brief One instant in every scale (see TimeScales::update).
+    struct FrameTimes
+    {
+        JulianDate utc;
+        JulianDate tai;
+        JulianDate tt;
+        JulianDate ut1;
+    };
+
+    /// @brief Conversions between UTC, TAI, TT and UT1.
+    ///
+    /// - TAI − UTC comes from the compiled-in leap-second table (1972-01-01
+    ///   onwards, no leap second announced after 2017-01-01).
+    /// - UT1 − UTC (DUT1) comes from an IERS finals table when one is
+    ///   loaded, else from set_dut1() (0 by default; |DUT1| < 0.9 s by
+    ///   definition of UTC).
+    /// - Without a table, UT1 = UTC + DUT1 up to kLeapSecondsAssumedUntilMjd,
+    ///   the horizon over which the leap-second table is taken as current.
+    /// - Before 1972, UTC is taken as UT1 and TT − UT1 is the Espenak–Meeus
+    ///   ΔT polynomial. After the last known date (end of the IERS table, or
+    ///   kLeapSecondsAssumedUntilMjd without one) ΔT follows the polynomial's
+    ///   trend from its last known value, so it stays continuous.
+    ///
+    /// Internally every UTC day is a segment over which both offsets are
+    /// linear (IERS values are interpolated as UT1 − TAI, which has no
+    /// leap-second steps). update() caches the frame's segment, so
+    /// conversions anywhere in that UTC day are a multiply-add; others
+    /// search the tables. Conversions may run on several threads, but not
+    /// concurrently with update(), load_iers_table() or set_dut1().
+    class TimeScales
+    {
+    public:
+        /// @brief TT − TAI in seconds (exact, by definition).
+        static constexpr f64 kTtMinusTaiSec = 32.184;
+
+        /// @brief UTC date (MJD) up to which the leap-second table is known
+        /// to be complete: 2026-01-01 (IERS Bulletin C 70).
+        static constexpr i64 kLeapSecondsKnownUntilMjd = 61041;
+
+        /// @brief UTC date (MJD) up to which no new leap second is assumed:
+        /// 2030-01-01. UT1 − UTC has drifted by under 0.2 s a year since the
+        /// 2017 leap second, so until then UTC + DUT1 is a far better UT1
+        /// than the ΔT polynomial; past it, ΔT takes over.
+        static constexpr i64 kLeapSecondsAssumedUntilMjd = 62502;
+
+        TimeScales();
+
+        /// @brief Load UT1 − UTC from an IERS finals file (finals2000A.all /
+        /// finals.all / finals2000A.daily, fixed columns).
+        ///
+        /// Rows from the first with a UT1 value up to the last are used,
+        /// observed ('I') and predicted ('P') alike.
+        /// @return False (logged; the previous table is kept) if the file is
+        /// missing, malformed or has gaps between days.
+        bool load_iers_table(const std::filesystem::path& path);
+
+        /// @brief Drop the IERS table, back to set_dut1() and the ΔT model.
+        void clear_iers_table();
+
+        [[nodiscard]] bool has_iers_table() const;
+
+        /// @brief DUT1 used (from 1972) on days the IERS table does not cover.
+        void set_dut1(f64 seconds);
+
+        /// @brief TAI − UTC and UT1 − UTC at a UTC instant.
+        [[nodiscard]] TimeScaleOffsets get_offsets(const JulianDate& utc) const;
+
+        /// @brief ΔT = TT − UT1 in seconds at a UTC instant.
+        [[nodiscard]] f64 get_delta_t(const JulianDate& utc) const;
+
+        /// @brief Convert an instant between scales.
+        ///
+        /// A TAI/TT instant inside a positive leap second (23:59:60 UTC)
+        /// maps to the first second of the next UTC day.
+        [[nodiscard]] JulianDate convert(const JulianDate& time, TimeScale from, TimeScale to) const;
+
+        /// @brief Convert an array of plain JDs between scales (time-series tools).
+        ///
+        /// Consecutive inputs in the same UTC day share one affine map,
+        /// applied in a branch-free loop the compiler vectorizes; sorted
+        /// input therefore costs one table search per day. Results keep the
+        /// plain JD's ~40 µs resolution. in and out may be the same span.
+        void convert(std::span<const f64> jd, TimeScale from, TimeScale to, std::span<f64> out) const;
+
+        /// @brief Resolve this frame's UTC time in every scale and cache its
+        /// day's offsets.
+        void update(const JulianDate& utc);
+
+        /// @brief The instant passed to the last update().
+        [[nodiscard]] const FrameTimes& get_frame() const;
+
+        /// @brief Table searches so far (conversions the frame cache did not cover).
+        [[nodiscard]] u64 get_search_count() const;
+
+        /// @brief Espenak–Meeus ΔT (TT − UT1) polynomial in seconds, -∞..∞
+        /// (NASA Five Millennium Canon of Solar Eclipses, 2006).
+        /// @param year Decimal year (e.g. 1972.5).
+        [[nodiscard]] static f64 delta_t_model(f64 year);
+
+        /// @brief TAI − UTC from the leap-second table (10 s before 1972).
+        [[nodiscard]] static f64 leap_seconds(const JulianDate& utc);
+
+    private:
+        /// UTC day [begin, end) with linear offsets (seconds, and per second)
+        struct Segment
+        {
+            JulianDate begin;
+            JulianDate end;
+            f64 tai_minus_utc = 0.0;
+            f64 tai_rate = 0.0;
+            f64 ut1_minus_utc = 0.0;
+            f64 ut1_rate = 0.0;
+
+            [[nodiscard]] bool contains(const JulianDate& utc) const { return begin <= utc && utc < end; }
+            [[nodiscard]] TimeScaleOffsets at(const JulianDate& utc) const;
+        };
+
+        /// One IERS row: UT1 − TAI at 0h UTC of a day
+        struct IersEntry
+        {
+            i64 mjd;
+            f64 ut1_minus_tai;
+        };
+
+        [[nodiscard]] Segment locate(const JulianDate& utc) const;
+        [[nodiscard]] TimeScaleOffsets offsets_at(const JulianDate& utc) const;
+        [[nodiscard]] f64 extrapolated_delta_t(const JulianDate& utc) const;
+        void refresh_extrapolation();
+
+        std::vector<IersEntry> m_iers;
+        f64 m_dut1 = 0.0;
+
+        // ΔT trend after the last known day
+        i64 m_extrapolation_mjd = kLeapSecondsAssumedUntilMjd;
+        f64 m_extrapolation_delta_t = 0.0;
+        f64 m_extrapolation_model = 0.0;
+
+        Segment m_frame_segment;
+        FrameTimes m_frame;
+        mutable std::atomic<u64> m_searches{0};
+    };
+
+} // namespace parallax::astro
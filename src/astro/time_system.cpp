@@ -16,6 +16,11 @@ namespace parallax::astro
 // -----------------------------------------------------------------
 
 f64 TimeSystem::to_julian_date(const DateTime& dt)
+{
+    return to_precise_julian_date(dt).get_jd();
+}
+
+JulianDate TimeSystem::to_precise_julian_date(const DateTime& dt)
 {
     i32 y = dt.year;
     i32 m = dt.month;
@@ -31,19 +36,19 @@ f64 TimeSystem::to_julian_date(const DateTime& dt)
     const i32 a = y / 100;
     const i32 b = 2 - a + (a / 4);
 
-    // Day fraction from hours, minutes, seconds
-    const f64 day_fraction = (static_cast<f64>(dt.hour)
-                            + static_cast<f64>(dt.minute) / 60.0
-                            + dt.second / 3600.0) / 24.0;
+    // JD of the civil day's midnight (always x.5)
+    const f64 midnight_jd = std::floor(365.25 * static_cast<f64>(y + 4716))
+                          + std::floor(30.6001 * static_cast<f64>(m + 1))
+                          + static_cast<f64>(dt.day)
+                          + static_cast<f64>(b)
+                          - 1524.5;
 
-    const f64 jd = std::floor(365.25 * static_cast<f64>(y + 4716))
-                 + std::floor(30.6001 * static_cast<f64>(m + 1))
-                 + static_cast<f64>(dt.day)
-                 + day_fraction
-                 + static_cast<f64>(b)
-                 - 1524.5;
+    // Julian days start at noon: midnight is 12 h into the previous one
+    const f64 seconds_of_day = static_cast<f64>(dt.hour) * 3600.0
+                             + static_cast<f64>(dt.minute) * 60.0
+                             + dt.second;
 
-    return jd;
+    return JulianDate(static_cast<i64>(std::floor(midnight_jd)), 43200.0 + seconds_of_day);
 }
 
 // -----------------------------------------------------------------
@@ -52,10 +57,21 @@ f64 TimeSystem::to_julian_date(const DateTime& dt)
 
 DateTime TimeSystem::from_julian_date(f64 jd)
 {
-    // Add 0.5 to shift from noon-based to midnight-based
-    const f64 jd_plus = jd + 0.5;
-    const i32 z = static_cast<i32>(std::floor(jd_plus));
-    const f64 f = jd_plus - static_cast<f64>(z);
+    return from_julian_date(JulianDate(jd));
+}
+
+DateTime TimeSystem::from_julian_date(const JulianDate& jd)
+{
+    // Shift from noon-based to midnight-based days; the time of day comes
+    // straight from the seconds counter
+    f64 seconds_of_day = jd.get_seconds() + 43200.0;
+    i64 civil_day = jd.get_day();
+    if (seconds_of_day >= JulianDate::kSecondsPerDay)
+    {
+        seconds_of_day -= JulianDate::kSecondsPerDay;
+        ++civil_day;
+    }
+    const auto z = static_cast<i32>(civil_day);
 
     i32 a = z;
     if (z >= 2299161)
@@ -73,13 +89,7 @@ DateTime TimeSystem::from_julian_date(f64 jd)
     const i32 e = static_cast<i32>(std::floor(
         static_cast<f64>(b - d) / 30.6001));
 
-    // Day (with fractional part)
-    const f64 day_with_fraction = static_cast<f64>(b - d)
-                                - std::floor(30.6001 * static_cast<f64>(e))
-                                + f;
-
-    const i32 day = static_cast<i32>(std::floor(day_with_fraction));
-    const f64 day_frac = day_with_fraction - static_cast<f64>(day);
+    const i32 day = b - d - static_cast<i32>(std::floor(30.6001 * static_cast<f64>(e)));
 
     // Month
     i32 month = (e < 14) ? (e - 1) : (e - 13);
@@ -87,14 +97,11 @@ DateTime TimeSystem::from_julian_date(f64 jd)
     // Year
     i32 year = (month > 2) ? (c - 4716) : (c - 4715);
 
-    // Time from day fraction
-    const f64 hours_total = day_frac * 24.0;
-    const i32 hour = static_cast<i32>(std::floor(hours_total));
-
-    const f64 minutes_total = (hours_total - static_cast<f64>(hour)) * 60.0;
-    const i32 minute = static_cast<i32>(std::floor(minutes_total));
-
-    const f64 second = (minutes_total - static_cast<f64>(minute)) * 60.0;
+    // Time of day
+    const i32 hour = static_cast<i32>(std::floor(seconds_of_day / 3600.0));
+    const f64 after_hour = seconds_of_day - static_cast<f64>(hour) * 3600.0;
+    const i32 minute = static_cast<i32>(std::floor(after_hour / 60.0));
+    const f64 second = after_hour - static_cast<f64>(minute) * 60.0;
 
     return DateTime{
         .year   = year,
@@ -129,12 +136,22 @@ f64 TimeSystem::julian_centuries(f64 jd)
 
 f64 TimeSystem::gmst(f64 jd)
 {
-    const f64 t = julian_centuries(jd);
-    const f64 d = jd - astro_constants::kJ2000;
+    return gmst(JulianDate(jd));
+}
+
+f64 TimeSystem::gmst(const JulianDate& jd)
+{
+    const f64 t = jd.days_since_j2000() / 36525.0;
+
+    // 360.98564736629 × d with the whole days' 360° turns dropped exactly:
+    // only 0.98564736629° per whole day and the full rate on the fraction remain
+    const auto whole_days = static_cast<f64>(jd.get_day() - static_cast<i64>(astro_constants::kJ2000));
+    const f64 fraction = jd.get_day_fraction();
 
     // GMST in degrees
     f64 gmst_deg = 280.46061837
-                 + 360.98564736629 * d
+                 + 0.98564736629 * whole_days
+                 + 360.98564736629 * fraction
                  + 0.000387933 * t * t
                  - (t * t * t) / 38710000.0;
 
@@ -153,6 +170,11 @@ f64 TimeSystem::gmst(f64 jd)
 // -----------------------------------------------------------------
 
 f64 TimeSystem::lmst(f64 jd, f64 longitude_rad)
+{
+    return lmst(JulianDate(jd), longitude_rad);
+}
+
+f64 TimeSystem::lmst(const JulianDate& jd, f64 longitude_rad)
 {
     return normalize_radians(gmst(jd) + longitude_rad);
 }
@@ -162,17 +184,25 @@ f64 TimeSystem::lmst(f64 jd, f64 longitude_rad)
 // -----------------------------------------------------------------
 
 f64 TimeSystem::now_as_jd()
+{
+    return now_as_julian_date().get_jd();
+}
+
+JulianDate TimeSystem::now_as_julian_date()
 {
     using namespace std::chrono;
 
-    const auto now = system_clock::now();
-    const auto since_epoch = now.time_since_epoch();
-    const auto total_seconds = duration_cast<duration<f64>>(since_epoch).count();
+    const auto since_epoch = system_clock::now().time_since_epoch();
+    const auto whole_seconds = duration_cast<seconds>(since_epoch);
+    const auto subsecond = duration_cast<duration<f64>>(since_epoch - whole_seconds).count();
 
-    // Unix epoch (1970-01-01 00:00 UTC) as Julian Date
-    constexpr f64 kUnixEpochJd = 2440587.5;
+    // Unix epoch (1970-01-01 00:00 UTC) is JD 2440587.5: day 2440587, 12 h in
+    constexpr i64 kUnixEpochDay = 2440587;
+    constexpr i64 kSecondsPerDay = 86400;
 
-    return kUnixEpochJd + total_seconds / 86400.0;
+    const i64 total = whole_seconds.count();
+    return JulianDate(kUnixEpochDay + total / kSecondsPerDay,
+                      43200.0 + static_cast<f64>(total % kSecondsPerDay) + subsecond);
 }
 
 // -----------------------------------------------------------------
@@ -3,6 +3,7 @@
 /// @file time_system.hpp
 /// @brief Astronomical time utilities: Julian Date, sidereal time.
 
+#include "astro/julian_date.hpp"
 #include "core/types.hpp"
 
 namespace parallax::astro
@@ -33,32 +34,50 @@ namespace parallax::astro
         /// @return Julian Date as a double-precision floating-point number.
         [[nodiscard]] static f64 to_julian_date(const DateTime& dt);
 
+        /// @brief Convert civil date/time (UTC) to a split Julian Date (seconds kept exact).
+        [[nodiscard]] static JulianDate to_precise_julian_date(const DateTime& dt);
+
         /// @brief Convert Julian Date back to civil date/time (UTC).
         /// @param jd Julian Date (must be positive).
         /// @return Corresponding civil date/time.
         [[nodiscard]] static DateTime from_julian_date(f64 jd);
 
+        /// @brief Convert a split Julian Date back to civil date/time (UTC).
+        [[nodiscard]] static DateTime from_julian_date(const JulianDate& jd);
+
         /// @brief Compute Julian centuries elapsed since J2000.0.
         /// @param jd Julian Date.
         /// @return T = (JD - 2451545.0) / 36525.0
         [[nodiscard]] static f64 julian_centuries(f64 jd);
 
         /// @brief Greenwich Mean Sidereal Time (radians).
-        /// @param jd Julian Date (UTC).
+        /// @param jd Julian Date (UT1; UTC is within 0.9 s, see TimeScales).
         /// @return GMST in radians, normalized to [0, 2π).
         /// Uses the IAU 1982 formula (accurate to ~0.1 second of time).
         [[nodiscard]] static f64 gmst(f64 jd);
 
+        /// @brief Greenwich Mean Sidereal Time (radians) for a split Julian Date.
+        ///
+        /// The 360.98564736629°/day term is reduced with the whole days
+        /// separate, so the result keeps the date's full resolution.
+        [[nodiscard]] static f64 gmst(const JulianDate& jd);
+
         /// @brief Local Mean Sidereal Time (radians).
-        /// @param jd Julian Date (UTC).
+        /// @param jd Julian Date (UT1).
         /// @param longitude_rad Observer longitude in radians (east positive).
         /// @return LMST in radians, normalized to [0, 2π).
         [[nodiscard]] static f64 lmst(f64 jd, f64 longitude_rad);
 
+        /// @brief Local Mean Sidereal Time (radians) for a split Julian Date.
+        [[nodiscard]] static f64 lmst(const JulianDate& jd, f64 longitude_rad);
+
         /// @brief Get current system time as a Julian Date.
         /// @return Julian Date corresponding to the current UTC system clock.
         [[nodiscard]] static f64 now_as_jd();
 
+        /// @brief Get current system time as a split Julian Date.
+        [[nodiscard]] static JulianDate now_as_julian_date();
+
     private:
         /// @brief Normalize an angle to the range [0, 2π).
         [[nodiscard]] static f64 normalize_radians(f64 angle);
@@ -1,96 +1,173 @@
 /// @file catalog_loader.cpp
-/// @brief Implementation of CSV star catalog loaders.
+/// @brief Implementation of CSV star catalog loaders (memory-mapped, SIMD-split).
 
 #include "catalog/catalog_loader.hpp"
 
+#include "catalog/csv_scanner.hpp"
 #include "core/logger.hpp"
+#include "core/memory_mapped_file.hpp"
 #include "core/types.hpp"
 
+#include <algorithm>
+#include <array>
 #include <charconv>
-#include <fstream>
-#include <sstream>
-#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 namespace parallax::catalog
 {
 
+namespace
+{
+    /// Split `body` into up to `count` chunks that each end just after a '\n'
+    /// (or at the end of the text). Never returns an empty list.
+    std::vector<std::string_view> split_at_newlines(std::string_view body, std::size_t count)
+    {
+        std::vector<std::string_view> chunks;
+        chunks.reserve(count);
+
+        std::size_t begin = 0;
+        for (std::size_t i = 1; i <= count && begin < body.size(); ++i)
+        {
+            std::size_t end = body.size();
+            if (i < count)
+            {
+                const std::size_t target = std::max(begin, body.size() * i / count);
+                const std::size_t newline = body.find('\n', target);
+                end = (newline == std::string_view::npos) ? body.size() : newline + 1;
+            }
+            chunks.push_back(body.substr(begin, end - begin));
+            begin = end;
+        }
+
+        if (chunks.empty())
+        {
+            chunks.push_back(body);
+        }
+        return chunks;
+    }
+
+    /// Lines CsvScanner will report for a chunk (a trailing partial line counts).
+    std::size_t count_lines(std::string_view chunk)
+    {
+        const auto newlines = static_cast<std::size_t>(std::count(chunk.begin(), chunk.end(), '\n'));
+        return newlines + ((!chunk.empty() && chunk.back() != '\n') ? 1 : 0);
+    }
+
+    /// Run fn(0..count-1), one call per thread; index 0 runs on the caller.
+    template <typename Fn>
+    void run_parallel(std::size_t count, const Fn& fn)
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(count - 1);
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            workers.emplace_back([&fn, i] { fn(i); });
+        }
+        fn(0);
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+} // anonymous namespace
+
 // -----------------------------------------------------------------
 // Load bright-star CSV: Name,RA_deg,Dec_deg,Vmag,BV
 // -----------------------------------------------------------------
 
 std::optional<std::vector<StarEntry>>
-CatalogLoader::load_bright_star_csv(const std::filesystem::path& path)
+CatalogLoader::load_bright_star_csv(const std::filesystem::path& path, u32 thread_count)
 {
-    std::ifstream file(path);
-    if (!file.is_open())
+    return load_csv(path, IdColumn::LineIndex, thread_count);
+}
+
+// -----------------------------------------------------------------
+// Load Hipparcos CSV: HIP,RA_deg,Dec_deg,Vmag,BV
+// -----------------------------------------------------------------
+
+std::optional<std::vector<StarEntry>>
+CatalogLoader::load_hipparcos_csv(const std::filesystem::path& path, u32 thread_count)
+{
+    return load_csv(path, IdColumn::Parsed, thread_count);
+}
+
+// -----------------------------------------------------------------
+// Shared loader: mapped file → newline-aligned chunks → parse_chunk
+// per thread, each writing into its own slice of the output.
+// -----------------------------------------------------------------
+
+std::optional<std::vector<StarEntry>>
+CatalogLoader::load_csv(const std::filesystem::path& path, IdColumn id_column, u32 thread_count)
+{
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec))
     {
         PLX_CORE_ERROR("CatalogLoader: Failed to open file: {}", path.string());
         return std::nullopt;
     }
 
-    std::vector<StarEntry> stars;
-    std::string line;
-
-    // Skip header line
-    if (!std::getline(file, line))
+    const core::MemoryMappedFile file(path);
+    if (!file.is_open())
     {
         PLX_CORE_ERROR("CatalogLoader: File is empty: {}", path.string());
         return std::nullopt;
     }
 
-    u32 line_number = 1;
-    u32 skipped = 0;
+    // Skip header line
+    const std::string_view text{reinterpret_cast<const char*>(file.data()), file.size()};
+    const std::size_t header_end = text.find('\n');
+    const std::string_view body = (header_end == std::string_view::npos)
+                                ? std::string_view{}
+                                : text.substr(header_end + 1);
 
-    while (std::getline(file, line))
+    if (thread_count == 0)
     {
-        ++line_number;
-
-        if (line.empty())
-        {
-            continue;
-        }
-
-        // Parse CSV columns: Name,RA_deg,Dec_deg,Vmag,BV
-        std::istringstream stream(line);
-        std::string name_str;
-        std::string ra_str;
-        std::string dec_str;
-        std::string mag_str;
-        std::string bv_str;
-
-        if (!std::getline(stream, name_str, ',') ||
-            !std::getline(stream, ra_str, ',') ||
-            !std::getline(stream, dec_str, ',') ||
-            !std::getline(stream, mag_str, ',') ||
-            !std::getline(stream, bv_str))
-        {
-            PLX_CORE_WARN("CatalogLoader: Malformed line {}: {}", line_number, line);
-            ++skipped;
-            continue;
-        }
-
-        const auto ra_deg  = parse_f64(trim(ra_str));
-        const auto dec_deg = parse_f64(trim(dec_str));
-        const auto mag_v   = parse_f64(trim(mag_str));
-        const auto bv      = parse_f64(trim(bv_str));
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t max_chunks = std::max<std::size_t>(1, body.size() / kMinChunkBytes);
+    const auto chunks = split_at_newlines(body, std::min<std::size_t>(thread_count, max_chunks));
+
+    // Pass 1: line count per chunk → first line number and output slice
+    std::vector<std::size_t> line_offsets(chunks.size() + 1, 0);
+    run_parallel(chunks.size(), [&](std::size_t i) {
+        line_offsets[i + 1] = count_lines(chunks[i]);
+    });
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+    {
+        line_offsets[i + 1] += line_offsets[i];
+    }
 
-        if (!ra_deg || !dec_deg || !mag_v || !bv)
+    // Pass 2: parse every chunk into its slice (one slot per line)
+    std::vector<StarEntry> stars(line_offsets.back());
+    std::vector<ChunkResult> results(chunks.size());
+    run_parallel(chunks.size(), [&](std::size_t i) {
+        const auto slots = std::span<StarEntry>(stars).subspan(
+            line_offsets[i], line_offsets[i + 1] - line_offsets[i]);
+        // Line 1 is the header
+        const auto first_line = static_cast<u32>(line_offsets[i] + 2);
+        results[i] = parse_chunk(chunks[i], id_column, first_line, slots);
+    });
+
+    // Close the gaps left by skipped lines. With no malformed lines every
+    // slice already sits at its final position and nothing moves.
+    std::size_t count = 0;
+    u32 skipped = 0;
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+    {
+        const auto src = stars.begin() + static_cast<std::ptrdiff_t>(line_offsets[i]);
+        if (line_offsets[i] != count)
         {
-            PLX_CORE_WARN("CatalogLoader: Failed to parse values on line {}: {}",
-                          line_number, line);
-            ++skipped;
-            continue;
+            std::copy(src, src + static_cast<std::ptrdiff_t>(results[i].written),
+                      stars.begin() + static_cast<std::ptrdiff_t>(count));
         }
-
-        stars.push_back(StarEntry{
-            .ra         = *ra_deg * astro_constants::kDegToRad,
-            .dec        = *dec_deg * astro_constants::kDegToRad,
-            .mag_v      = static_cast<f32>(*mag_v),
-            .color_bv   = static_cast<f32>(*bv),
-            .catalog_id = line_number - 1,  // 1-based index (line 2 = star 1)
-        });
+        count += results[i].written;
+        skipped += results[i].skipped;
     }
+    stars.resize(count);
 
     if (stars.empty())
     {
@@ -103,39 +180,33 @@ CatalogLoader::load_bright_star_csv(const std::filesystem::path& path)
         PLX_CORE_WARN("CatalogLoader: Skipped {} malformed lines", skipped);
     }
 
-    PLX_CORE_INFO("CatalogLoader: Loaded {} stars from {}", stars.size(), path.string());
+    PLX_CORE_INFO("CatalogLoader: Loaded {} stars from {} ({} chunks)",
+                  stars.size(), path.string(), chunks.size());
 
     return stars;
 }
 
 // -----------------------------------------------------------------
-// Load Hipparcos CSV: HIP,RA_deg,Dec_deg,Vmag,BV
+// Parse one chunk: CsvScanner → from_chars per field.
+// No per-line allocation; fields are views into the mapping.
 // -----------------------------------------------------------------
 
-std::optional<std::vector<StarEntry>>
-CatalogLoader::load_hipparcos_csv(const std::filesystem::path& path)
+CatalogLoader::ChunkResult
+CatalogLoader::parse_chunk(std::string_view chunk,
+                           IdColumn id_column,
+                           u32 first_line_number,
+                           std::span<StarEntry> out)
 {
-    std::ifstream file(path);
-    if (!file.is_open())
-    {
-        PLX_CORE_ERROR("CatalogLoader: Failed to open file: {}", path.string());
-        return std::nullopt;
-    }
+    CsvScanner scanner(chunk);
 
-    std::vector<StarEntry> stars;
-    std::string line;
-
-    // Skip header line
-    if (!std::getline(file, line))
-    {
-        PLX_CORE_ERROR("CatalogLoader: File is empty: {}", path.string());
-        return std::nullopt;
-    }
+    std::array<std::string_view, 5> fields;
+    std::string_view line;
+    std::size_t field_count = 0;
 
-    u32 line_number = 1;
-    u32 skipped = 0;
+    ChunkResult result;
+    u32 line_number = first_line_number - 1;
 
-    while (std::getline(file, line))
+    while (scanner.next_line(line, fields, field_count))
     {
         ++line_number;
 
@@ -144,62 +215,40 @@ CatalogLoader::load_hipparcos_csv(const std::filesystem::path& path)
             continue;
         }
 
-        // Parse CSV columns: HIP,RA_deg,Dec_deg,Vmag,BV
-        std::istringstream stream(line);
-        std::string hip_str;
-        std::string ra_str;
-        std::string dec_str;
-        std::string mag_str;
-        std::string bv_str;
-
-        if (!std::getline(stream, hip_str, ',') ||
-            !std::getline(stream, ra_str, ',') ||
-            !std::getline(stream, dec_str, ',') ||
-            !std::getline(stream, mag_str, ',') ||
-            !std::getline(stream, bv_str))
+        // Columns: ID-or-Name,RA_deg,Dec_deg,Vmag,BV
+        if (field_count < fields.size())
         {
             PLX_CORE_WARN("CatalogLoader: Malformed line {}: {}", line_number, line);
-            ++skipped;
+            ++result.skipped;
             continue;
         }
 
-        const auto hip_id  = parse_u32(trim(hip_str));
-        const auto ra_deg  = parse_f64(trim(ra_str));
-        const auto dec_deg = parse_f64(trim(dec_str));
-        const auto mag_v   = parse_f64(trim(mag_str));
-        const auto bv      = parse_f64(trim(bv_str));
+        const auto hip_id  = (id_column == IdColumn::Parsed)
+                           ? parse_u32(trim(fields[0]))
+                           : std::optional<u32>{line_number - 1};  // 1-based index (line 2 = star 1)
+        const auto ra_deg  = parse_f64(trim(fields[1]));
+        const auto dec_deg = parse_f64(trim(fields[2]));
+        const auto mag_v   = parse_f64(trim(fields[3]));
+        const auto bv      = parse_f64(trim(fields[4]));
 
         if (!hip_id || !ra_deg || !dec_deg || !mag_v || !bv)
         {
             PLX_CORE_WARN("CatalogLoader: Failed to parse values on line {}: {}",
                           line_number, line);
-            ++skipped;
+            ++result.skipped;
             continue;
         }
 
-        stars.push_back(StarEntry{
+        out[result.written++] = StarEntry{
             .ra         = *ra_deg * astro_constants::kDegToRad,
             .dec        = *dec_deg * astro_constants::kDegToRad,
             .mag_v      = static_cast<f32>(*mag_v),
             .color_bv   = static_cast<f32>(*bv),
             .catalog_id = *hip_id,
-        });
+        };
     }
 
-    if (stars.empty())
-    {
-        PLX_CORE_ERROR("CatalogLoader: No valid stars found in: {}", path.string());
-        return std::nullopt;
-    }
-
-    if (skipped > 0)
-    {
-        PLX_CORE_WARN("CatalogLoader: Skipped {} malformed lines", skipped);
-    }
-
-    PLX_CORE_INFO("CatalogLoader: Loaded {} stars from {}", stars.size(), path.string());
-
-    return stars;
+    return result;
 }
 
 // -----------------------------------------------------------------
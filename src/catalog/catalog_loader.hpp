@@ -6,8 +6,10 @@
 #include "catalog/star_entry.hpp"
 #include "core/types.hpp"
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -16,7 +18,12 @@ namespace parallax::catalog
     /// @brief Static utility class for loading star catalog files.
     ///
     /// Phase 1 supports CSV loading for Hipparcos-style and bright-star catalogs.
-    /// Binary .plxcat format will be added in a later task.
+    /// Binary .plxcat catalogs are memory-mapped by CatalogManager instead.
+    ///
+    /// Both loaders accept a thread count. With more than one thread the file
+    /// is split at newline boundaries and the chunks are parsed concurrently
+    /// straight into their final slots of the output vector. The result
+    /// (order and catalog_id) is identical to a single-threaded load.
     class CatalogLoader
     {
     public:
@@ -32,9 +39,10 @@ namespace parallax::catalog
         /// catalog_id is assigned as the 1-based line index.
         ///
         /// @param path Path to the CSV file.
+        /// @param thread_count Parser threads; 0 = std::thread::hardware_concurrency().
         /// @return Vector of StarEntry on success, std::nullopt on failure.
         [[nodiscard]] static std::optional<std::vector<StarEntry>>
-            load_bright_star_csv(const std::filesystem::path& path);
+            load_bright_star_csv(const std::filesystem::path& path, u32 thread_count = 1);
 
         /// @brief Load stars from a Hipparcos-format CSV file.
         ///
@@ -45,11 +53,45 @@ namespace parallax::catalog
         /// catalog_id is set to the HIP number.
         ///
         /// @param path Path to the CSV file.
+        /// @param thread_count Parser threads; 0 = std::thread::hardware_concurrency().
         /// @return Vector of StarEntry on success, std::nullopt on failure.
         [[nodiscard]] static std::optional<std::vector<StarEntry>>
-            load_hipparcos_csv(const std::filesystem::path& path);
+            load_hipparcos_csv(const std::filesystem::path& path, u32 thread_count = 1);
 
     private:
+        /// @brief Where StarEntry::catalog_id comes from.
+        enum class IdColumn
+        {
+            LineIndex,  ///< First column is a name; use the 1-based data line index
+            Parsed,     ///< First column is a numeric ID
+        };
+
+        /// @brief Outcome of parsing one chunk.
+        struct ChunkResult
+        {
+            std::size_t written = 0;    ///< Stars stored at the front of the chunk's slots
+            u32 skipped = 0;            ///< Malformed lines
+        };
+
+        /// @brief Shared CSV loader for both five-column layouts.
+        ///
+        /// Maps the file, counts the lines of each chunk, sizes the output to
+        /// the total line count and lets every chunk parse into its own slice
+        /// (so line numbers, and therefore catalog_id, are known up front).
+        /// Slices are then compacted in place over skipped lines.
+        [[nodiscard]] static std::optional<std::vector<StarEntry>>
+            load_csv(const std::filesystem::path& path, IdColumn id_column, u32 thread_count);
+
+        /// @brief Parse the lines of one chunk into `out` (one slot per line).
+        /// @param first_line_number 1-based file line number of the chunk's first line.
+        [[nodiscard]] static ChunkResult parse_chunk(std::string_view chunk,
+                                                     IdColumn id_column,
+                                                     u32 first_line_number,
+                                                     std::span<StarEntry> out);
+
+        /// @brief Smallest chunk worth handing to its own thread.
+        static constexpr std::size_t kMinChunkBytes = 256 * 1024;
+
         /// @brief Trim leading and trailing whitespace from a string_view.
         [[nodiscard]] static std::string_view trim(std::string_view sv);
 
@@ -0,0 +1,165 @@
+/// @file catalog_manager.cpp
+/// @brief Implementation of the memory-mapped .plxcat catalog manager.
+
+#include "catalog/catalog_manager.hpp"
+
+#include "core/logger.hpp"
+
+#include <chrono>
+#include <cstring>
+
+namespace parallax::catalog
+{
+
+// -----------------------------------------------------------------
+// load() — map the file, validate, keep it alive
+// -----------------------------------------------------------------
+
+std::optional<CatalogView> CatalogManager::load(const std::filesystem::path& path)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    auto file = std::make_unique<core::MemoryMappedFile>(path);
+    if (!file->is_open())
+    {
+        return std::nullopt;
+    }
+
+    auto view = validate(*file, path);
+    if (!view.has_value())
+    {
+        return std::nullopt;
+    }
+
+    const f64 elapsed_ms = std::chrono::duration<f64, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+
+    PLX_CORE_INFO("CatalogManager: Mapped {} stars (nside {}, {:.1f} MB) from {} in {:.2f} ms",
+                  view->header->entry_count, view->header->healpix_nside,
+                  static_cast<f64>(file->size()) / (1024.0 * 1024.0),
+                  path.string(), elapsed_ms);
+
+    m_catalogs.push_back(LoadedCatalog{.file = std::move(file), .view = *view});
+    return view;
+}
+
+// -----------------------------------------------------------------
+// validate() — header + index sanity checks
+//
+// Only the header and the index table are touched; star data pages
+// are left for the OS to fault in on demand.
+// -----------------------------------------------------------------
+
+std::optional<CatalogView> CatalogManager::validate(const core::MemoryMappedFile& file,
+                                                    const std::filesystem::path& path)
+{
+    const std::size_t file_size = file.size();
+    if (file_size < sizeof(CatalogHeader))
+    {
+        PLX_CORE_ERROR("CatalogManager: File too small for header: {}", path.string());
+        return std::nullopt;
+    }
+
+    const auto* header = reinterpret_cast<const CatalogHeader*>(file.data());
+
+    if (std::memcmp(header->magic, kPlxcatMagic, sizeof(kPlxcatMagic)) != 0)
+    {
+        PLX_CORE_ERROR("CatalogManager: Bad magic (not a .plxcat file): {}", path.string());
+        return std::nullopt;
+    }
+    if (header->version != kPlxcatVersion)
+    {
+        PLX_CORE_ERROR("CatalogManager: Unsupported version {} in {}", header->version, path.string());
+        return std::nullopt;
+    }
+    if (header->entry_size != sizeof(PackedStarEntry))
+    {
+        PLX_CORE_ERROR("CatalogManager: Unexpected entry size {} in {}", header->entry_size, path.string());
+        return std::nullopt;
+    }
+
+    // nside is capped so 12 × nside² cannot wrap u64 and match a bogus count
+    const u64 nside = header->healpix_nside;
+    if (nside == 0 || nside > kPlxcatMaxNside || (nside & (nside - 1)) != 0
+        || header->healpix_count != 12 * nside * nside)
+    {
+        PLX_CORE_ERROR("CatalogManager: Invalid HEALPix nside {} / count {} in {}",
+                       header->healpix_nside, header->healpix_count, path.string());
+        return std::nullopt;
+    }
+
+    // Bounds are compared as size ≤ file_size, then offset ≤ file_size − size,
+    // so no header value can overflow the sum of offset and size
+    const u64 index_bytes = static_cast<u64>(header->healpix_count) * sizeof(HEALPixIndexEntry);
+    const bool index_ok = header->index_offset % alignof(HEALPixIndexEntry) == 0
+                       && index_bytes <= file_size
+                       && header->index_offset <= file_size - index_bytes;
+    const bool data_ok = header->entry_count <= file_size / sizeof(PackedStarEntry)
+                      && header->data_offset <= file_size - header->entry_count * sizeof(PackedStarEntry);
+
+    if (!index_ok || !data_ok)
+    {
+        PLX_CORE_ERROR("CatalogManager: Index or data section out of bounds in {}", path.string());
+        return std::nullopt;
+    }
+
+    const u64 data_bytes = header->entry_count * sizeof(PackedStarEntry);
+
+    CatalogView view{
+        .header = header,
+        .index  = {reinterpret_cast<const HEALPixIndexEntry*>(file.data() + header->index_offset),
+                   header->healpix_count},
+        .data   = {reinterpret_cast<const PackedStarEntry*>(file.data() + header->data_offset),
+                   static_cast<std::size_t>(header->entry_count)},
+    };
+
+    // Every pixel range must be entry-aligned and lie inside the data section
+    u64 total = 0;
+    for (const auto& entry : view.index)
+    {
+        const u64 entry_bytes = static_cast<u64>(entry.count) * sizeof(PackedStarEntry);
+        if (entry.offset % sizeof(PackedStarEntry) != 0
+            || entry_bytes > data_bytes
+            || entry.offset > data_bytes - entry_bytes)
+        {
+            PLX_CORE_ERROR("CatalogManager: Corrupt index entry in {}", path.string());
+            return std::nullopt;
+        }
+        total += entry.count;
+    }
+
+    if (total != header->entry_count)
+    {
+        PLX_CORE_ERROR("CatalogManager: Index covers {} stars but header says {} in {}",
+                       total, header->entry_count, path.string());
+        return std::nullopt;
+    }
+
+    return view;
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+u64 CatalogManager::get_star_count() const
+{
+    u64 count = 0;
+    for (const auto& catalog : m_catalogs)
+    {
+        count += catalog.view.header->entry_count;
+    }
+    return count;
+}
+
+std::size_t CatalogManager::get_catalog_count() const
+{
+    return m_catalogs.size();
+}
+
+const CatalogView& CatalogManager::get_catalog(std::size_t i) const
+{
+    return m_catalogs[i].view;
+}
+
+} // namespace parallax::catalog
@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file catalog_manager.hpp
+/// @brief Owns memory-mapped .plxcat catalogs and exposes zero-copy views into them.
+
+#include "catalog/plxcat_format.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/memory_mapped_file.hpp"
+#include "core/types.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace parallax::catalog
+{
+    /// @brief Zero-copy view of one loaded .plxcat file.
+    ///
+    /// All pointers and spans reference the memory mapping owned by the
+    /// CatalogManager and stay valid for the manager's lifetime.
+    struct CatalogView
+    {
+        const CatalogHeader* header = nullptr;
+        std::span<const HEALPixIndexEntry> index;   ///< One entry per HEALPix pixel
+        std::span<const PackedStarEntry> data;      ///< All stars, pixel-sorted
+
+        /// @brief Stars belonging to one HEALPix pixel (brightest first).
+        /// @param pixel Nested-scheme pixel ID in [0, header->healpix_count).
+        [[nodiscard]] std::span<const PackedStarEntry> pixel_stars(u32 pixel) const
+        {
+            const auto& entry = index[pixel];
+            return data.subspan(entry.offset / sizeof(PackedStarEntry), entry.count);
+        }
+    };
+
+    /// @brief Loads binary .plxcat catalogs via memory mapping.
+    ///
+    /// Opening a catalog only validates the header and index table; star data
+    /// is paged in by the OS on first access. Multiple catalogs (e.g. bright +
+    /// Tycho-2) can be loaded side by side.
+    class CatalogManager
+    {
+    public:
+        CatalogManager() = default;
+        ~CatalogManager() = default;
+
+        CatalogManager(const CatalogManager&) = delete;
+        CatalogManager& operator=(const CatalogManager&) = delete;
+        CatalogManager(CatalogManager&&) = default;
+        CatalogManager& operator=(CatalogManager&&) = default;
+
+        /// @brief Memory-map and validate a .plxcat file.
+        /// @param path Path to the .plxcat file.
+        /// @return View into the mapping on success, std::nullopt on failure
+        ///         (the failure reason is logged).
+        [[nodiscard]] std::optional<CatalogView> load(const std::filesystem::path& path);
+
+        /// @brief Total number of stars across all loaded catalogs.
+        [[nodiscard]] u64 get_star_count() const;
+
+        /// @brief Number of loaded catalogs.
+        [[nodiscard]] std::size_t get_catalog_count() const;
+
+        /// @brief View of the i-th loaded catalog (in load order).
+        [[nodiscard]] const CatalogView& get_catalog(std::size_t i) const;
+
+    private:
+        /// @brief Check header fields and index bounds against the mapped size.
+        [[nodiscard]] static std::optional<CatalogView> validate(
+            const core::MemoryMappedFile& file,
+            const std::filesystem::path& path);
+
+        struct LoadedCatalog
+        {
+            std::unique_ptr<core::MemoryMappedFile> file;
+            CatalogView view;
+        };
+
+        std::vector<LoadedCatalog> m_catalogs;
+    };
+
+} // namespace parallax::catalog
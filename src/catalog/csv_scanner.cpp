@@ -0,0 +1,209 @@
+/// @file csv_scanner.cpp
+/// @brief Implementation of the SIMD CSV line splitter.
+
+#include "catalog/csv_scanner.hpp"
+
+#include "core/cpu_features.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PLX_CSV_SSE2 1
+#endif
+
+namespace parallax::catalog
+{
+
+CsvScanPath CsvScanner::s_path = CsvScanner::detect_path();
+
+// -----------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------
+
+CsvScanner::CsvScanner(std::string_view text)
+    : m_text{text}
+{
+    if (!m_text.empty())
+    {
+        m_mask = block_mask(0);
+    }
+}
+
+// -----------------------------------------------------------------
+// Line splitting
+// -----------------------------------------------------------------
+
+bool CsvScanner::next_line(std::string_view& line, std::span<std::string_view> fields, std::size_t& field_count)
+{
+    field_count = 0;
+    if (m_pos >= m_text.size())
+    {
+        return false;
+    }
+
+    const std::size_t line_start = m_pos;
+    std::size_t field_start = m_pos;
+
+    for (;;)
+    {
+        const std::size_t pos = next_delimiter();
+
+        if (pos == m_text.size() || m_text[pos] == '\n')
+        {
+            if (field_count < fields.size())
+            {
+                fields[field_count++] = m_text.substr(field_start, pos - field_start);
+            }
+            line = m_text.substr(line_start, pos - line_start);
+            m_pos = (pos == m_text.size()) ? pos : pos + 1;
+            return true;
+        }
+
+        // Comma: close the field unless the last slot is collecting the rest
+        if (field_count + 1 < fields.size())
+        {
+            fields[field_count++] = m_text.substr(field_start, pos - field_start);
+            field_start = pos + 1;
+        }
+    }
+}
+
+std::size_t CsvScanner::next_delimiter()
+{
+    while (m_mask == 0)
+    {
+        m_block += kBlockSize;
+        if (m_block >= m_text.size())
+        {
+            return m_text.size();
+        }
+        m_mask = block_mask(m_block);
+    }
+
+    const std::size_t pos = m_block + static_cast<std::size_t>(std::countr_zero(m_mask));
+    m_mask &= m_mask - 1;  // clear lowest set bit
+    return pos;
+}
+
+// -----------------------------------------------------------------
+// Block scan: one bit per byte that is ',' or '\n'
+// -----------------------------------------------------------------
+
+u64 CsvScanner::block_mask(std::size_t start) const
+{
+    const char* p = m_text.data() + start;
+
+    if (start + kBlockSize <= m_text.size())
+    {
+        switch (s_path)
+        {
+        case CsvScanPath::Avx2:
+            return block_mask_avx2(p);
+        case CsvScanPath::Sse2:
+            return block_mask_sse2(p);
+        case CsvScanPath::Scalar:
+            break;
+        }
+    }
+
+    // Tail block (or scalar path)
+    const std::size_t count = std::min(kBlockSize, m_text.size() - start);
+    u64 mask = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (p[i] == ',' || p[i] == '\n')
+        {
+            mask |= u64{1} << i;
+        }
+    }
+    return mask;
+}
+
+u64 CsvScanner::block_mask_sse2([[maybe_unused]] const char* p)
+{
+#if defined(PLX_CSV_SSE2)
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i newline = _mm_set1_epi8('\n');
+    u64 mask = 0;
+    for (std::size_t i = 0; i < kBlockSize; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        const __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(v, comma), _mm_cmpeq_epi8(v, newline));
+        mask |= static_cast<u64>(static_cast<u32>(_mm_movemask_epi8(hit))) << i;
+    }
+    return mask;
+#else
+    assert(false && "SSE2 scanner not compiled");
+    return 0;
+#endif
+}
+
+// -----------------------------------------------------------------
+// Path selection
+// -----------------------------------------------------------------
+
+const char* CsvScanner::get_simd_path()
+{
+    return get_path_name(s_path);
+}
+
+CsvScanPath CsvScanner::get_path()
+{
+    return s_path;
+}
+
+bool CsvScanner::set_path(CsvScanPath path)
+{
+    if (!is_supported(path))
+    {
+        return false;
+    }
+    s_path = path;
+    return true;
+}
+
+bool CsvScanner::is_supported(CsvScanPath path)
+{
+    switch (path)
+    {
+    case CsvScanPath::Scalar:
+        return true;
+    case CsvScanPath::Sse2:
+#if defined(PLX_CSV_SSE2)
+        return true;
+#else
+        return false;
+#endif
+    case CsvScanPath::Avx2:
+        return avx2_compiled() && core::get_cpu_features().avx2;
+    }
+    return false;
+}
+
+const char* CsvScanner::get_path_name(CsvScanPath path)
+{
+    switch (path)
+    {
+    case CsvScanPath::Scalar:
+        return "scalar";
+    case CsvScanPath::Sse2:
+        return "SSE2";
+    case CsvScanPath::Avx2:
+        return "AVX2";
+    }
+    return "unknown";
+}
+
+CsvScanPath CsvScanner::detect_path()
+{
+    if (is_supported(CsvScanPath::Avx2))
+    {
+        return CsvScanPath::Avx2;
+    }
+    return is_supported(CsvScanPath::Sse2) ? CsvScanPath::Sse2 : CsvScanPath::Scalar;
+}
+
+} // namespace parallax::catalog
@@ -0,0 +1,96 @@
+#pragma once
+
+/// @file csv_scanner.hpp
+/// @brief Allocation-free CSV line splitter with SIMD delimiter scanning.
+
+#include "core/types.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace parallax::catalog
+{
+    /// @brief Block scanner used by CsvScanner.
+    enum class CsvScanPath : u8
+    {
+        Scalar,     ///< Byte loop
+        Sse2,       ///< 4 × 16-byte compares per block (x86-64 baseline)
+        Avx2,       ///< 2 × 32-byte compares per block
+    };
+
+    /// @brief Splits an in-memory CSV buffer into lines and fields.
+    ///
+    /// The buffer is scanned in 64-byte blocks: each block is compared against
+    /// ',' and '\n' with AVX2 (2 × 32 B) or SSE2 (4 × 16 B), producing a 64-bit
+    /// mask of delimiter positions that is consumed with count-trailing-zeros.
+    /// The tail block and non-x86 targets use a scalar loop. Fields are
+    /// string_views into the buffer; nothing is allocated or copied.
+    ///
+    /// The AVX2 scanner lives in csv_scanner_avx2.cpp, the only file built
+    /// with AVX2 code generation; the path is chosen at startup from CPUID
+    /// (see core/cpu_features.hpp), like BatchTransform. set_path() overrides
+    /// it, e.g. to test every path.
+    ///
+    /// No quoting support: the star catalogs never quote fields.
+    class CsvScanner
+    {
+    public:
+        /// @brief Scan a buffer. It must outlive the scanner and all returned views.
+        explicit CsvScanner(std::string_view text);
+
+        /// @brief Split the next line into fields.
+        ///
+        /// Once fields.size() − 1 fields are filled, the last field takes the rest
+        /// of the line including any further commas (the behaviour of a final
+        /// std::getline without delimiter), so extra columns fail numeric parsing
+        /// instead of being silently dropped.
+        ///
+        /// @param line Receives the whole line, without '\n' (a '\r' is kept).
+        /// @param fields Receives up to fields.size() field views.
+        /// @param field_count Receives the number of fields found.
+        /// @return false once the buffer is exhausted.
+        bool next_line(std::string_view& line, std::span<std::string_view> fields, std::size_t& field_count);
+
+        /// @brief Name of the block scanner in use ("AVX2", "SSE2" or "scalar").
+        [[nodiscard]] static const char* get_simd_path();
+
+        /// @brief Block scanner in use (detected at startup).
+        [[nodiscard]] static CsvScanPath get_path();
+
+        /// @brief Force a path. Returns false (and changes nothing) if unsupported.
+        static bool set_path(CsvScanPath path);
+
+        /// @brief True if this CPU/build can run the path.
+        [[nodiscard]] static bool is_supported(CsvScanPath path);
+
+        /// @brief Human-readable path name ("scalar", "SSE2", "AVX2").
+        [[nodiscard]] static const char* get_path_name(CsvScanPath path);
+
+    private:
+        /// @brief Position of the next ',' or '\n', or the buffer size if none remain.
+        [[nodiscard]] std::size_t next_delimiter();
+
+        /// @brief Bitmask of delimiter positions in the 64-byte block at `start`.
+        [[nodiscard]] u64 block_mask(std::size_t start) const;
+
+        /// @brief Full-block SIMD scanners (p must have kBlockSize readable bytes).
+        [[nodiscard]] static u64 block_mask_sse2(const char* p);
+        [[nodiscard]] static u64 block_mask_avx2(const char* p);
+
+        /// @brief True if csv_scanner_avx2.cpp was built with AVX2 code.
+        [[nodiscard]] static bool avx2_compiled();
+
+        [[nodiscard]] static CsvScanPath detect_path();
+
+        static constexpr std::size_t kBlockSize = 64;
+
+        static CsvScanPath s_path;
+
+        std::string_view m_text;
+        std::size_t m_pos = 0;      ///< Start of the next line
+        std::size_t m_block = 0;    ///< Start of the block m_mask describes
+        u64 m_mask = 0;             ///< Unconsumed delimiter bits of the current block
+    };
+
+} // namespace parallax::catalog
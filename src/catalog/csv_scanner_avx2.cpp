@@ -0,0 +1,68 @@
+/// @file csv_scanner_avx2.cpp
+/// @brief AVX2 block scanner for CsvScanner.
+///
+/// This translation unit is the only one built with AVX2 code generation
+/// (per-file flags in CMake), so nothing here may run before the CPUID check
+/// in CsvScanner::is_supported(). Without those flags the scanner compiles
+/// to a stub and avx2_compiled() reports false.
+
+#include "catalog/csv_scanner.hpp"
+
+#include "core/types.hpp"
+
+#include <cassert>
+#include <cstddef>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define PLX_CSV_SCANNER_AVX2 1
+#endif
+
+namespace parallax::catalog
+{
+
+#if defined(PLX_CSV_SCANNER_AVX2)
+
+// -----------------------------------------------------------------
+// One bit per byte that is ',' or '\n', 2 × 32 bytes per block
+// -----------------------------------------------------------------
+
+u64 CsvScanner::block_mask_avx2(const char* p)
+{
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    u64 mask = 0;
+    for (std::size_t i = 0; i < kBlockSize; i += 32)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        const __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi8(v, comma), _mm256_cmpeq_epi8(v, newline));
+        mask |= static_cast<u64>(static_cast<u32>(_mm256_movemask_epi8(hit))) << i;
+    }
+    return mask;
+}
+
+bool CsvScanner::avx2_compiled()
+{
+    return true;
+}
+
+#else
+
+// -----------------------------------------------------------------
+// Built without AVX2 (non-x86 target): never selected
+// -----------------------------------------------------------------
+
+u64 CsvScanner::block_mask_avx2(const char*)
+{
+    assert(false && "AVX2 scanner not compiled");
+    return 0;
+}
+
+bool CsvScanner::avx2_compiled()
+{
+    return false;
+}
+
+#endif
+
+} // namespace parallax::catalog
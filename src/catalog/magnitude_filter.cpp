@@ -0,0 +1,367 @@
+/// @file magnitude_filter.cpp
+/// @brief Implementation of the magnitude-layer star filter.
+
+#include "catalog/magnitude_filter.hpp"
+
+#include "core/logger.hpp"
+#include "core/memory_mapped_file.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace parallax::catalog
+{
+
+namespace
+{
+
+/// Runs closer than this are prefetched / released with one call.
+constexpr std::size_t kAdviseMergeGap = 64 * 1024;
+
+/// Apply a paging hint to runs in ascending address order, merging near neighbours.
+void advise_runs(std::span<const std::span<const PackedStarEntry>> runs, core::MappingAdvice advice)
+{
+    const u8* begin = nullptr;
+    const u8* end = nullptr;
+    for (const auto& run : runs)
+    {
+        const auto* run_begin = reinterpret_cast<const u8*>(run.data());
+        const auto* run_end = run_begin + run.size_bytes();
+        if (begin != nullptr && run_begin >= end && static_cast<std::size_t>(run_begin - end) < kAdviseMergeGap)
+        {
+            end = run_end;
+            continue;
+        }
+        if (begin != nullptr)
+        {
+            core::MemoryMappedFile::advise(begin, static_cast<std::size_t>(end - begin), advice);
+        }
+        begin = run_begin;
+        end = run_end;
+    }
+    if (begin != nullptr)
+    {
+        core::MemoryMappedFile::advise(begin, static_cast<std::size_t>(end - begin), advice);
+    }
+}
+
+} // anonymous namespace
+
+// -----------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------
+
+MagnitudeFilter::MagnitudeFilter(u32 nside, core::JobSystem& jobs)
+    : m_jobs{jobs}
+    , m_nside{nside}
+{
+    m_layers.reserve(kLayerCount);
+    m_staging.reserve(kLayerCount);
+    for (u32 layer = 0; layer < kLayerCount; ++layer)
+    {
+        m_layers.emplace_back(nside);
+        m_staging.emplace_back(nside);
+    }
+}
+
+MagnitudeFilter::~MagnitudeFilter()
+{
+    // The job writes into this object
+    if (m_job_in_flight)
+    {
+        m_jobs.wait(m_job_counter);
+    }
+}
+
+// -----------------------------------------------------------------
+// build() — partition by magnitude, then bucket each layer by pixel
+// -----------------------------------------------------------------
+
+void MagnitudeFilter::build(std::vector<StarEntry> stars)
+{
+    wait_for_loads();
+
+    std::array<std::size_t, kLayerCount> counts{};
+    for (const auto& star : stars)
+    {
+        ++counts[layer_for_magnitude(star.mag_v)];
+    }
+
+    std::array<std::vector<StarEntry>, kLayerCount> layer_stars;
+    for (u32 layer = 0; layer < kLayerCount; ++layer)
+    {
+        layer_stars[layer].reserve(counts[layer]);
+    }
+    for (const auto& star : stars)
+    {
+        layer_stars[layer_for_magnitude(star.mag_v)].push_back(star);
+    }
+
+    m_star_count = stars.size();
+    m_catalogs.clear();
+
+    // Free the input before the layers allocate their bucketed copies
+    stars = {};
+
+    for (u32 layer = 0; layer < kLayerCount; ++layer)
+    {
+        m_layers[layer].build(std::move(layer_stars[layer]));
+        m_resident[layer] = true;
+        release_runs(m_resident_runs[layer]);
+        m_resident_runs[layer] = {};
+        m_staging[layer] = SpatialIndex(m_nside);
+        m_staging_runs[layer] = {};
+        PLX_CORE_TRACE("Magnitude layer {} (mag < {:.1f}): {} stars",
+                       layer, kLayerLimits[layer], counts[layer]);
+    }
+}
+
+void MagnitudeFilter::build(const CatalogManager& catalogs)
+{
+    wait_for_loads();
+
+    m_catalogs.clear();
+    m_star_count = 0;
+    for (std::size_t i = 0; i < catalogs.get_catalog_count(); ++i)
+    {
+        m_catalogs.push_back(catalogs.get_catalog(i));
+        m_star_count += m_catalogs.back().header->entry_count;
+    }
+
+    for (u32 layer = 0; layer < kLayerCount; ++layer)
+    {
+        release_runs(m_resident_runs[layer]);
+        m_resident_runs[layer] = {};
+        m_layers[layer] = SpatialIndex(m_nside);
+        m_resident[layer] = false;
+        m_staging[layer] = SpatialIndex(m_nside);
+        m_staging_runs[layer] = {};
+    }
+    m_pending_free_mask = 0;
+}
+
+// -----------------------------------------------------------------
+// Residency — load layers the limit reaches on a job, free the ones
+// it has left by more than the margin
+// -----------------------------------------------------------------
+
+void MagnitudeFilter::set_magnitude_limit(f32 mag_limit)
+{
+    if (m_catalogs.empty())
+    {
+        return;
+    }
+
+    if (m_job_in_flight && m_job_counter.is_done())
+    {
+        wait_for_loads();
+    }
+
+    // Layer 0 has no lower bound and is always needed
+    for (u32 layer = 1; layer < kLayerCount; ++layer)
+    {
+        if (!m_resident[layer] || mag_limit >= kLayerLimits[layer - 1] - kReleaseMargin)
+        {
+            continue;
+        }
+
+        // The empty staging index takes the layer's place; the next job
+        // frees the columns and drops the mapped pages
+        std::swap(m_layers[layer], m_staging[layer]);
+        m_staging_runs[layer] = std::move(m_resident_runs[layer]);
+        m_resident_runs[layer] = {};
+        m_resident[layer] = false;
+        m_pending_free_mask |= 1u << layer;
+        PLX_CORE_INFO("Magnitude layer {} (mag < {:.1f}) released", layer, kLayerLimits[layer]);
+    }
+
+    // One job at a time: loads needed meanwhile start once it has landed
+    if (m_job_in_flight)
+    {
+        return;
+    }
+
+    u32 load_mask = 0;
+    const u32 active = active_layer_count(mag_limit);
+    for (u32 layer = 0; layer < active; ++layer)
+    {
+        if (!m_resident[layer])
+        {
+            load_mask |= 1u << layer;
+        }
+    }
+
+    if (load_mask != 0 || m_pending_free_mask != 0)
+    {
+        m_load_mask = load_mask;
+        m_free_mask = m_pending_free_mask;
+        m_pending_free_mask = 0;
+        start_job();
+    }
+}
+
+void MagnitudeFilter::start_job()
+{
+    m_job_in_flight = true;
+    m_jobs.submit(core::Job{.function = &MagnitudeFilter::layer_job, .context = this}, m_job_counter);
+
+    // Without worker threads the job only runs inside wait(): load inline
+    if (m_jobs.get_thread_count() == 1)
+    {
+        wait_for_loads();
+    }
+}
+
+void MagnitudeFilter::wait_for_loads()
+{
+    if (!m_job_in_flight)
+    {
+        return;
+    }
+
+    m_jobs.wait(m_job_counter);
+    m_job_in_flight = false;
+
+    for (u32 layer = 0; layer < kLayerCount; ++layer)
+    {
+        if ((m_load_mask & (1u << layer)) == 0)
+        {
+            continue;
+        }
+
+        // The layer's empty index goes back to staging for its next release
+        std::swap(m_layers[layer], m_staging[layer]);
+        m_resident_runs[layer] = std::move(m_staging_runs[layer]);
+        m_staging_runs[layer] = {};
+        m_resident[layer] = true;
+        ++m_layer_load_count;
+        PLX_CORE_INFO("Magnitude layer {} (mag < {:.1f}) loaded: {} stars",
+                      layer, kLayerLimits[layer], m_layers[layer].get_stars().size());
+    }
+    m_load_mask = 0;
+    m_free_mask = 0;
+}
+
+void MagnitudeFilter::layer_job(void* context)
+{
+    auto& self = *static_cast<MagnitudeFilter*>(context);
+    for (u32 layer = 0; layer < kLayerCount; ++layer)
+    {
+        const u32 bit = 1u << layer;
+        if ((self.m_load_mask & bit) != 0)
+        {
+            // Replaces (and so frees) a layer released since the last job
+            self.m_staging_runs[layer] = self.find_layer_runs(layer);
+            self.m_staging[layer] = self.load_layer(self.m_staging_runs[layer]);
+        }
+        else if ((self.m_free_mask & bit) != 0)
+        {
+            release_runs(self.m_staging_runs[layer]);
+            self.m_staging_runs[layer] = {};
+            self.m_staging[layer] = SpatialIndex(self.m_nside);
+        }
+    }
+}
+
+std::vector<MagnitudeFilter::StarRun> MagnitudeFilter::find_layer_runs(u32 layer) const
+{
+    const auto layer_of = [](const PackedStarEntry& packed) {
+        return layer_for_magnitude(decode_magnitude(packed.mag_v));
+    };
+
+    // Binary searches touch only a few entries per pixel outside the layer
+    std::vector<StarRun> runs;
+    for (const auto& catalog : m_catalogs)
+    {
+        for (u32 pixel = 0; pixel < catalog.header->healpix_count; ++pixel)
+        {
+            const auto run = catalog.pixel_stars(pixel);
+            const auto first = std::partition_point(run.begin(), run.end(),
+                                                    [&](const PackedStarEntry& s) { return layer_of(s) < layer; });
+            const auto last = std::partition_point(first, run.end(),
+                                                   [&](const PackedStarEntry& s) { return layer_of(s) == layer; });
+            if (first != last)
+            {
+                runs.emplace_back(first, last);
+            }
+        }
+    }
+    return runs;
+}
+
+SpatialIndex MagnitudeFilter::load_layer(std::span<const StarRun> runs) const
+{
+    advise_runs(runs, core::MappingAdvice::WillNeed);
+
+    std::size_t count = 0;
+    for (const auto& run : runs)
+    {
+        count += run.size();
+    }
+
+    std::vector<StarEntry> stars;
+    stars.reserve(count);
+    for (const auto& run : runs)
+    {
+        std::transform(run.begin(), run.end(), std::back_inserter(stars), unpack_star);
+    }
+
+    SpatialIndex index(m_nside);
+    index.build(std::move(stars));
+    return index;
+}
+
+void MagnitudeFilter::release_runs(std::span<const StarRun> runs)
+{
+    advise_runs(runs, core::MappingAdvice::DontNeed);
+}
+
+// -----------------------------------------------------------------
+// Layer selection
+// -----------------------------------------------------------------
+
+u32 MagnitudeFilter::layer_for_magnitude(f32 mag)
+{
+    // First layer whose upper bound exceeds mag; the last layer is open-ended
+    const auto it = std::upper_bound(kLayerLimits.begin(), kLayerLimits.end() - 1, mag);
+    return static_cast<u32>(it - kLayerLimits.begin());
+}
+
+u32 MagnitudeFilter::active_layer_count(f32 mag_limit)
+{
+    return layer_for_magnitude(mag_limit) + 1;
+}
+
+// -----------------------------------------------------------------
+// Queries / accessors
+// -----------------------------------------------------------------
+
+void MagnitudeFilter::query_disc(f64 ra, f64 dec, f64 radius, std::vector<u32>& pixels) const
+{
+    m_layers.front().query_disc(ra, dec, radius, pixels);
+}
+
+const SpatialIndex& MagnitudeFilter::get_layer(u32 layer) const
+{
+    assert(layer < kLayerCount);
+    return m_layers[layer];
+}
+
+bool MagnitudeFilter::is_resident(u32 layer) const
+{
+    assert(layer < kLayerCount);
+    return m_resident[layer];
+}
+
+u64 MagnitudeFilter::get_star_count() const
+{
+    return m_star_count;
+}
+
+u64 MagnitudeFilter::get_layer_load_count() const
+{
+    return m_layer_load_count;
+}
+
+} // namespace parallax::catalog
@@ -0,0 +1,169 @@
+#pragma once
+
+/// @file magnitude_filter.hpp
+/// @brief Magnitude-layer LOD: stars split into brightness layers, each HEALPix-indexed.
+
+#include "catalog/catalog_manager.hpp"
+#include "catalog/plxcat_format.hpp"
+#include "catalog/spatial_index.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/job_system.hpp"
+#include "core/types.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace parallax::catalog
+{
+    /// @brief Splits a catalog into the magnitude layers of rendering_pipeline.md.
+    ///
+    /// Layer k holds stars with kLayerLimits[k−1] ≤ mag_v < kLayerLimits[k]
+    /// (layer 0 has no lower bound, the last layer no upper bound). Each layer
+    /// is its own SpatialIndex at the same nside, so one pixel query serves
+    /// every layer and stars within a pixel are brightest first.
+    ///
+    /// A query at limiting magnitude m reads only layers whose lower bound is
+    /// ≤ m. Within the last active layer the per-pixel scan stops at the first
+    /// star fainter than m, so cost follows the visible star count rather than
+    /// the catalog size.
+    ///
+    /// Layers built from mapped .plxcat catalogs are resident only while the
+    /// limit reaches them. When the limit crosses into a layer,
+    /// set_magnitude_limit() builds it from the mapping on a JobSystem job
+    /// and a later call swaps it in; until then the layer reads as empty,
+    /// so a frame never waits for it. A layer is freed (its mapped pages
+    /// dropped too) only once the limit is kReleaseMargin below the layer,
+    /// so a limit hovering at a boundary does not reload it every crossing;
+    /// the columns themselves are freed by the next job. A JobSystem
+    /// without worker threads would never run the job on its own, so there
+    /// layers load inline. Layers built from a StarEntry list have nothing
+    /// to reload from and always stay resident.
+    ///
+    /// set_magnitude_limit() and the accessors must be called from the
+    /// thread that owns the JobSystem; the job only writes staging slots.
+    class MagnitudeFilter
+    {
+    public:
+        static constexpr u32 kLayerCount = 7;
+
+        /// @brief How far (mag) the limit must fall below a layer before it is freed.
+        static constexpr f32 kReleaseMargin = 0.5f;
+
+        /// @brief Upper magnitude bound of each layer (last one is open-ended).
+        static constexpr std::array<f32, kLayerCount> kLayerLimits = {
+            2.0f, 4.0f, 6.5f, 10.0f, 14.0f, 18.0f, 21.0f,
+        };
+
+        /// @brief Create empty layers at the given HEALPix resolution.
+        MagnitudeFilter(u32 nside, core::JobSystem& jobs);
+
+        /// @brief Wait for a load still in flight.
+        ~MagnitudeFilter();
+
+        MagnitudeFilter(const MagnitudeFilter&) = delete;
+        MagnitudeFilter& operator=(const MagnitudeFilter&) = delete;
+        MagnitudeFilter(MagnitudeFilter&&) = delete;
+        MagnitudeFilter& operator=(MagnitudeFilter&&) = delete;
+
+        /// @brief Distribute stars into layers and bucket each layer by pixel.
+        /// Every layer is resident.
+        void build(std::vector<StarEntry> stars);
+
+        /// @brief Use every catalog loaded by the manager as the layer source.
+        ///
+        /// Nothing is read here: layers load on demand in set_magnitude_limit().
+        /// Pixel runs in a .plxcat are brightest first, so each layer is a
+        /// contiguous slice of every run; only that slice is unpacked, and the
+        /// whole catalog is never copied to the heap.
+        void build(const CatalogManager& catalogs);
+
+        /// @brief Swap in finished loads, free layers the limit has left and
+        /// start loading the ones it reaches. Called once per frame.
+        void set_magnitude_limit(f32 mag_limit);
+
+        /// @brief Block until a load in flight has finished and swap it in.
+        void wait_for_loads();
+
+        /// @brief Layer a star of the given magnitude belongs to.
+        [[nodiscard]] static u32 layer_for_magnitude(f32 mag);
+
+        /// @brief Number of leading layers that can contain stars ≤ mag_limit.
+        [[nodiscard]] static u32 active_layer_count(f32 mag_limit);
+
+        /// @brief Pixels overlapping a spherical cap (shared by all layers).
+        void query_disc(f64 ra, f64 dec, f64 radius, std::vector<u32>& pixels) const;
+
+        /// @brief Per-layer spatial index (empty while the layer is not resident).
+        [[nodiscard]] const SpatialIndex& get_layer(u32 layer) const;
+
+        /// @brief True if the layer's stars are loaded.
+        [[nodiscard]] bool is_resident(u32 layer) const;
+
+        /// @brief Call fn(layer, index) for every layer. Non-resident layers are
+        /// loaded one at a time for the call only, so residency is unchanged
+        /// (for one-off passes over the whole catalog such as the GPU upload).
+        template <typename Fn>
+        void visit_all_layers(Fn&& fn) const
+        {
+            for (u32 layer = 0; layer < kLayerCount; ++layer)
+            {
+                if (m_resident[layer])
+                {
+                    fn(layer, m_layers[layer]);
+                    continue;
+                }
+                const auto runs = find_layer_runs(layer);
+                const SpatialIndex loaded = load_layer(runs);
+                release_runs(runs);
+                fn(layer, loaded);
+            }
+        }
+
+        /// @brief Stars across all layers, resident or not.
+        [[nodiscard]] u64 get_star_count() const;
+
+        /// @brief Layers swapped in from the mapping so far.
+        [[nodiscard]] u64 get_layer_load_count() const;
+
+    private:
+        using StarRun = std::span<const PackedStarEntry>;
+
+        /// @brief The layer's slice of every pixel run in the mapped catalogs.
+        [[nodiscard]] std::vector<StarRun> find_layer_runs(u32 layer) const;
+
+        /// @brief Prefetch the runs, unpack them and bucket them by pixel.
+        [[nodiscard]] SpatialIndex load_layer(std::span<const StarRun> runs) const;
+
+        /// @brief Drop the runs' mapped pages.
+        static void release_runs(std::span<const StarRun> runs);
+
+        /// @brief Queue a job for the layers in m_load_mask and m_free_mask.
+        void start_job();
+
+        static void layer_job(void* context);
+
+        core::JobSystem& m_jobs;
+        u32 m_nside;
+        u64 m_star_count = 0;
+        std::vector<SpatialIndex> m_layers;
+        std::array<bool, kLayerCount> m_resident{};
+        std::array<std::vector<StarRun>, kLayerCount> m_resident_runs;   ///< Source pages of resident layers
+        std::vector<CatalogView> m_catalogs;                              ///< Empty for list-built layers
+
+        // Job in flight: masks set before submit, the staging slots of the
+        // masked layers written by the job and read back only after
+        // m_job_counter reaches zero. A staging slot holds a loaded layer
+        // waiting to be swapped in, or a freed one waiting for the job
+        core::JobCounter m_job_counter;
+        bool m_job_in_flight = false;
+        u32 m_load_mask = 0;
+        u32 m_free_mask = 0;
+        std::vector<SpatialIndex> m_staging;
+        std::array<std::vector<StarRun>, kLayerCount> m_staging_runs;
+        u32 m_pending_free_mask = 0;        ///< Layers freed since the last job started
+
+        u64 m_layer_load_count = 0;
+    };
+
+} // namespace parallax::catalog
@@ -0,0 +1,137 @@
+#pragma once
+
+/// @file plxcat_format.hpp
+/// @brief On-disk layout of the binary .plxcat star catalog (see docs/architecture/catalog_system.md).
+
+#include "catalog/star_entry.hpp"
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+namespace parallax::catalog
+{
+    // -----------------------------------------------------------------
+    // File layout:
+    //   [CatalogHeader (64 B)]
+    //   [HEALPixIndexEntry × healpix_count]   at header.index_offset
+    //   [PackedStarEntry × entry_count]       at header.data_offset
+    //
+    // Stars are sorted by HEALPix pixel (nested scheme), and within each
+    // pixel by magnitude (brightest first). All fields are little-endian.
+    // -----------------------------------------------------------------
+
+    inline constexpr char kPlxcatMagic[8] = {'P', 'L', 'X', '_', 'C', 'A', 'T', '\0'};
+    inline constexpr u32 kPlxcatVersion = 1;
+
+    /// @brief Largest nside a reader accepts (same bound as SpatialIndex::kMaxNside).
+    inline constexpr u32 kPlxcatMaxNside = 8192;
+
+    /// @brief Fixed 64-byte file header.
+    struct CatalogHeader
+    {
+        char magic[8];          ///< "PLX_CAT\0"
+        u32 version;            ///< Format version (kPlxcatVersion)
+        u32 flags;              ///< Reserved
+        u64 entry_count;        ///< Total star count
+        u32 entry_size;         ///< Bytes per entry (sizeof(PackedStarEntry))
+        u32 healpix_nside;      ///< HEALPix resolution (e.g., 64 → 49152 pixels)
+        u32 healpix_count;      ///< 12 × nside × nside
+        u32 reserved_0;
+        u64 index_offset;       ///< Byte offset to index table
+        u64 data_offset;        ///< Byte offset to star data
+        u8 padding[8];          ///< Pad to 64 bytes
+    };
+    static_assert(sizeof(CatalogHeader) == 64, "CatalogHeader must be 64 bytes");
+
+    /// @brief Per-pixel index entry: where the pixel's stars live in the data section.
+    struct HEALPixIndexEntry
+    {
+        u64 offset;             ///< Byte offset into the data section
+        u32 count;              ///< Number of stars in this pixel
+        u32 reserved;
+    };
+    static_assert(sizeof(HEALPixIndexEntry) == 16, "HEALPixIndexEntry must be 16 bytes");
+
+#pragma pack(push, 1)
+    /// @brief Compact 32-byte on-disk star record.
+    struct PackedStarEntry
+    {
+        f64 ra;                 ///< Right ascension (radians, J2000)
+        f64 dec;                ///< Declination (radians, J2000)
+        i16 mag_v;              ///< V magnitude × 1000 (e.g., 4560 = 4.560)
+        i16 mag_b;              ///< B magnitude × 1000
+        u16 parallax;           ///< Parallax in 0.01 mas units (0 = unknown)
+        u8 spectral_type;       ///< Encoded: O=0..M=6, subtype in high bits
+        u8 flags;               ///< Bit flags: variable, binary, etc.
+        u32 source_id;          ///< Cross-reference ID (HIP, TYC, ...)
+        u32 reserved;
+    };
+#pragma pack(pop)
+    static_assert(sizeof(PackedStarEntry) == 32, "PackedStarEntry must be 32 bytes");
+
+    // -----------------------------------------------------------------
+    // Magnitude encoding: int16 with 3 decimals (range -32.768 .. 32.767)
+    // -----------------------------------------------------------------
+
+    [[nodiscard]] inline i16 encode_magnitude(f32 mag)
+    {
+        const f32 scaled = std::round(mag * 1000.0f);
+        return static_cast<i16>(std::clamp(scaled, -32768.0f, 32767.0f));
+    }
+
+    [[nodiscard]] inline f32 decode_magnitude(i16 encoded)
+    {
+        return static_cast<f32>(encoded) / 1000.0f;
+    }
+
+    /// @brief Pack a runtime StarEntry into the on-disk record.
+    /// B magnitude is reconstructed as V + (B-V).
+    [[nodiscard]] inline PackedStarEntry pack_star(const StarEntry& star)
+    {
+        return PackedStarEntry{
+            .ra            = star.ra,
+            .dec           = star.dec,
+            .mag_v         = encode_magnitude(star.mag_v),
+            .mag_b         = encode_magnitude(star.mag_v + star.color_bv),
+            .parallax      = 0,
+            .spectral_type = 0,
+            .flags         = 0,
+            .source_id     = star.catalog_id,
+            .reserved      = 0,
+        };
+    }
+
+    /// @brief Expand an on-disk record into the runtime StarEntry.
+    [[nodiscard]] inline StarEntry unpack_star(const PackedStarEntry& packed)
+    {
+        return StarEntry{
+            .ra         = packed.ra,
+            .dec        = packed.dec,
+            .mag_v      = decode_magnitude(packed.mag_v),
+            .color_bv   = decode_magnitude(packed.mag_b) - decode_magnitude(packed.mag_v),
+            .catalog_id = packed.source_id,
+        };
+    }
+
+    /// @brief Build a header with magic/version/sizes filled in and offsets
+    /// following the canonical layout (index directly after the header,
+    /// data directly after the index).
+    [[nodiscard]] inline CatalogHeader make_catalog_header(u64 entry_count, u32 nside)
+    {
+        CatalogHeader header{};
+        std::memcpy(header.magic, kPlxcatMagic, sizeof(header.magic));
+        header.version = kPlxcatVersion;
+        header.entry_count = entry_count;
+        header.entry_size = sizeof(PackedStarEntry);
+        header.healpix_nside = nside;
+        header.healpix_count = 12u * nside * nside;
+        header.index_offset = sizeof(CatalogHeader);
+        header.data_offset = header.index_offset
+                           + static_cast<u64>(header.healpix_count) * sizeof(HEALPixIndexEntry);
+        return header;
+    }
+
+} // namespace parallax::catalog
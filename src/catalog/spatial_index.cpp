@@ -0,0 +1,472 @@
+/// @file spatial_index.cpp
+/// @brief Implementation of the nested-scheme HEALPix spatial index.
+
+#include "catalog/spatial_index.hpp"
+
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+
+#include <glm/geometric.hpp>
+
+namespace
+{
+
+using parallax::f64;
+using parallax::i64;
+
+// Base-pixel ring (jrll) and longitude (jpll) offsets, in units of nside
+constexpr std::array<i64, 12> kJrll = {2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4};
+constexpr std::array<i64, 12> kJpll = {1, 3, 5, 7, 0, 2, 4, 6, 1, 3, 5, 7};
+
+/// Slack added to pixel radii so rounding never drops a boundary pixel.
+constexpr f64 kQueryEpsilon = 1e-10;
+
+// Query classification of a pixel against the region
+constexpr int kOutside = 0;
+constexpr int kPartial = 1;
+constexpr int kInside  = 2;
+
+} // anonymous namespace
+
+namespace parallax::catalog
+{
+
+// -----------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------
+
+SpatialIndex::SpatialIndex(u32 nside)
+    : m_nside{nside}
+    , m_order{static_cast<u32>(std::countr_zero(nside))}
+    , m_pixel_count{12u * nside * nside}
+{
+    assert(nside >= 1 && nside <= kMaxNside && std::has_single_bit(nside));
+
+    for (u32 order = 0; order <= m_order; ++order)
+    {
+        m_pixrad[order] = max_pixrad(order);
+    }
+}
+
+// -----------------------------------------------------------------
+// ang2pix — nested scheme (after healpix_base::loc2pix)
+//
+// z = sin(dec), phi = ra. tt = phi / (π/2) in [0, 4) selects the
+// base-pixel column.
+//
+// Equatorial belt (|z| ≤ 2/3): base pixels 4..7 plus the lower
+// halves of 0..3 / upper halves of 8..11. jp/jm index the ascending
+// and descending pixel edge lines.
+//
+// Polar caps (|z| > 2/3): pixel edge lines converge on the pole;
+// their index scales with nside × sqrt(3 × (1 − |z|)).
+// -----------------------------------------------------------------
+
+u32 SpatialIndex::ang2pix(f64 ra, f64 dec) const
+{
+    const f64 z = std::sin(dec);
+    const f64 za = std::abs(z);
+
+    f64 tt = std::fmod(ra / astro_constants::kHalfPi, 4.0);
+    if (tt < 0.0)
+    {
+        tt += 4.0;
+    }
+
+    const auto nside = static_cast<i64>(m_nside);
+
+    if (za <= 2.0 / 3.0)
+    {
+        const f64 temp1 = static_cast<f64>(nside) * (0.5 + tt);
+        const f64 temp2 = static_cast<f64>(nside) * (z * 0.75);
+        const auto jp = static_cast<i64>(temp1 - temp2);  // ascending edge line
+        const auto jm = static_cast<i64>(temp1 + temp2);  // descending edge line
+        const i64 ifp = jp >> m_order;                    // in {0, 4}
+        const i64 ifm = jm >> m_order;
+
+        const i64 face = (ifp == ifm) ? (ifp | 4)
+                       : (ifp < ifm)  ? ifp
+                                      : (ifm + 8);
+
+        const i64 ix = jm & (nside - 1);
+        const i64 iy = nside - (jp & (nside - 1)) - 1;
+        return xyf2nest(static_cast<u32>(ix), static_cast<u32>(iy), static_cast<u32>(face), m_order);
+    }
+
+    const i64 ntt = std::min<i64>(3, static_cast<i64>(tt));
+    const f64 tp = tt - static_cast<f64>(ntt);
+
+    // Near the poles 1 − |z| loses precision; use cos(dec) instead
+    const f64 tmp = (za < 0.99)
+                  ? static_cast<f64>(nside) * std::sqrt(3.0 * (1.0 - za))
+                  : static_cast<f64>(nside) * std::cos(dec) / std::sqrt((1.0 + za) / 3.0);
+
+    const i64 jp = std::min(static_cast<i64>(tp * tmp), nside - 1);
+    const i64 jm = std::min(static_cast<i64>((1.0 - tp) * tmp), nside - 1);
+
+    if (z >= 0.0)
+    {
+        return xyf2nest(static_cast<u32>(nside - jm - 1), static_cast<u32>(nside - jp - 1),
+                        static_cast<u32>(ntt), m_order);
+    }
+    return xyf2nest(static_cast<u32>(jp), static_cast<u32>(jm), static_cast<u32>(ntt + 8), m_order);
+}
+
+// -----------------------------------------------------------------
+// pix2vec — pixel center (after healpix_base::pix2loc)
+//
+// jr is the pixel's ring index counted from the north pole (1..4n−1)
+// and nr the number of pixels per base-pixel edge on that ring. The
+// face tables give each base pixel's ring / longitude offset.
+// -----------------------------------------------------------------
+
+Vec3d SpatialIndex::pix2vec(u32 pixel) const
+{
+    return pix2vec(pixel, m_order);
+}
+
+Vec2d SpatialIndex::pix2ang(u32 pixel) const
+{
+    const Vec3d v = pix2vec(pixel);
+    f64 ra = std::atan2(v.y, v.x);
+    if (ra < 0.0)
+    {
+        ra += astro_constants::kTwoPi;
+    }
+    return Vec2d{ra, std::asin(std::clamp(v.z, -1.0, 1.0))};
+}
+
+Vec3d SpatialIndex::pix2vec(u32 pixel, u32 order)
+{
+    u32 ix = 0;
+    u32 iy = 0;
+    u32 face = 0;
+    nest2xyf(pixel, order, ix, iy, face);
+
+    const i64 nside = i64{1} << order;
+    const f64 fact2 = 4.0 / (12.0 * static_cast<f64>(nside) * static_cast<f64>(nside));
+    const f64 fact1 = static_cast<f64>(2 * nside) * fact2;
+
+    const i64 jr = (kJrll[face] << order) - static_cast<i64>(ix) - static_cast<i64>(iy) - 1;
+
+    i64 nr = 0;
+    f64 z = 0.0;
+    f64 sin_theta = 0.0;
+    bool have_sin_theta = false;
+
+    if (jr < nside)
+    {
+        // North polar cap
+        nr = jr;
+        const f64 tmp = static_cast<f64>(nr * nr) * fact2;
+        z = 1.0 - tmp;
+        if (z > 0.99)
+        {
+            sin_theta = std::sqrt(tmp * (2.0 - tmp));
+            have_sin_theta = true;
+        }
+    }
+    else if (jr > 3 * nside)
+    {
+        // South polar cap
+        nr = 4 * nside - jr;
+        const f64 tmp = static_cast<f64>(nr * nr) * fact2;
+        z = tmp - 1.0;
+        if (z < -0.99)
+        {
+            sin_theta = std::sqrt(tmp * (2.0 - tmp));
+            have_sin_theta = true;
+        }
+    }
+    else
+    {
+        // Equatorial belt
+        nr = nside;
+        z = static_cast<f64>(2 * nside - jr) * fact1;
+    }
+
+    i64 tmp = kJpll[face] * nr + static_cast<i64>(ix) - static_cast<i64>(iy);
+    if (tmp < 0)
+    {
+        tmp += 8 * nr;
+    }
+
+    const f64 phi = (nr == nside)
+                  ? 0.75 * astro_constants::kHalfPi * static_cast<f64>(tmp) * fact1
+                  : (0.5 * astro_constants::kHalfPi * static_cast<f64>(tmp)) / static_cast<f64>(nr);
+
+    if (!have_sin_theta)
+    {
+        sin_theta = std::sqrt((1.0 - z) * (1.0 + z));
+    }
+    return Vec3d{sin_theta * std::cos(phi), sin_theta * std::sin(phi), z};
+}
+
+// -----------------------------------------------------------------
+// max_pixrad — after healpix_base::max_pixrad
+//
+// The largest pixels (in angular extent) touch the transition ring
+// z = 2/3; the distance from that ring's first pixel center to the
+// nearest polar-cap corner bounds every pixel at this order.
+// -----------------------------------------------------------------
+
+f64 SpatialIndex::max_pixrad() const
+{
+    return m_pixrad[m_order];
+}
+
+f64 SpatialIndex::max_pixrad(u32 order)
+{
+    const auto nside = static_cast<f64>(u32{1} << order);
+
+    const auto from_z_phi = [](f64 z, f64 phi) {
+        const f64 sin_theta = std::sqrt((1.0 - z) * (1.0 + z));
+        return Vec3d{sin_theta * std::cos(phi), sin_theta * std::sin(phi), z};
+    };
+
+    const Vec3d va = from_z_phi(2.0 / 3.0, astro_constants::kPi / (4.0 * nside));
+    f64 t1 = 1.0 - 1.0 / nside;
+    t1 *= t1;
+    const Vec3d vb = from_z_phi(1.0 - t1 / 3.0, 0.0);
+
+    // atan2 form stays accurate for tiny angles
+    return std::atan2(glm::length(glm::cross(va, vb)), glm::dot(va, vb));
+}
+
+// -----------------------------------------------------------------
+// Region queries
+//
+// Descend from the 12 base pixels. A pixel is treated as a cap of
+// radius max_pixrad(order) around its center: caps fully outside the
+// region are dropped, caps fully inside emit their whole nested range
+// at the target order, and partial caps are split into 4 children.
+// -----------------------------------------------------------------
+
+template <typename Classify>
+void SpatialIndex::query_hierarchical(Classify&& classify, std::vector<u32>& pixels) const
+{
+    pixels.clear();
+
+    struct Node
+    {
+        u32 pixel;
+        u32 order;
+    };
+
+    // Depth-first; children pushed in reverse so output stays ascending.
+    // Depth ≤ kMaxOrder and ≤ 3 siblings wait per level, plus 12 faces.
+    std::array<Node, 12 + 3 * kMaxOrder + 1> stack{};
+    std::size_t top = 0;
+    for (u32 face = 12; face-- > 0;)
+    {
+        stack[top++] = Node{face, 0};
+    }
+
+    while (top > 0)
+    {
+        const Node node = stack[--top];
+        const f64 pixrad = m_pixrad[node.order] + kQueryEpsilon;
+        const int result = classify(pix2vec(node.pixel, node.order), pixrad);
+
+        if (result == kOutside)
+        {
+            continue;
+        }
+
+        if (node.order == m_order)
+        {
+            pixels.push_back(node.pixel);
+        }
+        else if (result == kInside)
+        {
+            const u32 shift = 2 * (m_order - node.order);
+            const u32 first = node.pixel << shift;
+            const u32 last = (node.pixel + 1) << shift;
+            for (u32 p = first; p < last; ++p)
+            {
+                pixels.push_back(p);
+            }
+        }
+        else
+        {
+            for (u32 child = 4; child-- > 0;)
+            {
+                stack[top++] = Node{(node.pixel << 2) + child, node.order + 1};
+            }
+        }
+    }
+}
+
+void SpatialIndex::query_disc(f64 ra, f64 dec, f64 radius, std::vector<u32>& pixels) const
+{
+    const f64 cos_dec = std::cos(dec);
+    const Vec3d center{cos_dec * std::cos(ra), cos_dec * std::sin(ra), std::sin(dec)};
+
+    query_hierarchical([&](const Vec3d& v, f64 pixrad) {
+        const f64 dist = std::atan2(glm::length(glm::cross(center, v)), glm::dot(center, v));
+        if (dist > radius + pixrad)
+        {
+            return kOutside;
+        }
+        return (dist + pixrad <= radius) ? kInside : kPartial;
+    }, pixels);
+}
+
+void SpatialIndex::query_polygon(std::span<const Vec3d> vertices, std::vector<u32>& pixels) const
+{
+    pixels.clear();
+    if (vertices.size() < 3)
+    {
+        return;
+    }
+
+    // Inward-facing edge plane normals
+    std::vector<Vec3d> normals;
+    normals.reserve(vertices.size());
+    Vec3d centroid{0.0};
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        const Vec3d& a = vertices[i];
+        const Vec3d& b = vertices[(i + 1) % vertices.size()];
+        normals.push_back(glm::normalize(glm::cross(a, b)));
+        centroid += a;
+    }
+    if (glm::dot(normals.front(), centroid) < 0.0)
+    {
+        for (auto& n : normals)
+        {
+            n = -n;
+        }
+    }
+
+    query_hierarchical([&](const Vec3d& v, f64 pixrad) {
+        const f64 margin = std::sin(std::min(pixrad, astro_constants::kHalfPi));
+        int result = kInside;
+        for (const auto& n : normals)
+        {
+            const f64 s = glm::dot(n, v);
+            if (s < -margin)
+            {
+                return kOutside;
+            }
+            if (s < margin)
+            {
+                result = kPartial;
+            }
+        }
+        return result;
+    }, pixels);
+}
+
+// -----------------------------------------------------------------
+// Star buckets — counting sort by pixel, then brightest first
+// -----------------------------------------------------------------
+
+void SpatialIndex::build(std::vector<StarEntry> stars)
+{
+    std::vector<u32> star_pixels(stars.size());
+    m_pixel_offsets.assign(static_cast<std::size_t>(m_pixel_count) + 1, 0);
+
+    for (std::size_t i = 0; i < stars.size(); ++i)
+    {
+        star_pixels[i] = ang2pix(stars[i].ra, stars[i].dec);
+        ++m_pixel_offsets[star_pixels[i] + 1];
+    }
+    for (u32 p = 0; p < m_pixel_count; ++p)
+    {
+        m_pixel_offsets[p + 1] += m_pixel_offsets[p];
+    }
+
+    std::vector<StarEntry> sorted(stars.size());
+    std::vector<u32> cursor(m_pixel_offsets.begin(), m_pixel_offsets.end() - 1);
+    for (std::size_t i = 0; i < stars.size(); ++i)
+    {
+        sorted[cursor[star_pixels[i]]++] = stars[i];
+    }
+
+    for (u32 p = 0; p < m_pixel_count; ++p)
+    {
+        std::sort(sorted.begin() + m_pixel_offsets[p], sorted.begin() + m_pixel_offsets[p + 1],
+                  [](const StarEntry& a, const StarEntry& b) { return a.mag_v < b.mag_v; });
+    }
+
+    stars = {};
+    m_stars = StarCatalogSoA::from_entries(sorted);
+}
+
+StarRange SpatialIndex::pixel_range(u32 pixel) const
+{
+    if (m_pixel_offsets.empty())
+    {
+        return {};
+    }
+    return StarRange{.begin = m_pixel_offsets[pixel], .end = m_pixel_offsets[pixel + 1]};
+}
+
+const StarCatalogSoA& SpatialIndex::get_stars() const
+{
+    return m_stars;
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+u32 SpatialIndex::get_nside() const
+{
+    return m_nside;
+}
+
+u32 SpatialIndex::get_order() const
+{
+    return m_order;
+}
+
+u32 SpatialIndex::get_pixel_count() const
+{
+    return m_pixel_count;
+}
+
+// -----------------------------------------------------------------
+// Bit interleaving helpers
+// -----------------------------------------------------------------
+
+u32 SpatialIndex::xyf2nest(u32 ix, u32 iy, u32 face, u32 order)
+{
+    return (face << (2 * order)) + spread_bits(ix) + (spread_bits(iy) << 1);
+}
+
+void SpatialIndex::nest2xyf(u32 pixel, u32 order, u32& ix, u32& iy, u32& face)
+{
+    face = pixel >> (2 * order);
+    const u32 local = pixel & ((u32{1} << (2 * order)) - 1);
+    ix = compact_bits(local);
+    iy = compact_bits(local >> 1);
+}
+
+u32 SpatialIndex::spread_bits(u32 v)
+{
+    v &= 0x0000FFFFu;
+    v = (v | (v << 8)) & 0x00FF00FFu;
+    v = (v | (v << 4)) & 0x0F0F0F0Fu;
+    v = (v | (v << 2)) & 0x33333333u;
+    v = (v | (v << 1)) & 0x55555555u;
+    return v;
+}
+
+u32 SpatialIndex::compact_bits(u32 v)
+{
+    v &= 0x55555555u;
+    v = (v | (v >> 1)) & 0x33333333u;
+    v = (v | (v >> 2)) & 0x0F0F0F0Fu;
+    v = (v | (v >> 4)) & 0x00FF00FFu;
+    v = (v | (v >> 8)) & 0x0000FFFFu;
+    return v;
+}
+
+} // namespace parallax::catalog
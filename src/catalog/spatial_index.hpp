@@ -0,0 +1,146 @@
+#pragma once
+
+/// @file spatial_index.hpp
+/// @brief HEALPix sky partitioning (nested scheme) for catalog ordering and FOV queries.
+
+#include "catalog/star_catalog_soa.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/types.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace parallax::catalog
+{
+    /// @brief HEALPix pixelization of the celestial sphere, nested numbering.
+    ///
+    /// Divides the sky into 12 × nside² equal-area pixels. In the nested scheme
+    /// the 4 children of pixel p at resolution nside are 4p..4p+3 at 2·nside,
+    /// so pixel-sorted data keeps sky neighbours close together on disk and
+    /// queries can descend the pixel hierarchy from the 12 base pixels.
+    ///
+    /// Optionally owns a star list bucketed by pixel (see build()), so FOV
+    /// culling only touches stars in pixels that overlap the view. Stars are
+    /// kept as StarCatalogSoA columns; a pixel maps to a row range.
+    ///
+    /// Reference: Górski et al. 2005, ApJ 622, 759.
+    class SpatialIndex
+    {
+    public:
+        /// @brief Create an index at the given resolution.
+        /// @param nside Power of two in [1, kMaxNside].
+        explicit SpatialIndex(u32 nside);
+
+        // -----------------------------------------------------------------
+        // Pixel geometry
+        // -----------------------------------------------------------------
+
+        /// @brief Pixel containing an equatorial direction.
+        /// @param ra Right ascension (radians).
+        /// @param dec Declination (radians).
+        /// @return Nested-scheme pixel ID in [0, get_pixel_count()).
+        [[nodiscard]] u32 ang2pix(f64 ra, f64 dec) const;
+
+        /// @brief Unit vector (equatorial frame) of a pixel center.
+        [[nodiscard]] Vec3d pix2vec(u32 pixel) const;
+
+        /// @brief RA/Dec (radians) of a pixel center, as (ra, dec).
+        [[nodiscard]] Vec2d pix2ang(u32 pixel) const;
+
+        /// @brief Upper bound on the angular distance from any pixel center
+        /// to its corners at this resolution (radians).
+        [[nodiscard]] f64 max_pixrad() const;
+
+        // -----------------------------------------------------------------
+        // Region queries
+        //
+        // Both queries are conservative: every pixel that overlaps the
+        // region is returned, plus possibly a few neighbours that only
+        // touch its bounding circle. Callers filter stars exactly.
+        // Results are written in ascending pixel order; `pixels` is
+        // cleared first so its capacity can be reused across frames.
+        // -----------------------------------------------------------------
+
+        /// @brief Pixels overlapping a spherical cap.
+        /// @param ra Cap center right ascension (radians).
+        /// @param dec Cap center declination (radians).
+        /// @param radius Cap angular radius (radians).
+        /// @param pixels Output pixel IDs.
+        void query_disc(f64 ra, f64 dec, f64 radius, std::vector<u32>& pixels) const;
+
+        /// @brief Pixels overlapping a convex spherical polygon.
+        /// @param vertices Unit vectors of the corners, in either winding order
+        ///                 (≥ 3 vertices, every edge shorter than 180°).
+        /// @param pixels Output pixel IDs.
+        void query_polygon(std::span<const Vec3d> vertices, std::vector<u32>& pixels) const;
+
+        // -----------------------------------------------------------------
+        // Star buckets
+        // -----------------------------------------------------------------
+
+        /// @brief Take ownership of a star list and bucket it by pixel,
+        /// brightest first within each pixel.
+        void build(std::vector<StarEntry> stars);
+
+        /// @brief Rows of get_stars() in one pixel (empty before build()).
+        [[nodiscard]] StarRange pixel_range(u32 pixel) const;
+
+        /// @brief All bucketed stars, in pixel order.
+        [[nodiscard]] const StarCatalogSoA& get_stars() const;
+
+        // -----------------------------------------------------------------
+        // Accessors
+        // -----------------------------------------------------------------
+
+        /// @brief HEALPix resolution parameter.
+        [[nodiscard]] u32 get_nside() const;
+
+        /// @brief log2(nside).
+        [[nodiscard]] u32 get_order() const;
+
+        /// @brief Total pixel count: 12 × nside².
+        [[nodiscard]] u32 get_pixel_count() const;
+
+        /// @brief Largest supported nside (12 × nside² must fit in u32).
+        static constexpr u32 kMaxNside = 8192;
+
+        /// @brief log2(kMaxNside).
+        static constexpr u32 kMaxOrder = 13;
+
+    private:
+        /// @brief Pixel center unit vector at an arbitrary order.
+        [[nodiscard]] static Vec3d pix2vec(u32 pixel, u32 order);
+
+        /// @brief Max center-to-corner distance at an arbitrary order.
+        [[nodiscard]] static f64 max_pixrad(u32 order);
+
+        /// @brief Combine face-local (x, y) and face number into a nested pixel ID.
+        [[nodiscard]] static u32 xyf2nest(u32 ix, u32 iy, u32 face, u32 order);
+
+        /// @brief Split a nested pixel ID into face-local (x, y) and face number.
+        static void nest2xyf(u32 pixel, u32 order, u32& ix, u32& iy, u32& face);
+
+        /// @brief Interleave the low 16 bits of v with zeros (x → x0x0x0...).
+        [[nodiscard]] static u32 spread_bits(u32 v);
+
+        /// @brief Inverse of spread_bits: gather the even bits of v.
+        [[nodiscard]] static u32 compact_bits(u32 v);
+
+        /// @brief Shared descent for both queries.
+        /// @param classify Returns 0 (outside), 1 (partial) or 2 (fully inside)
+        ///                 for a pixel center vector and its pixel radius.
+        template <typename Classify>
+        void query_hierarchical(Classify&& classify, std::vector<u32>& pixels) const;
+
+        u32 m_nside;
+        u32 m_order;
+        u32 m_pixel_count;
+
+        std::array<f64, kMaxOrder + 1> m_pixrad{};  ///< max_pixrad per order 0..m_order
+
+        StarCatalogSoA m_stars;                     ///< Sorted by (pixel, mag_v)
+        std::vector<u32> m_pixel_offsets;           ///< pixel_count + 1 prefix offsets into m_stars
+    };
+
+} // namespace parallax::catalog
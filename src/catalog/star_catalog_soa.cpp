@@ -0,0 +1,104 @@
+/// @file star_catalog_soa.cpp
+/// @brief StarCatalogSoA conversion and row access.
+
+#include "catalog/star_catalog_soa.hpp"
+
+#include <cmath>
+
+namespace parallax::catalog
+{
+
+// -----------------------------------------------------------------
+// AoS → SoA
+// -----------------------------------------------------------------
+
+StarCatalogSoA StarCatalogSoA::from_entries(std::span<const StarEntry> stars)
+{
+    StarCatalogSoA soa;
+    soa.m_direction_x.resize(stars.size());
+    soa.m_direction_y.resize(stars.size());
+    soa.m_direction_z.resize(stars.size());
+    soa.m_ra.resize(stars.size());
+    soa.m_dec.resize(stars.size());
+    soa.m_mag_v.resize(stars.size());
+    soa.m_color_bv.resize(stars.size());
+    soa.m_catalog_id.resize(stars.size());
+
+    for (std::size_t i = 0; i < stars.size(); ++i)
+    {
+        const Vec3d direction = direction_of(stars[i]);
+        soa.m_direction_x[i] = direction.x;
+        soa.m_direction_y[i] = direction.y;
+        soa.m_direction_z[i] = direction.z;
+        soa.m_ra[i]          = stars[i].ra;
+        soa.m_dec[i]         = stars[i].dec;
+        soa.m_mag_v[i]       = stars[i].mag_v;
+        soa.m_color_bv[i]    = stars[i].color_bv;
+        soa.m_catalog_id[i]  = stars[i].catalog_id;
+    }
+    return soa;
+}
+
+// -----------------------------------------------------------------
+// Row operations
+// -----------------------------------------------------------------
+
+void StarCatalogSoA::reserve(std::size_t count)
+{
+    m_direction_x.reserve(count);
+    m_direction_y.reserve(count);
+    m_direction_z.reserve(count);
+    m_ra.reserve(count);
+    m_dec.reserve(count);
+    m_mag_v.reserve(count);
+    m_color_bv.reserve(count);
+    m_catalog_id.reserve(count);
+}
+
+void StarCatalogSoA::push_back(const StarEntry& star)
+{
+    const Vec3d direction = direction_of(star);
+    m_direction_x.push_back(direction.x);
+    m_direction_y.push_back(direction.y);
+    m_direction_z.push_back(direction.z);
+    m_ra.push_back(star.ra);
+    m_dec.push_back(star.dec);
+    m_mag_v.push_back(star.mag_v);
+    m_color_bv.push_back(star.color_bv);
+    m_catalog_id.push_back(star.catalog_id);
+}
+
+void StarCatalogSoA::clear()
+{
+    m_direction_x.clear();
+    m_direction_y.clear();
+    m_direction_z.clear();
+    m_ra.clear();
+    m_dec.clear();
+    m_mag_v.clear();
+    m_color_bv.clear();
+    m_catalog_id.clear();
+}
+
+StarEntry StarCatalogSoA::get_entry(std::size_t index) const
+{
+    return StarEntry{
+        .ra         = m_ra[index],
+        .dec        = m_dec[index],
+        .mag_v      = m_mag_v[index],
+        .color_bv   = m_color_bv[index],
+        .catalog_id = m_catalog_id[index],
+    };
+}
+
+// -----------------------------------------------------------------
+// RA/Dec → unit vector
+// -----------------------------------------------------------------
+
+Vec3d StarCatalogSoA::direction_of(const StarEntry& star)
+{
+    const f64 cos_dec = std::cos(star.dec);
+    return Vec3d{cos_dec * std::cos(star.ra), cos_dec * std::sin(star.ra), std::sin(star.dec)};
+}
+
+} // namespace parallax::catalog
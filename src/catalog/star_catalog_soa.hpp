@@ -0,0 +1,96 @@
+#pragma once
+
+/// @file star_catalog_soa.hpp
+/// @brief Structure-of-arrays star storage for per-frame streaming.
+
+#include "catalog/star_entry.hpp"
+#include "core/aligned_allocator.hpp"
+#include "core/types.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace parallax::catalog
+{
+    /// @brief Half-open range [begin, end) of star indices.
+    struct StarRange
+    {
+        u32 begin = 0;
+        u32 end = 0;
+
+        [[nodiscard]] u32 size() const { return end - begin; }
+        [[nodiscard]] bool empty() const { return begin == end; }
+    };
+
+    /// @brief Star catalog stored one column per field.
+    ///
+    /// StarEntry is 32 bytes, but a frame only reads position, magnitude and
+    /// color. Keeping each field in its own contiguous, cache-line aligned
+    /// array lets the per-frame loop stream just those columns and lets the
+    /// compiler vectorize over consecutive stars. Row i of every column
+    /// describes the same star.
+    ///
+    /// The J2000 unit vector of each star is derived once on insertion, so
+    /// per-frame code rotates vectors instead of evaluating trig on RA/Dec.
+    /// Its components are three separate columns, so a batch loads x, y and
+    /// z of consecutive stars as contiguous f64 lanes.
+    class StarCatalogSoA
+    {
+    public:
+        static constexpr std::size_t kAlignment = 64;
+
+        template <typename T>
+        using Column = std::vector<T, core::AlignedAllocator<T, kAlignment>>;
+
+        StarCatalogSoA() = default;
+
+        /// @brief Convert loader output (AoS) into columns, preserving order.
+        [[nodiscard]] static StarCatalogSoA from_entries(std::span<const StarEntry> stars);
+
+        void reserve(std::size_t count);
+        void push_back(const StarEntry& star);
+        void clear();
+
+        /// @brief Reassemble row i as a StarEntry.
+        [[nodiscard]] StarEntry get_entry(std::size_t index) const;
+
+        [[nodiscard]] std::size_t size() const { return m_ra.size(); }
+        [[nodiscard]] bool empty() const { return m_ra.empty(); }
+
+        // -----------------------------------------------------------------
+        // Columns
+        // -----------------------------------------------------------------
+
+        /// @brief Components of the equatorial unit vectors, same convention as
+        /// astro::Coordinates::equatorial_to_unit_vector.
+        [[nodiscard]] std::span<const f64> get_direction_x() const { return m_direction_x; }
+        [[nodiscard]] std::span<const f64> get_direction_y() const { return m_direction_y; }
+        [[nodiscard]] std::span<const f64> get_direction_z() const { return m_direction_z; }
+
+        /// @brief Row i of the direction columns as a vector.
+        [[nodiscard]] Vec3d get_direction(std::size_t index) const
+        {
+            return Vec3d{m_direction_x[index], m_direction_y[index], m_direction_z[index]};
+        }
+
+        [[nodiscard]] std::span<const f64> get_ra() const { return m_ra; }
+        [[nodiscard]] std::span<const f64> get_dec() const { return m_dec; }
+        [[nodiscard]] std::span<const f32> get_mag_v() const { return m_mag_v; }
+        [[nodiscard]] std::span<const f32> get_color_bv() const { return m_color_bv; }
+        [[nodiscard]] std::span<const u32> get_catalog_id() const { return m_catalog_id; }
+
+    private:
+        [[nodiscard]] static Vec3d direction_of(const StarEntry& star);
+
+        Column<f64> m_direction_x;  ///< J2000 unit vector x (→ RA 0h)
+        Column<f64> m_direction_y;  ///< J2000 unit vector y (→ RA 6h)
+        Column<f64> m_direction_z;  ///< J2000 unit vector z (→ north pole)
+        Column<f64> m_ra;           ///< Right ascension (radians)
+        Column<f64> m_dec;          ///< Declination (radians)
+        Column<f32> m_mag_v;        ///< Visual magnitude
+        Column<f32> m_color_bv;     ///< B-V color index
+        Column<u32> m_catalog_id;   ///< Source catalog ID
+    };
+
+} // namespace parallax::catalog
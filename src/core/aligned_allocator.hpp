@@ -0,0 +1,54 @@
+#pragma once
+
+/// @file aligned_allocator.hpp
+/// @brief std::allocator replacement with over-aligned storage (cache line / SIMD width).
+
+#include <cstddef>
+#include <new>
+
+namespace parallax::core
+{
+    /// @brief Allocator whose blocks start on an `Alignment`-byte boundary.
+    ///
+    /// Used for SoA columns so every column begins on a cache line and
+    /// vector loads of the first elements never straddle one.
+    template <typename T, std::size_t Alignment = 64>
+    class AlignedAllocator
+    {
+    public:
+        using value_type = T;
+
+        static_assert(Alignment >= alignof(T), "Alignment weaker than the type's own");
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>& /*other*/) noexcept
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+        }
+
+        void deallocate(T* ptr, std::size_t /*count*/) noexcept
+        {
+            ::operator delete(ptr, std::align_val_t{Alignment});
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>& /*other*/) const noexcept
+        {
+            return true;
+        }
+    };
+
+} // namespace parallax::core
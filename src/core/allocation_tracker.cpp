@@ -0,0 +1,245 @@
+/// @file allocation_tracker.cpp
+/// @brief Counting replacements for the global operator new/delete family.
+
+#include "core/allocation_tracker.hpp"
+
+#include "core/types.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef PLX_PLATFORM_WINDOWS
+    #include <malloc.h>
+#endif
+
+#if PLX_ENABLE_ALLOCATION_TRACKER
+
+namespace
+{
+    constinit std::atomic<parallax::u64> g_allocations{0};
+    constinit std::atomic<parallax::u64> g_deallocations{0};
+
+    void* counted_malloc(std::size_t size) noexcept
+    {
+        void* pointer = std::malloc(size == 0 ? 1 : size);
+        if (pointer != nullptr)
+        {
+            g_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        return pointer;
+    }
+
+    void* counted_aligned_malloc(std::size_t size, std::align_val_t alignment) noexcept
+    {
+        const auto align = static_cast<std::size_t>(alignment);
+#ifdef PLX_PLATFORM_WINDOWS
+        void* pointer = _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+        // aligned_alloc wants the size to be a multiple of the alignment
+        const std::size_t rounded = ((size == 0 ? 1 : size) + align - 1) / align * align;
+        void* pointer = std::aligned_alloc(align, rounded);
+#endif
+        if (pointer != nullptr)
+        {
+            g_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        return pointer;
+    }
+
+    /// The standard operator new loop: on failure call the installed
+    /// new_handler (which may free memory) and retry; throw once none is set.
+    template <typename Allocate>
+    void* allocate_or_throw(Allocate&& allocate)
+    {
+        for (;;)
+        {
+            if (void* pointer = allocate())
+            {
+                return pointer;
+            }
+            const std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+    void counted_free(void* pointer) noexcept
+    {
+        if (pointer != nullptr)
+        {
+            g_deallocations.fetch_add(1, std::memory_order_relaxed);
+            std::free(pointer);
+        }
+    }
+
+    void counted_aligned_free(void* pointer) noexcept
+    {
+        if (pointer != nullptr)
+        {
+            g_deallocations.fetch_add(1, std::memory_order_relaxed);
+#ifdef PLX_PLATFORM_WINDOWS
+            _aligned_free(pointer);
+#else
+            std::free(pointer);
+#endif
+        }
+    }
+
+} // anonymous namespace
+
+namespace parallax::core
+{
+
+u64 AllocationTracker::get_allocation_count()
+{
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+u64 AllocationTracker::get_deallocation_count()
+{
+    return g_deallocations.load(std::memory_order_relaxed);
+}
+
+} // namespace parallax::core
+
+// -----------------------------------------------------------------
+// Replacement operators (global namespace, one definition per program)
+// -----------------------------------------------------------------
+
+void* operator new(std::size_t size)
+{
+    return allocate_or_throw([size] { return counted_malloc(size); });
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+// nothrow forms run the same new_handler loop and report failure as nullptr
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept
+{
+    try
+    {
+        return ::operator new(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return ::operator new(size, tag);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate_or_throw([size, alignment] { return counted_aligned_malloc(size, alignment); });
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return ::operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept
+{
+    try
+    {
+        return ::operator new(size, alignment);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return ::operator new(size, alignment, tag);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t& /*tag*/) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t& /*tag*/) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept
+{
+    counted_aligned_free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t /*alignment*/) noexcept
+{
+    counted_aligned_free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+    counted_aligned_free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+    counted_aligned_free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/, const std::nothrow_t& /*tag*/) noexcept
+{
+    counted_aligned_free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t /*alignment*/, const std::nothrow_t& /*tag*/) noexcept
+{
+    counted_aligned_free(pointer);
+}
+
+#else // !PLX_ENABLE_ALLOCATION_TRACKER
+
+namespace parallax::core
+{
+
+u64 AllocationTracker::get_allocation_count()
+{
+    return 0;
+}
+
+u64 AllocationTracker::get_deallocation_count()
+{
+    return 0;
+}
+
+} // namespace parallax::core
+
+#endif // PLX_ENABLE_ALLOCATION_TRACKER
@@ -0,0 +1,46 @@
+#pragma once
+
+/// @file allocation_tracker.hpp
+/// @brief Process-wide heap allocation counters (replaces global operator new/delete).
+///
+/// Build with -DPLX_ENABLE_ALLOCATION_TRACKER=ON to count (the default in
+/// Debug builds). When OFF the replacement operators are not compiled, the
+/// toolchain's allocator is used unchanged and both counters stay at 0.
+
+#include "core/types.hpp"
+
+#ifndef PLX_ENABLE_ALLOCATION_TRACKER
+    #ifdef NDEBUG
+        #define PLX_ENABLE_ALLOCATION_TRACKER 0
+    #else
+        #define PLX_ENABLE_ALLOCATION_TRACKER 1
+    #endif
+#endif
+
+namespace parallax::core
+{
+    /// @brief Counts every C++ heap allocation made by the process.
+    ///
+    /// Linking allocation_tracker.cpp replaces the global operator new/delete
+    /// family with malloc/free wrappers that bump two relaxed atomics. Sample
+    /// get_allocation_count() before and after a region of code to check that
+    /// it does not allocate (e.g. a steady-state frame).
+    ///
+    /// Only operator new is seen: C allocations (malloc from the Vulkan
+    /// loader, SDL, drivers) are not counted.
+    class AllocationTracker
+    {
+    public:
+        AllocationTracker() = delete;
+
+        /// @brief True if the counting operators are compiled in.
+        static constexpr bool kEnabled = PLX_ENABLE_ALLOCATION_TRACKER != 0;
+
+        /// @brief operator new calls (all forms) since startup.
+        [[nodiscard]] static u64 get_allocation_count();
+
+        /// @brief operator delete calls with a non-null pointer since startup.
+        [[nodiscard]] static u64 get_deallocation_count();
+    };
+
+} // namespace parallax::core
@@ -3,10 +3,12 @@
 
 #include "core/application.hpp"
 
-#include "catalog/catalog_loader.hpp"
+#include "core/allocation_tracker.hpp"
+#include "core/scene_setup.hpp"
 
 #include <glm/trigonometric.hpp>
 
+#include <algorithm>
 #include <cstdlib>
 #include <filesystem>
 #include <limits>
@@ -28,7 +30,8 @@ void check_vk(VkResult result, const char* operation)
 namespace parallax::core
 {
 
-Application::Application()
+Application::Application(u32 frames_in_flight)
+    : m_frames_in_flight{std::clamp(frames_in_flight, 1u, kMaxFramesInFlight)}
 {
     init();
 }
@@ -75,27 +78,31 @@ void Application::init()
     std::filesystem::path shader_dir{PLX_SHADER_DIR};
     PLX_CORE_INFO("Shader directory: {}", shader_dir.string());
     m_pipeline = std::make_unique<vulkan::Pipeline>(*m_context, *m_swapchain, shader_dir);
+    m_gpu_profiler = std::make_unique<vulkan::GpuProfiler>(*m_context, m_frames_in_flight);
 
-    // 6. Starfield renderer (uses Pipeline's render pass)
+    // 6. Job system (per-frame CPU work) + Starfield renderer (uses Pipeline's render pass) + ephemeris
+    m_jobs = std::make_unique<JobSystem>();
+    m_frame_arena = std::make_unique<FrameArena>(kFrameArenaBytes, m_frames_in_flight);
     m_starfield = std::make_unique<rendering::Starfield>(
-        *m_context, m_pipeline->get_render_pass(), shader_dir);
+        *m_context, *m_jobs, m_pipeline->get_render_pass(), shader_dir, m_frames_in_flight);
+    m_ephemeris = std::make_unique<astro::Ephemeris>(*m_jobs);
 
     // 7. Camera
     m_camera = std::make_unique<rendering::Camera>();
 
-    // 8. Load star catalog
-    const std::filesystem::path catalog_path{"data/catalogs/bright_stars.csv"};
-    auto loaded_stars = catalog::CatalogLoader::load_bright_star_csv(catalog_path);
-    if (loaded_stars.has_value())
-    {
-        m_stars = std::move(loaded_stars.value());
-        PLX_CORE_INFO("Star catalog loaded: {} stars from {}", m_stars.size(), catalog_path.string());
-    }
-    else
-    {
-        PLX_CORE_WARN("Failed to load star catalog from {}. Rendering will show no stars.",
-                      catalog_path.string());
-    }
+    // 8. Load star catalog (binary .plxcat if present, CSV fallback)
+    m_catalog_manager = std::make_unique<catalog::CatalogManager>();
+
+    // Split into magnitude layers, each bucketed by HEALPix pixel, so Starfield
+    // only visits pixels under the view in layers brighter than the limit
+    m_star_layers = std::make_unique<catalog::MagnitudeFilter>(kCatalogNside, *m_jobs);
+    load_default_star_catalog(*m_catalog_manager, *m_star_layers);
+
+    // Resident copy for the GPU compute path (G toggles it at runtime)
+    m_starfield->upload_catalog(*m_star_layers, shader_dir);
+
+    // All pipelines exist now: report what the on-disk cache saved
+    m_context->get_pipeline_cache().log_startup();
 
     // 9. Observer location: La Palma, Canary Islands (28.76°N, 17.89°W)
     m_observer = astro::ObserverLocation{
@@ -104,12 +111,13 @@ void Application::init()
     };
 
     // 10. Simulation time: current system UTC
-    m_julian_date = astro::TimeSystem::now_as_jd();
+    m_julian_date = astro::TimeSystem::now_as_julian_date();
     m_time_scale = 1.0;
+    load_default_earth_orientation(m_time_scales);
     {
         const auto dt = astro::TimeSystem::from_julian_date(m_julian_date);
         PLX_CORE_INFO("Simulation start: JD {:.6f} ({:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:04.1f} UTC)",
-                      m_julian_date, dt.year, dt.month, dt.day, dt.hour, dt.minute, dt.second);
+                      m_julian_date.get_jd(), dt.year, dt.month, dt.day, dt.hour, dt.minute, dt.second);
         PLX_CORE_INFO("Observer: La Palma ({:.2f}N, {:.2f}W)",
                       glm::degrees(m_observer.latitude_rad),
                       -glm::degrees(m_observer.longitude_rad));
@@ -141,6 +149,25 @@ void Application::shutdown()
 
     m_context->wait_idle();
 
+    if constexpr (AllocationTracker::kEnabled)
+    {
+        PLX_CORE_INFO("Heap allocations in {} steady-state frames: {} (frame arena peak {} / {} KiB)",
+                      m_frame_count > kWarmupFrames ? m_frame_count - kWarmupFrames : 0,
+                      m_steady_state_allocations,
+                      m_frame_arena ? m_frame_arena->get_peak() / 1024 : 0,
+                      kFrameArenaBytes / 1024);
+    }
+    else
+    {
+        PLX_CORE_INFO("Heap allocations not tracked (PLX_ENABLE_ALLOCATION_TRACKER=OFF); "
+                      "frame arena peak {} / {} KiB",
+                      m_frame_arena ? m_frame_arena->get_peak() / 1024 : 0,
+                      kFrameArenaBytes / 1024);
+    }
+    m_context->get_allocator().log_usage();
+    m_gpu_profiler->collect_pending();
+    m_gpu_profiler->log_stats();
+
     destroy_sync_objects();
 
     // Command pool (implicitly frees command buffers)
@@ -151,8 +178,13 @@ void Application::shutdown()
         PLX_CORE_TRACE("Command pool destroyed");
     }
 
-    // Reverse creation order: starfield → pipeline → swapchain → context → window
+    // Reverse creation order: layers → starfield → ephemeris → jobs → pipeline → swapchain → context → window
+    m_star_layers.reset();
     m_starfield.reset();
+    m_ephemeris.reset();
+    m_frame_arena.reset();
+    m_jobs.reset();
+    m_gpu_profiler.reset();
     m_pipeline.reset();
     m_swapchain.reset();
     m_context.reset();
@@ -206,6 +238,20 @@ void Application::main_loop()
         // Clamp delta to avoid huge jumps (e.g., after a breakpoint)
         const f64 clamped_dt = std::min(delta_time_sec, 0.1);
 
+        // Wait for this frame slot's fence (previous use of this slot) before
+        // the CPU touches anything the slot owns: the starfield writes its
+        // region of the instance ring during update_simulation()
+        check_vk(
+            vkWaitForFences(m_context->get_device(), 1, &m_in_flight_fences[m_current_frame],
+                            VK_TRUE, std::numeric_limits<uint64_t>::max()),
+            "vkWaitForFences");
+
+        // Everything from here to the end of the frame should stay off the
+        // heap: per-frame scratch comes from the arena
+        const u64 allocations_before = AllocationTracker::get_allocation_count();
+        m_frame_arena->begin_frame(m_current_frame);
+        m_context->get_allocator().begin_frame(static_cast<u32>(m_frame_count));
+
         // -----------------------------------------------------------------
         // 4. Process input → Camera/simulation
         // -----------------------------------------------------------------
@@ -220,6 +266,11 @@ void Application::main_loop()
         // 6. Render
         // -----------------------------------------------------------------
         draw_frame();
+
+        if (++m_frame_count > kWarmupFrames)
+        {
+            m_steady_state_allocations += AllocationTracker::get_allocation_count() - allocations_before;
+        }
     }
 
     m_context->wait_idle();
@@ -280,6 +331,24 @@ void Application::process_input()
         PLX_CORE_INFO("Camera reset to defaults");
     }
 
+    // -----------------------------------------------------------------
+    // G → toggle CPU / GPU compute star transform
+    // -----------------------------------------------------------------
+    if (m_input->is_key_pressed(SDL_SCANCODE_G))
+    {
+        m_starfield->set_path(m_starfield->get_path() == rendering::StarfieldPath::Cpu
+                                  ? rendering::StarfieldPath::GpuCompute
+                                  : rendering::StarfieldPath::Cpu);
+    }
+
+    // -----------------------------------------------------------------
+    // P → log GPU pass timings
+    // -----------------------------------------------------------------
+    if (m_input->is_key_pressed(SDL_SCANCODE_P))
+    {
+        m_gpu_profiler->log_stats();
+    }
+
     // -----------------------------------------------------------------
     // Escape → quit
     // -----------------------------------------------------------------
@@ -296,20 +365,37 @@ void Application::process_input()
 void Application::update_simulation(f64 delta_time_sec)
 {
     // -----------------------------------------------------------------
-    // Advance Julian Date (JD is in days, delta_time is in seconds)
+    // Advance Julian Date (the seconds counter takes the step exactly)
+    // -----------------------------------------------------------------
+    m_julian_date += delta_time_sec * m_time_scale;
+
+    // -----------------------------------------------------------------
+    // Time scales: TT for precession and ephemerides, UT1 for Earth
+    // rotation (leap seconds, ΔT and DUT1 cached for the current day)
     // -----------------------------------------------------------------
-    m_julian_date += (delta_time_sec * m_time_scale) / 86400.0;
+    m_time_scales.update(m_julian_date);
+    const astro::FrameTimes& times = m_time_scales.get_frame();
 
     // -----------------------------------------------------------------
-    // Compute Local Sidereal Time
+    // Earth orientation: precession-nutation (rebuilt every few minutes
+    // of simulated time) and Earth rotation (every frame)
     // -----------------------------------------------------------------
-    const f64 lst = astro::TimeSystem::lmst(m_julian_date, m_observer.longitude_rad);
+    m_precession.update(times.ut1, times.tt);
+
+    // Solar-system bodies: refits run on a job once a window runs out
+    m_ephemeris->update(times.tt.get_jd());
 
     // -----------------------------------------------------------------
-    // Transform all catalog stars and upload to GPU
-    // (Starfield::update does: RA/Dec → Alt/Az → screen + brightness)
+    // Transform catalog stars in view and upload to GPU
+    // (Starfield::update does: FOV pixel query per magnitude layer → J2000 → Alt/Az → screen + brightness)
+    // The CPU path needs the layers the limit reaches; the GPU path has its own copy
     // -----------------------------------------------------------------
-    m_starfield->update(m_stars, m_observer, lst, *m_camera);
+    if (m_starfield->get_path() == rendering::StarfieldPath::Cpu)
+    {
+        m_star_layers->set_magnitude_limit(m_camera->get_magnitude_limit());
+    }
+    m_starfield->update(*m_star_layers, m_precession.get_celestial_to_horizontal(m_observer),
+                        *m_camera, *m_frame_arena, m_current_frame);
 }
 
 // =================================================================
@@ -321,11 +407,8 @@ void Application::draw_frame()
     VkDevice device = m_context->get_device();
 
     // -----------------------------------------------------------------
-    // 1. Wait for this frame slot's fence (previous use of this slot)
+    // 1. This frame slot's fence was already waited on in main_loop()
     // -----------------------------------------------------------------
-    check_vk(
-        vkWaitForFences(device, 1, &m_in_flight_fences[m_current_frame], VK_TRUE, std::numeric_limits<uint64_t>::max()),
-        "vkWaitForFences");
 
     // -----------------------------------------------------------------
     // 2. Acquire next swapchain image
@@ -365,13 +448,25 @@ void Application::draw_frame()
     // -----------------------------------------------------------------
     // 4. Submit to graphics queue
     // -----------------------------------------------------------------
-    VkSemaphore wait_semaphores[] = {m_image_available_semaphores[m_current_frame]};
-    VkPipelineStageFlags wait_stages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
+    // Second wait (staged uploads only): the starfield's copy to VRAM,
+    // needed from the vertex stage on. Binary semaphores ignore their value
+    const u64 upload_value = m_starfield->get_upload_value(m_current_frame);
+    VkSemaphore wait_semaphores[] = {m_image_available_semaphores[m_current_frame],
+                                     m_starfield->get_upload_semaphore()};
+    VkPipelineStageFlags wait_stages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                          VK_PIPELINE_STAGE_VERTEX_SHADER_BIT};
+    const u64 wait_values[] = {0, upload_value};
     VkSemaphore signal_semaphores[] = {m_render_finished_semaphores[image_index]};
 
+    VkTimelineSemaphoreSubmitInfo timeline_info{};
+    timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timeline_info.waitSemaphoreValueCount = 2;
+    timeline_info.pWaitSemaphoreValues = wait_values;
+
     VkSubmitInfo submit_info{};
     submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info.waitSemaphoreCount = 1;
+    submit_info.pNext = (upload_value != 0) ? &timeline_info : nullptr;
+    submit_info.waitSemaphoreCount = (upload_value != 0) ? 2 : 1;
     submit_info.pWaitSemaphores = wait_semaphores;
     submit_info.pWaitDstStageMask = wait_stages;
     submit_info.commandBufferCount = 1;
@@ -414,7 +509,7 @@ void Application::draw_frame()
     // -----------------------------------------------------------------
     // 6. Advance frame-in-flight index
     // -----------------------------------------------------------------
-    m_current_frame = (m_current_frame + 1) % kMaxFramesInFlight;
+    m_current_frame = (m_current_frame + 1) % m_frames_in_flight;
 }
 
 // =================================================================
@@ -428,6 +523,15 @@ void Application::record_command_buffer(VkCommandBuffer cmd, uint32_t image_inde
 
     check_vk(vkBeginCommandBuffer(cmd, &begin_info), "vkBeginCommandBuffer");
 
+    // Collects this slot's timings from its previous use (fence already waited)
+    m_gpu_profiler->begin_frame(cmd, m_current_frame);
+
+    // GPU compute path: cull into the instance buffer before the pass
+    {
+        PLX_GPU_SCOPE(*m_gpu_profiler, cmd, "star_cull");
+        m_starfield->record_compute(cmd);
+    }
+
     // Clear to near-black with a hint of deep blue
     VkClearValue clear_color{};
     clear_color.color = {{0.0f, 0.0f, 0.02f, 1.0f}};
@@ -443,6 +547,7 @@ void Application::record_command_buffer(VkCommandBuffer cmd, uint32_t image_inde
     render_pass_info.clearValueCount = 1;
     render_pass_info.pClearValues = &clear_color;
 
+    const u32 pass_scope = m_gpu_profiler->begin_scope(cmd, "main_pass");
     vkCmdBeginRenderPass(cmd, &render_pass_info, VK_SUBPASS_CONTENTS_INLINE);
 
     // Dynamic viewport
@@ -466,9 +571,13 @@ void Application::record_command_buffer(VkCommandBuffer cmd, uint32_t image_inde
     // Starfield::draw() binds its own pipeline, descriptor set, push
     // constants, and issues vkCmdDraw(1, star_count, 0, 0)
     // -----------------------------------------------------------------
-    m_starfield->draw(cmd);
+    {
+        PLX_GPU_SCOPE(*m_gpu_profiler, cmd, "starfield_draw");
+        m_starfield->draw(cmd, m_current_frame);
+    }
 
     vkCmdEndRenderPass(cmd);
+    m_gpu_profiler->end_scope(cmd, pass_scope);
 
     check_vk(vkEndCommandBuffer(cmd), "vkEndCommandBuffer");
 }
@@ -540,19 +649,19 @@ void Application::create_command_pool()
 
 void Application::create_command_buffers()
 {
-    m_command_buffers.resize(kMaxFramesInFlight);
+    m_command_buffers.resize(m_frames_in_flight);
 
     VkCommandBufferAllocateInfo alloc_info{};
     alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
     alloc_info.commandPool = m_command_pool;
     alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    alloc_info.commandBufferCount = kMaxFramesInFlight;
+    alloc_info.commandBufferCount = m_frames_in_flight;
 
     check_vk(
         vkAllocateCommandBuffers(m_context->get_device(), &alloc_info, m_command_buffers.data()),
         "vkAllocateCommandBuffers");
 
-    PLX_CORE_INFO("Command buffers allocated: {}", kMaxFramesInFlight);
+    PLX_CORE_INFO("Command buffers allocated: {}", m_frames_in_flight);
 }
 
 // =================================================================
@@ -571,7 +680,7 @@ void Application::create_sync_objects()
     fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
     // Per-frame-in-flight: image_available semaphores + fences
-    for (uint32_t i = 0; i < kMaxFramesInFlight; ++i)
+    for (uint32_t i = 0; i < m_frames_in_flight; ++i)
     {
         check_vk(
             vkCreateSemaphore(device, &semaphore_info, nullptr, &m_image_available_semaphores[i]),
@@ -593,7 +702,7 @@ void Application::create_sync_objects()
     }
 
     PLX_CORE_INFO("Sync objects created: {} frames in flight, {} image semaphores",
-                  kMaxFramesInFlight, image_count);
+                  m_frames_in_flight, image_count);
 }
 
 void Application::destroy_sync_objects()
@@ -609,7 +718,7 @@ void Application::destroy_sync_objects()
     }
     m_render_finished_semaphores.clear();
 
-    for (uint32_t i = 0; i < kMaxFramesInFlight; ++i)
+    for (uint32_t i = 0; i < m_frames_in_flight; ++i)
     {
         if (m_image_available_semaphores[i] != VK_NULL_HANDLE)
         {
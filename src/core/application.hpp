@@ -4,14 +4,24 @@
 /// @brief Main application class — lifecycle, main loop, frame rendering.
 
 #include "astro/coordinates.hpp"
+#include "astro/ephemeris.hpp"
+#include "astro/julian_date.hpp"
+#include "astro/precession.hpp"
+#include "astro/time_scales.hpp"
 #include "astro/time_system.hpp"
+#include "catalog/catalog_manager.hpp"
+#include "catalog/magnitude_filter.hpp"
 #include "catalog/star_entry.hpp"
+#include "core/command_line.hpp"
+#include "core/frame_arena.hpp"
 #include "core/input.hpp"
+#include "core/job_system.hpp"
 #include "core/types.hpp"
 #include "core/window.hpp"
 #include "rendering/camera.hpp"
 #include "rendering/starfield.hpp"
 #include "vulkan/context.hpp"
+#include "vulkan/gpu_profiler.hpp"
 #include "vulkan/pipeline.hpp"
 #include "vulkan/swapchain.hpp"
 
@@ -28,14 +38,17 @@ namespace parallax::core
     /// @brief Top-level application class that owns all subsystems and drives the main loop.
     ///
     /// Lifecycle: init() in constructor → run() drives main_loop() → shutdown() in destructor.
-    /// Frame rendering uses 2 frames in flight with per-frame fences and semaphores.
+    /// Frame rendering uses 2 frames in flight by default (1–3 with
+    /// --frames-in-flight) with per-frame fences and semaphores.
     /// Render-finished semaphores are per-swapchain-image to avoid reuse conflicts
     /// with the presentation engine.
     class Application
     {
     public:
         /// @brief Initialize all subsystems: window, Vulkan context, swapchain, pipeline, sync.
-        Application();
+        /// @param frames_in_flight Frames the CPU may record ahead of the GPU
+        ///                         (1..kMaxFramesInFlight).
+        explicit Application(u32 frames_in_flight);
 
         /// @brief Shut down all subsystems in reverse creation order.
         ~Application();
@@ -66,7 +79,15 @@ namespace parallax::core
 
         void record_command_buffer(VkCommandBuffer cmd, uint32_t image_index);
 
-        static constexpr uint32_t kMaxFramesInFlight = 2;
+        /// Upper bound on m_frames_in_flight; fixed-size per-frame arrays use it
+        static constexpr uint32_t kMaxFramesInFlight = CommandLine::kMaxFramesInFlight;
+
+        /// Scratch per frame in flight: Starfield's worst-case work list
+        /// (7 layers × full sky at nside 64 ≈ 7 MB) plus candidate vertices
+        static constexpr std::size_t kFrameArenaBytes = 16u << 20;
+
+        /// Frames after startup before heap allocations count as steady state
+        static constexpr u64 kWarmupFrames = 120;
 
         // -----------------------------------------------------------------
         // Subsystems (created in init order, destroyed in reverse)
@@ -75,6 +96,9 @@ namespace parallax::core
         std::unique_ptr<vulkan::Context> m_context;
         std::unique_ptr<vulkan::Swapchain> m_swapchain;
         std::unique_ptr<vulkan::Pipeline> m_pipeline;       ///< Render pass + framebuffers (from Sprint 01)
+        std::unique_ptr<vulkan::GpuProfiler> m_gpu_profiler; ///< Timestamp queries per frame in flight
+        std::unique_ptr<JobSystem> m_jobs;                  ///< Worker threads for per-frame CPU work
+        std::unique_ptr<FrameArena> m_frame_arena;          ///< Per-frame scratch, one region per frame in flight
         std::unique_ptr<rendering::Starfield> m_starfield;
         std::unique_ptr<rendering::Camera> m_camera;
         std::unique_ptr<Input> m_input;
@@ -82,14 +106,20 @@ namespace parallax::core
         // -----------------------------------------------------------------
         // Star catalog
         // -----------------------------------------------------------------
-        std::vector<catalog::StarEntry> m_stars;
+        std::unique_ptr<catalog::CatalogManager> m_catalog_manager;   ///< Memory-mapped .plxcat files
+        std::unique_ptr<catalog::MagnitudeFilter> m_star_layers;      ///< Magnitude layers, each HEALPix-bucketed
+
+        static constexpr u32 kCatalogNside = 64;   ///< ~0.84 deg² pixels (Phase 1)
 
         // -----------------------------------------------------------------
         // Simulation state
         // -----------------------------------------------------------------
-        f64 m_julian_date = 0.0;            ///< Current simulation time (JD)
+        astro::JulianDate m_julian_date;    ///< Current simulation time (UTC), split so frame steps never drift
         f64 m_time_scale = 1.0;             ///< 1.0 = real-time, 0.0 = paused
+        astro::TimeScales m_time_scales;     ///< UTC → TAI/TT/UT1, this frame's day cached
         astro::ObserverLocation m_observer;  ///< Observer geographic location
+        astro::Precession m_precession;      ///< J2000 → of-date → terrestrial, cached across frames
+        std::unique_ptr<astro::Ephemeris> m_ephemeris;  ///< Sun/Moon/planets, refitted on m_jobs
 
         /// @brief Wall-clock time tracking for delta_time computation.
         std::chrono::steady_clock::time_point m_last_frame_time;
@@ -113,7 +143,14 @@ namespace parallax::core
         // -----------------------------------------------------------------
         std::vector<VkSemaphore> m_render_finished_semaphores;
 
+        /// CPU may record this many frames ahead of the GPU; per-frame
+        /// resources (fences, command buffers, arena, star ring) are sized by it
+        uint32_t m_frames_in_flight;
         uint32_t m_current_frame = 0;
+
+        // Heap allocations (operator new) in frames after warm-up; expected 0
+        u64 m_frame_count = 0;
+        u64 m_steady_state_allocations = 0;
         bool m_framebuffer_resized = false;
     };
 
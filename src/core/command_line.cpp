@@ -0,0 +1,170 @@
+/// @file command_line.cpp
+/// @brief Command-line parsing.
+
+#include "core/command_line.hpp"
+
+#include "core/logger.hpp"
+
+#include <charconv>
+#include <string>
+#include <system_error>
+
+namespace
+{
+
+template <typename T>
+bool parse_number(std::string_view text, T& out)
+{
+    const char* end = text.data() + text.size();
+    const auto [ptr, ec] = std::from_chars(text.data(), end, out);
+    return ec == std::errc{} && ptr == end;
+}
+
+} // anonymous namespace
+
+namespace parallax::core
+{
+
+std::optional<CommandLine> parse_command_line(std::span<const std::string_view> args)
+{
+    CommandLine result;
+    HeadlessConfig& config = result.headless_config;
+
+    for (std::size_t i = 0; i < args.size(); ++i)
+    {
+        const std::string_view option = args[i];
+
+        // -----------------------------------------------------------------
+        // Flags
+        // -----------------------------------------------------------------
+        if (option == "--help" || option == "-h")
+        {
+            result.help = true;
+            continue;
+        }
+        if (option == "--headless")
+        {
+            result.headless = true;
+            continue;
+        }
+        if (option == "--gpu-cull")
+        {
+            config.gpu_cull = true;
+            continue;
+        }
+        if (option == "--no-output")
+        {
+            config.output_dir.reset();
+            continue;
+        }
+
+        // -----------------------------------------------------------------
+        // Options with a value
+        // -----------------------------------------------------------------
+        if (i + 1 >= args.size())
+        {
+            PLX_CORE_ERROR("Unknown option or missing value: {}", option);
+            return std::nullopt;
+        }
+        const std::string_view value = args[++i];
+
+        bool ok = true;
+        if (option == "--width")
+        {
+            ok = parse_number(value, config.width) && config.width > 0;
+        }
+        else if (option == "--height")
+        {
+            ok = parse_number(value, config.height) && config.height > 0;
+        }
+        else if (option == "--frames")
+        {
+            ok = parse_number(value, config.frames) && config.frames > 0;
+        }
+        else if (option == "--jd")
+        {
+            f64 jd = 0.0;
+            ok = parse_number(value, jd);
+            config.julian_date = jd;
+        }
+        else if (option == "--time-step")
+        {
+            ok = parse_number(value, config.time_step_sec);
+        }
+        else if (option == "--lat")
+        {
+            ok = parse_number(value, config.latitude_deg)
+                 && config.latitude_deg >= -90.0 && config.latitude_deg <= 90.0;
+        }
+        else if (option == "--lon")
+        {
+            ok = parse_number(value, config.longitude_deg)
+                 && config.longitude_deg >= -180.0 && config.longitude_deg <= 360.0;
+        }
+        else if (option == "--alt")
+        {
+            ok = parse_number(value, config.altitude_deg)
+                 && config.altitude_deg >= -90.0 && config.altitude_deg <= 90.0;
+        }
+        else if (option == "--az")
+        {
+            ok = parse_number(value, config.azimuth_deg);
+        }
+        else if (option == "--fov")
+        {
+            ok = parse_number(value, config.fov_deg) && config.fov_deg > 0.0;
+        }
+        else if (option == "--frames-in-flight")
+        {
+            ok = parse_number(value, result.frames_in_flight)
+                 && result.frames_in_flight >= 1 && result.frames_in_flight <= CommandLine::kMaxFramesInFlight;
+        }
+        else if (option == "--output")
+        {
+            config.output_dir = std::filesystem::path{std::string{value}};
+        }
+        else
+        {
+            PLX_CORE_ERROR("Unknown option: {}", option);
+            return std::nullopt;
+        }
+
+        if (!ok)
+        {
+            PLX_CORE_ERROR("Invalid value for {}: {}", option, value);
+            return std::nullopt;
+        }
+    }
+
+    return result;
+}
+
+std::string_view get_usage()
+{
+    return "Usage: parallax [--headless [options]]\n"
+           "\n"
+           "Without --headless, opens the interactive window.\n"
+           "\n"
+           "Headless rendering (no window, no swapchain):\n"
+           "  --headless          Render offscreen and write images\n"
+           "  --frames N          Frames to render (1)\n"
+           "  --width W           Image width in pixels (1920)\n"
+           "  --height H          Image height in pixels (1080)\n"
+           "  --jd JD             Start time as a UTC Julian Date (now)\n"
+           "  --time-step S       Simulated seconds between frames (0)\n"
+           "  --lat DEG           Observer latitude (28.76)\n"
+           "  --lon DEG           Observer longitude, east positive (-17.89)\n"
+           "  --alt DEG           Camera altitude (45)\n"
+           "  --az DEG            Camera azimuth, north = 0, east = 90 (0)\n"
+           "  --fov DEG           Field of view (60)\n"
+           "  --gpu-cull          Use the compute-shader star path\n"
+           "  --output DIR        Directory for frame_NNNN.ppm (renders)\n"
+           "  --no-output         Render without writing images (benchmarking)\n"
+           "\n"
+           "Window options:\n"
+           "  --frames-in-flight N  Frames the CPU may record ahead of the GPU, 1-3 (2)\n"
+           "\n"
+           "  --help              Show this text\n";
+}
+
+} // namespace parallax::core
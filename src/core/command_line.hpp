@@ -0,0 +1,52 @@
+#pragma once
+
+/// @file command_line.hpp
+/// @brief Command-line options: interactive window (default) or headless offscreen rendering.
+
+#include "core/types.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace parallax::core
+{
+    /// @brief What a headless run renders and where the frames go.
+    struct HeadlessConfig
+    {
+        u32 width = 1920;
+        u32 height = 1080;
+        u32 frames = 1;                         ///< Frames to render, then exit
+        std::optional<f64> julian_date;         ///< Start time (UTC JD); nullopt = now
+        f64 time_step_sec = 0.0;                ///< Simulated seconds between frames
+        f64 latitude_deg = 28.76;               ///< Observer (default: La Palma)
+        f64 longitude_deg = -17.89;             ///< East positive
+        f64 altitude_deg = 45.0;                ///< Camera pointing
+        f64 azimuth_deg = 0.0;                  ///< North = 0, East = 90
+        f64 fov_deg = 60.0;
+        bool gpu_cull = false;                  ///< Use the compute-shader star path
+        std::optional<std::filesystem::path> output_dir = "renders";   ///< nullopt = don't write images
+    };
+
+    /// @brief Parsed command line.
+    struct CommandLine
+    {
+        /// Most frames the window may run ahead of the GPU (per-frame arrays are sized by it)
+        static constexpr u32 kMaxFramesInFlight = 3;
+
+        bool headless = false;      ///< --headless: no window, no swapchain
+        bool help = false;          ///< --help: print get_usage() and exit
+        u32 frames_in_flight = 2;   ///< --frames-in-flight: interactive window only (headless uses 1)
+        HeadlessConfig headless_config;
+    };
+
+    /// @brief Parse the arguments after the program name.
+    /// @return nullopt (logged) on an unknown option, a missing value or a
+    /// value out of range.
+    [[nodiscard]] std::optional<CommandLine> parse_command_line(std::span<const std::string_view> args);
+
+    /// @brief Usage text listing every option and its default.
+    [[nodiscard]] std::string_view get_usage();
+
+} // namespace parallax::core
@@ -0,0 +1,98 @@
+/// @file cpu_features.cpp
+/// @brief CPUID-based feature detection (GCC/Clang <cpuid.h>, MSVC <intrin.h>).
+
+#include "core/cpu_features.hpp"
+
+#include "core/types.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define PLX_CPUID_X86 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <cpuid.h>
+    #define PLX_CPUID_X86 1
+#endif
+
+namespace parallax::core
+{
+
+namespace
+{
+
+#if defined(PLX_CPUID_X86)
+
+void cpuid(u32 leaf, u32 subleaf, u32 regs[4])
+{
+#if defined(_MSC_VER)
+    int out[4];
+    __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i)
+    {
+        regs[i] = static_cast<u32>(out[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+u64 read_xcr0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    u32 eax = 0;
+    u32 edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<u64>(edx) << 32) | eax;
+#endif
+}
+
+CpuFeatures detect()
+{
+    CpuFeatures features;
+
+    u32 regs[4] = {};
+    cpuid(0, 0, regs);
+    const u32 max_leaf = regs[0];
+
+    cpuid(1, 0, regs);
+    features.sse2 = (regs[3] & (1u << 26)) != 0;
+
+    const bool osxsave = (regs[2] & (1u << 27)) != 0;
+    const bool avx = (regs[2] & (1u << 28)) != 0;
+    const bool fma = (regs[2] & (1u << 12)) != 0;
+
+    // XMM (bit 1) and YMM (bit 2) state saved by the OS
+    const bool ymm_enabled = osxsave && (read_xcr0() & 0x6) == 0x6;
+    if (!avx || !ymm_enabled)
+    {
+        return features;
+    }
+
+    features.fma = fma;
+    if (max_leaf >= 7)
+    {
+        cpuid(7, 0, regs);
+        features.avx2 = (regs[1] & (1u << 5)) != 0;
+    }
+    return features;
+}
+
+#else
+
+CpuFeatures detect()
+{
+    return {};
+}
+
+#endif
+
+} // anonymous namespace
+
+const CpuFeatures& get_cpu_features()
+{
+    static const CpuFeatures features = detect();
+    return features;
+}
+
+} // namespace parallax::core
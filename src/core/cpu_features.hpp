@@ -0,0 +1,22 @@
+#pragma once
+
+/// @file cpu_features.hpp
+/// @brief Runtime CPU feature detection for dispatching SIMD kernels.
+
+namespace parallax::core
+{
+    /// @brief Instruction set extensions usable by this process.
+    ///
+    /// A feature is reported only if both the CPU and the OS support it
+    /// (AVX state must be enabled in XCR0, otherwise AVX code faults).
+    struct CpuFeatures
+    {
+        bool sse2 = false;
+        bool avx2 = false;
+        bool fma = false;
+    };
+
+    /// @brief Detect once (CPUID / XGETBV on x86; all false elsewhere) and cache.
+    [[nodiscard]] const CpuFeatures& get_cpu_features();
+
+} // namespace parallax::core
@@ -0,0 +1,76 @@
+/// @file frame_arena.cpp
+/// @brief FrameArena implementation.
+
+#include "core/frame_arena.hpp"
+
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace parallax::core
+{
+
+FrameArena::FrameArena(std::size_t bytes_per_frame, u32 frame_count)
+    : m_region_bytes{(bytes_per_frame + kRegionAlignment - 1) / kRegionAlignment * kRegionAlignment}
+    , m_frame_count{std::max(frame_count, 1u)}
+{
+    m_storage.resize(m_region_bytes * m_frame_count);
+    m_region = m_storage.data();
+}
+
+void FrameArena::begin_frame(u32 frame_index)
+{
+    assert(frame_index < m_frame_count);
+
+    m_peak = std::max(m_peak, m_offset.load(std::memory_order_relaxed));
+    m_region = m_storage.data() + static_cast<std::size_t>(frame_index) * m_region_bytes;
+    m_offset.store(0, std::memory_order_relaxed);
+}
+
+void* FrameArena::allocate(std::size_t bytes, std::size_t alignment)
+{
+    assert((alignment & (alignment - 1)) == 0 && alignment <= kRegionAlignment);
+
+    // Regions start on kRegionAlignment, so aligning the offset aligns the pointer
+    std::size_t offset = m_offset.load(std::memory_order_relaxed);
+    std::size_t aligned = 0;
+    do
+    {
+        aligned = (offset + alignment - 1) & ~(alignment - 1);
+        if (aligned > m_region_bytes || bytes > m_region_bytes - aligned)
+        {
+            m_overflows.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    } while (!m_offset.compare_exchange_weak(offset, aligned + bytes, std::memory_order_relaxed));
+
+    return m_region + aligned;
+}
+
+std::size_t FrameArena::get_used() const
+{
+    return m_offset.load(std::memory_order_relaxed);
+}
+
+std::size_t FrameArena::get_remaining() const
+{
+    return m_region_bytes - get_used();
+}
+
+std::size_t FrameArena::get_capacity() const
+{
+    return m_region_bytes;
+}
+
+std::size_t FrameArena::get_peak() const
+{
+    return std::max(m_peak, get_used());
+}
+
+u64 FrameArena::get_overflow_count() const
+{
+    return m_overflows.load(std::memory_order_relaxed);
+}
+
+} // namespace parallax::core
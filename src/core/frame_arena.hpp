@@ -0,0 +1,102 @@
+#pragma once
+
+/// @file frame_arena.hpp
+/// @brief Per-frame linear (bump) allocator with one region per frame in flight.
+
+#include "core/aligned_allocator.hpp"
+#include "core/types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace parallax::core
+{
+    /// @brief Scratch memory that lives for exactly one frame in flight.
+    ///
+    /// One fixed region per frame in flight, allocated once at startup.
+    /// begin_frame() rewinds that frame's region; allocations bump an offset
+    /// and are never freed individually. Data handed out for frame N stays
+    /// valid until frame N's slot comes round again, i.e. until the GPU has
+    /// finished with it.
+    ///
+    /// allocate() is lock-free and may be called from jobs; begin_frame()
+    /// must not race with allocations. Objects are not constructed or
+    /// destroyed, so only trivial types go in here.
+    class FrameArena
+    {
+    public:
+        /// @param bytes_per_frame Capacity of each frame's region.
+        /// @param frame_count Frames in flight (regions).
+        FrameArena(std::size_t bytes_per_frame, u32 frame_count);
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+        FrameArena(FrameArena&&) = delete;
+        FrameArena& operator=(FrameArena&&) = delete;
+
+        /// @brief Switch to a frame's region and discard what it held.
+        void begin_frame(u32 frame_index);
+
+        /// @brief Raw allocation from the current region.
+        /// @return nullptr if the region is exhausted (nothing is consumed).
+        [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+        /// @brief Uninitialized array of `count` trivial objects.
+        /// @return Empty span if the region is exhausted.
+        template <typename T>
+        [[nodiscard]] std::span<T> allocate_array(std::size_t count);
+
+        /// @brief Bytes handed out from the current region.
+        [[nodiscard]] std::size_t get_used() const;
+
+        /// @brief Bytes still available in the current region (ignoring alignment).
+        [[nodiscard]] std::size_t get_remaining() const;
+
+        /// @brief Capacity of each region.
+        [[nodiscard]] std::size_t get_capacity() const;
+
+        /// @brief Largest get_used() seen at any begin_frame() (sizing aid).
+        [[nodiscard]] std::size_t get_peak() const;
+
+        /// @brief Allocations that failed because a region was full.
+        [[nodiscard]] u64 get_overflow_count() const;
+
+    private:
+        static constexpr std::size_t kRegionAlignment = 64;
+
+        std::vector<std::byte, AlignedAllocator<std::byte, kRegionAlignment>> m_storage;
+        std::size_t m_region_bytes;
+        u32 m_frame_count;
+
+        std::byte* m_region = nullptr;          ///< Current frame's region
+        std::atomic<std::size_t> m_offset{0};
+        std::size_t m_peak = 0;
+        std::atomic<u64> m_overflows{0};
+    };
+
+    // -----------------------------------------------------------------
+    // Template implementation
+    // -----------------------------------------------------------------
+
+    template <typename T>
+    std::span<T> FrameArena::allocate_array(std::size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T> && std::is_trivially_copyable_v<T>,
+                      "FrameArena never runs constructors or destructors");
+
+        if (count == 0)
+        {
+            return {};
+        }
+        void* memory = allocate(count * sizeof(T), alignof(T));
+        if (memory == nullptr)
+        {
+            return {};
+        }
+        return std::span<T>(static_cast<T*>(memory), count);
+    }
+
+} // namespace parallax::core
@@ -0,0 +1,295 @@
+/// @file headless_renderer.cpp
+/// @brief HeadlessRenderer implementation — offscreen setup, fixed-step frame loop, image output.
+
+#include "core/headless_renderer.hpp"
+
+#include "astro/time_system.hpp"
+#include "core/image_file.hpp"
+#include "core/logger.hpp"
+#include "core/scene_setup.hpp"
+
+#include <glm/trigonometric.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+
+namespace
+{
+
+void check_vk(VkResult result, const char* operation)
+{
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("Vulkan error in {}: VkResult = {}", operation, static_cast<int>(result));
+        std::abort();
+    }
+}
+
+} // anonymous namespace
+
+namespace parallax::core
+{
+
+// =================================================================
+// Initialization
+// =================================================================
+
+HeadlessRenderer::HeadlessRenderer(const HeadlessConfig& config)
+    : m_config{config}
+{
+    // 1. Vulkan context without a surface
+    m_context = std::make_unique<vulkan::Context>(
+        vulkan::ContextConfig{.app_name = "Parallax (headless)", .enable_validation = true});
+
+    // 2. Render pass for the offscreen format + the target it draws into
+    const std::filesystem::path shader_dir{PLX_SHADER_DIR};
+    m_pipeline = std::make_unique<vulkan::Pipeline>(*m_context, vulkan::OffscreenTarget::kColorFormat, shader_dir);
+    m_target = std::make_unique<vulkan::OffscreenTarget>(
+        *m_context, m_pipeline->get_render_pass(), VkExtent2D{m_config.width, m_config.height});
+    m_gpu_profiler = std::make_unique<vulkan::GpuProfiler>(*m_context, 1);
+
+    // 3. Starfield, one frame in flight
+    m_jobs = std::make_unique<JobSystem>();
+    m_frame_arena = std::make_unique<FrameArena>(kFrameArenaBytes, 1);
+    m_starfield = std::make_unique<rendering::Starfield>(
+        *m_context, *m_jobs, m_pipeline->get_render_pass(), shader_dir, 1);
+
+    // 4. Camera from the command line
+    m_camera = std::make_unique<rendering::Camera>();
+    m_camera->set_pointing(glm::radians(m_config.altitude_deg), glm::radians(m_config.azimuth_deg));
+    m_camera->set_fov(m_config.fov_deg);
+
+    // 5. Star catalog
+    m_catalog_manager = std::make_unique<catalog::CatalogManager>();
+    m_star_layers = std::make_unique<catalog::MagnitudeFilter>(kCatalogNside, *m_jobs);
+    load_default_star_catalog(*m_catalog_manager, *m_star_layers);
+
+    if (m_config.gpu_cull)
+    {
+        m_starfield->upload_catalog(*m_star_layers, shader_dir);
+        m_starfield->set_path(rendering::StarfieldPath::GpuCompute);
+    }
+    m_context->get_pipeline_cache().log_startup();
+
+    // 6. Observer + start time
+    m_observer = astro::ObserverLocation{
+        .latitude_rad  = glm::radians(m_config.latitude_deg),
+        .longitude_rad = glm::radians(m_config.longitude_deg),
+    };
+    m_julian_date = m_config.julian_date ? astro::JulianDate(*m_config.julian_date)
+                                         : astro::TimeSystem::now_as_julian_date();
+    load_default_earth_orientation(m_time_scales);
+
+    // 7. Command buffer + fence
+    VkDevice device = m_context->get_device();
+
+    VkCommandPoolCreateInfo pool_info{};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex = m_context->get_graphics_queue_family();
+    check_vk(vkCreateCommandPool(device, &pool_info, nullptr, &m_command_pool), "vkCreateCommandPool");
+
+    VkCommandBufferAllocateInfo alloc_info{};
+    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.commandPool = m_command_pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = 1;
+    check_vk(vkAllocateCommandBuffers(device, &alloc_info, &m_command_buffer), "vkAllocateCommandBuffers");
+
+    VkFenceCreateInfo fence_info{};
+    fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    check_vk(vkCreateFence(device, &fence_info, nullptr, &m_fence), "vkCreateFence");
+
+    PLX_CORE_INFO("Headless renderer ready: {}x{}, {} frame(s) from JD {:.6f}, step {} s, {} path",
+                  m_config.width, m_config.height, m_config.frames, m_julian_date.get_jd(), m_config.time_step_sec,
+                  m_config.gpu_cull ? "GPU" : "CPU");
+}
+
+// =================================================================
+// Shutdown
+// =================================================================
+
+HeadlessRenderer::~HeadlessRenderer()
+{
+    if (!m_context)
+    {
+        return;
+    }
+
+    m_context->wait_idle();
+    m_context->get_allocator().log_usage();
+
+    VkDevice device = m_context->get_device();
+    vkDestroyFence(device, m_fence, nullptr);
+    vkDestroyCommandPool(device, m_command_pool, nullptr);
+
+    m_star_layers.reset();
+    m_starfield.reset();
+    m_frame_arena.reset();
+    m_jobs.reset();
+    m_gpu_profiler.reset();
+    m_target.reset();
+    m_pipeline.reset();
+    m_context.reset();
+}
+
+// =================================================================
+// Frame loop
+// =================================================================
+
+bool HeadlessRenderer::run()
+{
+    using clock = std::chrono::steady_clock;
+
+    f64 render_sec = 0.0;
+    bool ok = true;
+
+    for (u32 frame = 0; frame < m_config.frames; ++frame)
+    {
+        const auto start = clock::now();
+        render_frame(frame);
+        render_sec += std::chrono::duration<f64>(clock::now() - start).count();
+
+        if (m_config.output_dir)
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "frame_%04u.ppm", frame);
+            const auto path = *m_config.output_dir / name;
+
+            const VkExtent2D extent = m_target->get_extent();
+            if (!write_ppm(path, extent.width, extent.height, m_target->get_pixels()))
+            {
+                ok = false;
+                break;
+            }
+            PLX_CORE_INFO("Frame {} written: {}", frame, path.string());
+        }
+
+        m_julian_date += m_config.time_step_sec;
+    }
+
+    const f64 frames_per_sec = render_sec > 0.0 ? static_cast<f64>(m_config.frames) / render_sec : 0.0;
+    PLX_CORE_INFO("Headless: {} frame(s) in {:.1f} ms ({:.2f} ms/frame, {:.1f} frames/s, excluding image writes)",
+                  m_config.frames, render_sec * 1000.0,
+                  render_sec * 1000.0 / static_cast<f64>(m_config.frames), frames_per_sec);
+
+    // Every submission was waited for, so the last frame's timestamps are in
+    m_gpu_profiler->collect_pending();
+    m_gpu_profiler->log_stats();
+    return ok;
+}
+
+void HeadlessRenderer::render_frame(u32 frame_number)
+{
+    VkDevice device = m_context->get_device();
+
+    // Single slot: the previous frame was waited for, so the arena and the
+    // starfield's ring region are free
+    m_frame_arena->begin_frame(0);
+    m_context->get_allocator().begin_frame(frame_number);
+
+    m_time_scales.update(m_julian_date);
+    m_precession.update(m_time_scales.get_frame().ut1, m_time_scales.get_frame().tt);
+    if (m_starfield->get_path() == rendering::StarfieldPath::Cpu)
+    {
+        // Every image shows all layers the limit reaches, not the ones loaded so far
+        m_star_layers->set_magnitude_limit(m_camera->get_magnitude_limit());
+        m_star_layers->wait_for_loads();
+    }
+    m_starfield->update(*m_star_layers, m_precession.get_celestial_to_horizontal(m_observer),
+                        *m_camera, *m_frame_arena, 0);
+
+    check_vk(vkResetCommandBuffer(m_command_buffer, 0), "vkResetCommandBuffer");
+    record_command_buffer(m_command_buffer);
+
+    // Staged uploads: wait for the starfield's copy before the vertex stage
+    const u64 upload_value = m_starfield->get_upload_value(0);
+    VkSemaphore wait_semaphore = m_starfield->get_upload_semaphore();
+    const VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+
+    VkTimelineSemaphoreSubmitInfo timeline_info{};
+    timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timeline_info.waitSemaphoreValueCount = 1;
+    timeline_info.pWaitSemaphoreValues = &upload_value;
+
+    VkSubmitInfo submit_info{};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    if (upload_value != 0)
+    {
+        submit_info.pNext = &timeline_info;
+        submit_info.waitSemaphoreCount = 1;
+        submit_info.pWaitSemaphores = &wait_semaphore;
+        submit_info.pWaitDstStageMask = &wait_stage;
+    }
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_command_buffer;
+
+    check_vk(vkQueueSubmit(m_context->get_graphics_queue(), 1, &submit_info, m_fence), "vkQueueSubmit");
+    check_vk(vkWaitForFences(device, 1, &m_fence, VK_TRUE, std::numeric_limits<uint64_t>::max()),
+             "vkWaitForFences");
+    check_vk(vkResetFences(device, 1, &m_fence), "vkResetFences");
+}
+
+void HeadlessRenderer::record_command_buffer(VkCommandBuffer cmd)
+{
+    VkCommandBufferBeginInfo begin_info{};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    check_vk(vkBeginCommandBuffer(cmd, &begin_info), "vkBeginCommandBuffer");
+
+    m_gpu_profiler->begin_frame(cmd, 0);
+
+    {
+        PLX_GPU_SCOPE(*m_gpu_profiler, cmd, "star_cull");
+        m_starfield->record_compute(cmd);
+    }
+
+    // Same clear color as the interactive view
+    VkClearValue clear_color{};
+    clear_color.color = {{0.0f, 0.0f, 0.02f, 1.0f}};
+
+    const VkExtent2D extent = m_target->get_extent();
+
+    VkRenderPassBeginInfo render_pass_info{};
+    render_pass_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    render_pass_info.renderPass = m_pipeline->get_render_pass();
+    render_pass_info.framebuffer = m_target->get_framebuffer();
+    render_pass_info.renderArea.offset = {0, 0};
+    render_pass_info.renderArea.extent = extent;
+    render_pass_info.clearValueCount = 1;
+    render_pass_info.pClearValues = &clear_color;
+
+    const u32 pass_scope = m_gpu_profiler->begin_scope(cmd, "main_pass");
+    vkCmdBeginRenderPass(cmd, &render_pass_info, VK_SUBPASS_CONTENTS_INLINE);
+
+    VkViewport viewport{};
+    viewport.width = static_cast<float>(extent.width);
+    viewport.height = static_cast<float>(extent.height);
+    viewport.maxDepth = 1.0f;
+    vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+    VkRect2D scissor{};
+    scissor.extent = extent;
+    vkCmdSetScissor(cmd, 0, 1, &scissor);
+
+    {
+        PLX_GPU_SCOPE(*m_gpu_profiler, cmd, "starfield_draw");
+        m_starfield->draw(cmd, 0);
+    }
+
+    vkCmdEndRenderPass(cmd);
+    m_gpu_profiler->end_scope(cmd, pass_scope);
+
+    // Render pass left the image in TRANSFER_SRC_OPTIMAL
+    {
+        PLX_GPU_SCOPE(*m_gpu_profiler, cmd, "readback");
+        m_target->record_readback(cmd);
+    }
+
+    check_vk(vkEndCommandBuffer(cmd), "vkEndCommandBuffer");
+}
+
+} // namespace parallax::core
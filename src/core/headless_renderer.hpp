@@ -0,0 +1,96 @@
+#pragma once
+
+/// @file headless_renderer.hpp
+/// @brief Renders a fixed number of frames offscreen (no window, no swapchain) and writes them to disk.
+
+#include "astro/coordinates.hpp"
+#include "astro/julian_date.hpp"
+#include "astro/precession.hpp"
+#include "astro/time_scales.hpp"
+#include "catalog/catalog_manager.hpp"
+#include "catalog/magnitude_filter.hpp"
+#include "core/command_line.hpp"
+#include "core/frame_arena.hpp"
+#include "core/job_system.hpp"
+#include "core/types.hpp"
+#include "rendering/camera.hpp"
+#include "rendering/starfield.hpp"
+#include "vulkan/context.hpp"
+#include "vulkan/gpu_profiler.hpp"
+#include "vulkan/offscreen_target.hpp"
+#include "vulkan/pipeline.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <memory>
+
+namespace parallax::core
+{
+    /// @brief Headless counterpart of Application, for CI, reference renders
+    /// and benchmarks on machines without a display (lavapipe included).
+    ///
+    /// Uses a headless vulkan::Context (no SDL, no surface, no present queue)
+    /// and draws the same Starfield into an OffscreenTarget. Each frame is
+    /// recorded, submitted and waited for in turn — one frame in flight, so
+    /// the readback never races the next frame — then written as
+    /// "<output>/frame_NNNN.ppm". Simulation time advances by a fixed step
+    /// per frame rather than wall-clock time, so runs are reproducible.
+    class HeadlessRenderer
+    {
+    public:
+        /// @brief Create the context, offscreen target, starfield and catalog.
+        explicit HeadlessRenderer(const HeadlessConfig& config);
+
+        /// @brief Wait for the GPU and destroy everything in reverse order.
+        ~HeadlessRenderer();
+
+        HeadlessRenderer(const HeadlessRenderer&) = delete;
+        HeadlessRenderer& operator=(const HeadlessRenderer&) = delete;
+        HeadlessRenderer(HeadlessRenderer&&) = delete;
+        HeadlessRenderer& operator=(HeadlessRenderer&&) = delete;
+
+        /// @brief Render config.frames frames and log the throughput.
+        /// @return False if writing an image failed.
+        bool run();
+
+    private:
+        void render_frame(u32 frame_number);
+        void record_command_buffer(VkCommandBuffer cmd);
+
+        /// Same per-frame scratch as Application (worst-case full-sky work list)
+        static constexpr std::size_t kFrameArenaBytes = 16u << 20;
+        static constexpr u32 kCatalogNside = 64;
+
+        HeadlessConfig m_config;
+
+        // -----------------------------------------------------------------
+        // Subsystems (created in order, destroyed in reverse)
+        // -----------------------------------------------------------------
+        std::unique_ptr<vulkan::Context> m_context;
+        std::unique_ptr<vulkan::Pipeline> m_pipeline;       ///< Offscreen render pass (ends in TRANSFER_SRC)
+        std::unique_ptr<vulkan::OffscreenTarget> m_target;
+        std::unique_ptr<vulkan::GpuProfiler> m_gpu_profiler;
+        std::unique_ptr<JobSystem> m_jobs;
+        std::unique_ptr<FrameArena> m_frame_arena;
+        std::unique_ptr<rendering::Starfield> m_starfield;
+        std::unique_ptr<rendering::Camera> m_camera;
+        std::unique_ptr<catalog::CatalogManager> m_catalog_manager;
+        std::unique_ptr<catalog::MagnitudeFilter> m_star_layers;
+
+        // -----------------------------------------------------------------
+        // Simulation state
+        // -----------------------------------------------------------------
+        astro::JulianDate m_julian_date;    ///< UTC
+        astro::TimeScales m_time_scales;
+        astro::ObserverLocation m_observer;
+        astro::Precession m_precession;
+
+        // -----------------------------------------------------------------
+        // Submission
+        // -----------------------------------------------------------------
+        VkCommandPool m_command_pool = VK_NULL_HANDLE;
+        VkCommandBuffer m_command_buffer = VK_NULL_HANDLE;
+        VkFence m_fence = VK_NULL_HANDLE;
+    };
+
+} // namespace parallax::core
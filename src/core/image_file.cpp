@@ -0,0 +1,69 @@
+/// @file image_file.cpp
+/// @brief Binary PPM writer.
+
+#include "core/image_file.hpp"
+
+#include "core/logger.hpp"
+
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace parallax::core
+{
+
+bool write_ppm(const std::filesystem::path& path, u32 width, u32 height, std::span<const u8> rgba)
+{
+    const std::size_t pixel_count = std::size_t{width} * height;
+    if (rgba.size() < pixel_count * 4)
+    {
+        PLX_CORE_ERROR("write_ppm: {} bytes for a {}x{} image", rgba.size(), width, height);
+        return false;
+    }
+
+    if (path.has_parent_path())
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec)
+        {
+            PLX_CORE_ERROR("write_ppm: failed to create {}: {}", path.parent_path().string(), ec.message());
+            return false;
+        }
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        PLX_CORE_ERROR("write_ppm: failed to create {}", path.string());
+        return false;
+    }
+
+    const std::string header = "P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+    // One row at a time: RGBA → RGB
+    std::vector<char> row(std::size_t{width} * 3);
+    for (u32 y = 0; y < height; ++y)
+    {
+        const u8* src = rgba.data() + std::size_t{y} * width * 4;
+        for (u32 x = 0; x < width; ++x)
+        {
+            row[x * 3 + 0] = static_cast<char>(src[x * 4 + 0]);
+            row[x * 3 + 1] = static_cast<char>(src[x * 4 + 1]);
+            row[x * 3 + 2] = static_cast<char>(src[x * 4 + 2]);
+        }
+        out.write(row.data(), static_cast<std::streamsize>(row.size()));
+    }
+
+    out.close();
+    if (!out)
+    {
+        PLX_CORE_ERROR("write_ppm: failed to write {}", path.string());
+        return false;
+    }
+    return true;
+}
+
+} // namespace parallax::core
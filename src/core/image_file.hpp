@@ -0,0 +1,24 @@
+#pragma once
+
+/// @file image_file.hpp
+/// @brief Minimal image output for headless renders (binary PPM).
+
+#include "core/types.hpp"
+
+#include <filesystem>
+#include <span>
+
+namespace parallax::core
+{
+    /// @brief Write RGBA8 pixels as a binary PPM (P6); alpha is dropped.
+    ///
+    /// PPM needs no encoder and every image tool reads it, which is all
+    /// reference renders and CI comparisons need.
+    /// @param path Output file (parent directory is created).
+    /// @param width Image width in pixels.
+    /// @param height Image height in pixels.
+    /// @param rgba width × height × 4 bytes, rows top to bottom.
+    /// @return False (logged) on a size mismatch or I/O failure.
+    bool write_ppm(const std::filesystem::path& path, u32 width, u32 height, std::span<const u8> rgba);
+
+} // namespace parallax::core
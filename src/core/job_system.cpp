@@ -0,0 +1,290 @@
+/// @file job_system.cpp
+/// @brief Work-stealing job system implementation.
+
+#include "core/job_system.hpp"
+
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <utility>
+
+namespace parallax::core
+{
+
+namespace
+{
+    /// Which system and deque the current thread works for
+    struct ThreadSlot
+    {
+        const JobSystem* system = nullptr;
+        u32 index = 0;
+    };
+
+    thread_local ThreadSlot t_slot;
+
+    /// Initial ring size per deque (jobs); grows by doubling
+    constexpr std::size_t kInitialQueueSlots = 256;
+
+} // anonymous namespace
+
+// -----------------------------------------------------------------
+// JobCounter
+// -----------------------------------------------------------------
+
+bool JobCounter::is_done() const
+{
+    return m_pending.load(std::memory_order_acquire) == 0;
+}
+
+// -----------------------------------------------------------------
+// WorkerQueue ring buffer
+// -----------------------------------------------------------------
+
+void JobSystem::WorkerQueue::push_back(const QueuedJob& job)
+{
+    if (size == slots.size())
+    {
+        // Unroll into a buffer twice the size, oldest job first
+        std::vector<QueuedJob> grown(slots.size() * 2);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            grown[i] = slots[(head + i) & (slots.size() - 1)];
+        }
+        slots.swap(grown);
+        head = 0;
+    }
+    slots[(head + size) & (slots.size() - 1)] = job;
+    ++size;
+}
+
+JobSystem::QueuedJob JobSystem::WorkerQueue::pop_back()
+{
+    --size;
+    return slots[(head + size) & (slots.size() - 1)];
+}
+
+JobSystem::QueuedJob JobSystem::WorkerQueue::pop_front()
+{
+    const QueuedJob job = slots[head];
+    head = (head + 1) & (slots.size() - 1);
+    --size;
+    return job;
+}
+
+// -----------------------------------------------------------------
+// Construction / Destruction
+// -----------------------------------------------------------------
+
+JobSystem::JobSystem(u32 thread_count)
+{
+    if (thread_count == kHardwareThreads)
+    {
+        thread_count = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    }
+
+    m_queues.reserve(thread_count + 1);
+    for (u32 i = 0; i <= thread_count; ++i)
+    {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+        m_queues.back()->slots.resize(kInitialQueueSlots);
+    }
+
+    m_threads.reserve(thread_count);
+    for (u32 i = 1; i <= thread_count; ++i)
+    {
+        m_threads.emplace_back([this, i] { worker_loop(i); });
+    }
+
+    PLX_CORE_INFO("Job system started ({} worker threads + owner)", thread_count);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        const std::lock_guard lock(m_wake_mutex);
+        m_stop.store(true);
+    }
+    m_wake.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+
+    PLX_CORE_TRACE("Job system stopped");
+}
+
+// -----------------------------------------------------------------
+// Submission
+// -----------------------------------------------------------------
+
+void JobSystem::submit(const Job& job, JobCounter& counter)
+{
+    submit(std::span<const Job>(&job, 1), counter);
+}
+
+void JobSystem::submit(std::span<const Job> jobs, JobCounter& counter)
+{
+    if (jobs.empty())
+    {
+        return;
+    }
+    counter.m_pending.fetch_add(static_cast<u32>(jobs.size()), std::memory_order_relaxed);
+    push(current_index(), jobs, counter);
+}
+
+void JobSystem::submit_after(JobCounter& dependency, const Job& job, JobCounter& counter)
+{
+    counter.m_pending.fetch_add(1, std::memory_order_relaxed);
+    {
+        const std::lock_guard lock(dependency.m_mutex);
+        if (!dependency.is_done())
+        {
+            dependency.m_continuations.push_back(JobCounter::Continuation{.job = job, .counter = &counter});
+            return;
+        }
+    }
+    push(current_index(), std::span<const Job>(&job, 1), counter);
+}
+
+void JobSystem::push(u32 index, std::span<const Job> jobs, JobCounter& counter)
+{
+    {
+        WorkerQueue& queue = *m_queues[index];
+        const std::lock_guard lock(queue.mutex);
+        for (const Job& job : jobs)
+        {
+            queue.push_back(QueuedJob{.job = job, .counter = &counter});
+        }
+    }
+
+    // Publish under the wake mutex so a worker between its empty check and
+    // its wait cannot miss the notification
+    {
+        const std::lock_guard lock(m_wake_mutex);
+        m_queued.fetch_add(static_cast<u32>(jobs.size()), std::memory_order_release);
+    }
+    if (jobs.size() == 1)
+    {
+        m_wake.notify_one();
+    }
+    else
+    {
+        m_wake.notify_all();
+    }
+}
+
+// -----------------------------------------------------------------
+// Execution
+// -----------------------------------------------------------------
+
+void JobSystem::wait(JobCounter& counter)
+{
+    while (!counter.is_done())
+    {
+        if (!run_one(current_index()))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // The last finish() may still hold the mutex while it hands off
+    // continuations; the counter must not be destroyed before it lets go
+    const std::lock_guard lock(counter.m_mutex);
+}
+
+bool JobSystem::run_one(u32 index)
+{
+    QueuedJob next{};
+    bool found = false;
+
+    // Own deque: newest first
+    {
+        WorkerQueue& own = *m_queues[index];
+        const std::lock_guard lock(own.mutex);
+        if (own.size > 0)
+        {
+            next = own.pop_back();
+            found = true;
+        }
+    }
+
+    // Steal: oldest first, scanning the other deques from our neighbour on
+    const auto queue_count = static_cast<u32>(m_queues.size());
+    for (u32 offset = 1; !found && offset < queue_count; ++offset)
+    {
+        WorkerQueue& victim = *m_queues[(index + offset) % queue_count];
+        const std::lock_guard lock(victim.mutex);
+        if (victim.size > 0)
+        {
+            next = victim.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        return false;
+    }
+
+    m_queued.fetch_sub(1, std::memory_order_relaxed);
+    next.job.function(next.job.context);
+    finish(*next.counter);
+    return true;
+}
+
+void JobSystem::finish(JobCounter& counter)
+{
+    std::vector<JobCounter::Continuation> ready;
+    {
+        const std::lock_guard lock(counter.m_mutex);
+        if (counter.m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            ready.swap(counter.m_continuations);
+        }
+    }
+
+    // `counter` may be gone from here on; only the moved-out list is used
+    for (const auto& continuation : ready)
+    {
+        push(current_index(), std::span<const Job>(&continuation.job, 1), *continuation.counter);
+    }
+}
+
+void JobSystem::worker_loop(u32 index)
+{
+    t_slot = ThreadSlot{.system = this, .index = index};
+
+    while (true)
+    {
+        if (run_one(index))
+        {
+            continue;
+        }
+
+        std::unique_lock lock(m_wake_mutex);
+        m_wake.wait(lock, [this] {
+            return m_stop.load() || m_queued.load(std::memory_order_acquire) > 0;
+        });
+        if (m_stop.load())
+        {
+            return;
+        }
+    }
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+u32 JobSystem::get_thread_count() const
+{
+    return static_cast<u32>(m_queues.size());
+}
+
+u32 JobSystem::current_index() const
+{
+    return (t_slot.system == this) ? t_slot.index : 0;
+}
+
+} // namespace parallax::core
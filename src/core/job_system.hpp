@@ -0,0 +1,230 @@
+#pragma once
+
+/// @file job_system.hpp
+/// @brief Work-stealing job system: per-worker deques, parallel_for, dependency counters.
+
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace parallax::core
+{
+    class JobCounter;
+
+    /// @brief A unit of work: plain function pointer + opaque context.
+    ///
+    /// The context must outlive the job; the submitter normally waits on the
+    /// job's counter before releasing it.
+    struct Job
+    {
+        void (*function)(void* context) = nullptr;
+        void* context = nullptr;
+    };
+
+    /// @brief Number of unfinished jobs in a group.
+    ///
+    /// Incremented on submit, decremented when a job returns. Jobs queued with
+    /// JobSystem::submit_after() are released once the counter they depend on
+    /// drops to zero, which is how job graphs are expressed.
+    class JobCounter
+    {
+    public:
+        JobCounter() = default;
+
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        /// @brief True when every job counted here has finished.
+        ///
+        /// Use JobSystem::wait() before destroying a counter: a finishing job
+        /// may still be releasing continuations right after this turns true.
+        [[nodiscard]] bool is_done() const;
+
+    private:
+        friend class JobSystem;
+
+        /// @brief A job waiting on this counter, and the counter it reports to.
+        struct Continuation
+        {
+            Job job;
+            JobCounter* counter;
+        };
+
+        std::atomic<u32> m_pending{0};
+        std::mutex m_mutex;                         ///< Guards m_continuations and the final decrement
+        std::vector<Continuation> m_continuations;
+    };
+
+    /// @brief Fixed pool of worker threads with work stealing.
+    ///
+    /// Every worker owns a deque: it pushes and pops its own jobs at the back
+    /// (LIFO, cache-warm), idle workers steal from the front of the others
+    /// (FIFO, oldest and usually largest work first). The thread that created
+    /// the system is worker 0; it has no thread of its own but runs jobs while
+    /// it is blocked in wait(), so a system with 0 extra threads degrades to
+    /// running everything inline.
+    ///
+    /// Deques are guarded by one mutex each. Jobs here are coarse (a chunk of
+    /// thousands of stars, a file chunk), so lock cost is noise next to the work.
+    /// Deques are ring buffers that only grow, and parallel_for keeps its
+    /// ranges on the stack, so steady-state frames never touch the heap.
+    class JobSystem
+    {
+    public:
+        /// @brief thread_count that sizes the pool to hardware_concurrency() − 1.
+        static constexpr u32 kHardwareThreads = ~0u;
+
+        /// @brief Start the worker threads.
+        /// @param thread_count Extra worker threads (0 = none: jobs run on the
+        ///                     owning thread inside wait()).
+        explicit JobSystem(u32 thread_count = kHardwareThreads);
+
+        /// @brief Stop and join all workers. Queued jobs that never ran are dropped.
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) = delete;
+        JobSystem& operator=(JobSystem&&) = delete;
+
+        /// @brief Queue one job on the calling thread's deque.
+        void submit(const Job& job, JobCounter& counter);
+
+        /// @brief Queue a batch of jobs (one lock, one wake-up).
+        void submit(std::span<const Job> jobs, JobCounter& counter);
+
+        /// @brief Queue a job once `dependency` reaches zero.
+        ///
+        /// `counter` is incremented immediately, so waiting on it also waits
+        /// for the dependency chain.
+        void submit_after(JobCounter& dependency, const Job& job, JobCounter& counter);
+
+        /// @brief Block until the counter is zero, running queued jobs meanwhile.
+        void wait(JobCounter& counter);
+
+        /// @brief Run fn(begin, end) over [0, count) split into contiguous ranges.
+        ///
+        /// Ranges hold at least `min_range` indices (at most kMaxRanges
+        /// ranges) and are submitted in ascending order; returns when all
+        /// have finished. Which thread runs
+        /// a range is unspecified, so fn must only write state owned by its
+        /// range (output order is then independent of scheduling).
+        template <typename Fn>
+        void parallel_for(u32 count, u32 min_range, Fn&& fn);
+
+        /// @brief Threads that run jobs, including the owning thread.
+        [[nodiscard]] u32 get_thread_count() const;
+
+        /// @brief Upper bound on the ranges one parallel_for call creates.
+        static constexpr u32 kMaxRanges = 256;
+
+    private:
+        struct QueuedJob
+        {
+            Job job;
+            JobCounter* counter;
+        };
+
+        /// @brief One deque per thread (index 0 = owning thread).
+        ///
+        /// Ring buffer over `slots` (power-of-two size); doubles when full.
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::vector<QueuedJob> slots;
+            std::size_t head = 0;       ///< Index of the oldest job
+            std::size_t size = 0;
+
+            void push_back(const QueuedJob& job);
+            [[nodiscard]] QueuedJob pop_back();
+            [[nodiscard]] QueuedJob pop_front();
+        };
+
+        void worker_loop(u32 index);
+
+        /// @brief Pop own work or steal; run it. Returns false if every deque was empty.
+        bool run_one(u32 index);
+
+        /// @brief Append to a deque and wake sleepers (counter already incremented).
+        void push(u32 index, std::span<const Job> jobs, JobCounter& counter);
+
+        /// @brief Decrement a counter and release its continuations at zero.
+        void finish(JobCounter& counter);
+
+        /// @brief Deque index of the calling thread (0 for foreign threads).
+        [[nodiscard]] u32 current_index() const;
+
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+        std::vector<std::thread> m_threads;
+
+        std::atomic<u32> m_queued{0};           ///< Jobs sitting in any deque
+        std::atomic<bool> m_stop{false};
+        std::mutex m_wake_mutex;
+        std::condition_variable m_wake;
+    };
+
+    // -----------------------------------------------------------------
+    // Template implementation
+    // -----------------------------------------------------------------
+
+    template <typename Fn>
+    void JobSystem::parallel_for(u32 count, u32 min_range, Fn&& fn)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // A few ranges per thread so stealing can even out uneven ranges;
+        // with no worker threads everything runs inline anyway
+        const u32 max_ranges = (get_thread_count() > 1) ? std::min(get_thread_count() * 4, kMaxRanges) : 1;
+        const u32 range_count = std::clamp(count / std::max(min_range, 1u), 1u, max_ranges);
+
+        if (range_count == 1)
+        {
+            fn(0u, count);
+            return;
+        }
+
+        using Callable = std::remove_reference_t<Fn>;
+        struct Range
+        {
+            Callable* fn;
+            u32 begin;
+            u32 end;
+        };
+
+        // On the stack: the per-frame hot path must not allocate
+        std::array<Range, kMaxRanges> ranges;
+        std::array<Job, kMaxRanges> jobs;
+        for (u32 i = 0; i < range_count; ++i)
+        {
+            ranges[i] = Range{
+                .fn = &fn,
+                .begin = static_cast<u32>(static_cast<u64>(count) * i / range_count),
+                .end = static_cast<u32>(static_cast<u64>(count) * (i + 1) / range_count),
+            };
+            jobs[i] = Job{
+                .function = [](void* context) {
+                    const auto& range = *static_cast<const Range*>(context);
+                    (*range.fn)(range.begin, range.end);
+                },
+                .context = &ranges[i],
+            };
+        }
+
+        JobCounter counter;
+        submit(std::span<const Job>(jobs.data(), range_count), counter);
+        wait(counter);
+    }
+
+} // namespace parallax::core
@@ -0,0 +1,198 @@
+/// @file memory_mapped_file.cpp
+/// @brief MemoryMappedFile implementation for Windows and POSIX.
+
+#include "core/memory_mapped_file.hpp"
+
+#include "core/logger.hpp"
+
+#include <cstdint>
+
+#ifdef PLX_PLATFORM_WINDOWS
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace parallax::core
+{
+
+// -----------------------------------------------------------------
+// Construction / Destruction
+// -----------------------------------------------------------------
+
+#ifdef PLX_PLATFORM_WINDOWS
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path)
+{
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        PLX_CORE_ERROR("MemoryMappedFile: Failed to open file: {}", path.string());
+        return;
+    }
+    m_file = file;
+
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+    {
+        PLX_CORE_ERROR("MemoryMappedFile: File is empty or unreadable: {}", path.string());
+        close();
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        PLX_CORE_ERROR("MemoryMappedFile: CreateFileMapping failed: {}", path.string());
+        close();
+        return;
+    }
+    m_mapping = mapping;
+
+    m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (m_data == nullptr)
+    {
+        PLX_CORE_ERROR("MemoryMappedFile: MapViewOfFile failed: {}", path.string());
+        close();
+        return;
+    }
+
+    m_size = static_cast<std::size_t>(file_size.QuadPart);
+}
+
+void MemoryMappedFile::close()
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+        m_data = nullptr;
+    }
+    if (m_mapping != nullptr)
+    {
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+        m_mapping = nullptr;
+    }
+    if (m_file != nullptr)
+    {
+        CloseHandle(static_cast<HANDLE>(m_file));
+        m_file = nullptr;
+    }
+    m_size = 0;
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path)
+{
+    m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_fd < 0)
+    {
+        PLX_CORE_ERROR("MemoryMappedFile: Failed to open file: {}", path.string());
+        return;
+    }
+
+    struct stat st{};
+    if (::fstat(m_fd, &st) != 0 || st.st_size <= 0)
+    {
+        PLX_CORE_ERROR("MemoryMappedFile: File is empty or unreadable: {}", path.string());
+        close();
+        return;
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (data == MAP_FAILED)
+    {
+        PLX_CORE_ERROR("MemoryMappedFile: mmap failed: {}", path.string());
+        close();
+        return;
+    }
+
+    m_data = data;
+    m_size = size;
+}
+
+void MemoryMappedFile::close()
+{
+    if (m_data != nullptr)
+    {
+        ::munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_size = 0;
+}
+
+#endif
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    close();
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+bool MemoryMappedFile::is_open() const
+{
+    return m_data != nullptr;
+}
+
+const u8* MemoryMappedFile::data() const
+{
+    return static_cast<const u8*>(m_data);
+}
+
+std::size_t MemoryMappedFile::size() const
+{
+    return m_size;
+}
+
+// -----------------------------------------------------------------
+// Paging hints
+// -----------------------------------------------------------------
+
+void MemoryMappedFile::advise(const void* data, std::size_t size, MappingAdvice advice)
+{
+    if (data == nullptr || size == 0)
+    {
+        return;
+    }
+
+#ifdef PLX_PLATFORM_WINDOWS
+    if (advice == MappingAdvice::WillNeed)
+    {
+        WIN32_MEMORY_RANGE_ENTRY range{const_cast<void*>(data), size};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+    else
+    {
+        // Unlocking pages that were never locked trims them from the working set
+        VirtualUnlock(const_cast<void*>(data), size);
+    }
+#else
+    static const auto page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+
+    const auto begin = reinterpret_cast<std::uintptr_t>(data) & ~(page_size - 1);
+    const auto end = reinterpret_cast<std::uintptr_t>(data) + size;
+    ::madvise(reinterpret_cast<void*>(begin), end - begin,
+              advice == MappingAdvice::WillNeed ? MADV_WILLNEED : MADV_DONTNEED);
+#endif
+}
+
+} // namespace parallax::core
@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file memory_mapped_file.hpp
+/// @brief Read-only memory-mapped file (mmap on Linux, MapViewOfFile on Windows).
+
+#include "core/types.hpp"
+
+#include <cstddef>
+#include <filesystem>
+
+namespace parallax::core
+{
+    /// @brief Paging hint for part of a mapping (see MemoryMappedFile::advise).
+    enum class MappingAdvice : u8
+    {
+        WillNeed,   ///< Start reading the pages in ahead of access
+        DontNeed,   ///< Drop the pages from this process; they re-fault from the file
+    };
+
+    /// @brief Read-only view of an entire file mapped into the address space.
+    ///
+    /// The OS pages data in on first access and may evict clean pages under
+    /// memory pressure, so resident memory tracks what is actually touched
+    /// rather than the file size. The mapping lives until destruction.
+    ///
+    /// Construction never throws: check is_open() before using data().
+    class MemoryMappedFile
+    {
+    public:
+        /// @brief Map the whole file read-only.
+        /// @param path Path to the file. Failures are logged and leave the object closed.
+        explicit MemoryMappedFile(const std::filesystem::path& path);
+
+        /// @brief Unmap the view and close all handles.
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&&) = delete;
+        MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+
+        /// @brief True if the file was opened and mapped successfully.
+        [[nodiscard]] bool is_open() const;
+
+        /// @brief Pointer to the first byte of the mapping (nullptr if not open).
+        [[nodiscard]] const u8* data() const;
+
+        /// @brief Size of the mapping in bytes (0 if not open).
+        [[nodiscard]] std::size_t size() const;
+
+        /// @brief Paging hint for a byte range inside any read-only file mapping.
+        ///
+        /// The range is widened to whole pages. Purely advisory: data stays
+        /// valid either way, and failures are ignored.
+        static void advise(const void* data, std::size_t size, MappingAdvice advice);
+
+    private:
+        void close();
+
+#ifdef PLX_PLATFORM_WINDOWS
+        void* m_file = nullptr;      ///< HANDLE from CreateFileW
+        void* m_mapping = nullptr;   ///< HANDLE from CreateFileMappingW
+#else
+        int m_fd = -1;
+#endif
+        void* m_data = nullptr;
+        std::size_t m_size = 0;
+    };
+
+} // namespace parallax::core
@@ -0,0 +1,112 @@
+#pragma once
+
+/// @file rolling_stats.hpp
+/// @brief Fixed-window min / average / p99 over the most recent samples, without heap allocation.
+
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace parallax::core
+{
+    /// @brief Summary of a RollingStats window.
+    struct RollingSummary
+    {
+        f64 min = 0.0;
+        f64 avg = 0.0;
+        f64 p99 = 0.0;          ///< Nearest-rank 99th percentile
+        f64 last = 0.0;         ///< Most recent sample
+        u32 count = 0;          ///< Samples in the window (0 = all fields zero)
+    };
+
+    /// @brief Ring of the last Capacity samples.
+    ///
+    /// add() is O(1); summarize() copies the window to the stack and runs
+    /// nth_element, so it stays allocation-free and can be called every frame.
+    template <std::size_t Capacity>
+    class RollingStats
+    {
+        static_assert(Capacity > 0, "RollingStats needs room for at least one sample");
+
+    public:
+        /// @brief Record a sample, evicting the oldest once the window is full.
+        void add(f64 value);
+
+        /// @brief Drop all samples.
+        void clear();
+
+        /// @brief Samples currently in the window.
+        [[nodiscard]] u32 get_count() const;
+
+        /// @brief Min / average / p99 / last over the window.
+        [[nodiscard]] RollingSummary summarize() const;
+
+    private:
+        std::array<f64, Capacity> m_samples{};
+        std::size_t m_next = 0;     ///< Slot the next sample goes into
+        std::size_t m_count = 0;
+    };
+
+    // -----------------------------------------------------------------
+    // Template implementation
+    // -----------------------------------------------------------------
+
+    template <std::size_t Capacity>
+    void RollingStats<Capacity>::add(f64 value)
+    {
+        m_samples[m_next] = value;
+        m_next = (m_next + 1) % Capacity;
+        m_count = std::min(m_count + 1, Capacity);
+    }
+
+    template <std::size_t Capacity>
+    void RollingStats<Capacity>::clear()
+    {
+        m_next = 0;
+        m_count = 0;
+    }
+
+    template <std::size_t Capacity>
+    u32 RollingStats<Capacity>::get_count() const
+    {
+        return static_cast<u32>(m_count);
+    }
+
+    template <std::size_t Capacity>
+    RollingSummary RollingStats<Capacity>::summarize() const
+    {
+        if (m_count == 0)
+        {
+            return {};
+        }
+
+        // Until the ring wraps, samples occupy [0, m_count)
+        f64 sum = 0.0;
+        f64 min = m_samples[0];
+        for (std::size_t i = 0; i < m_count; ++i)
+        {
+            sum += m_samples[i];
+            min = std::min(min, m_samples[i]);
+        }
+
+        std::array<f64, Capacity> sorted = m_samples;
+        const auto first = sorted.begin();
+        const auto last = first + static_cast<std::ptrdiff_t>(m_count);
+
+        // Nearest rank: ceil(0.99 × n), 1-based
+        const std::size_t rank = (m_count * 99 + 99) / 100;
+        const auto p99 = first + static_cast<std::ptrdiff_t>(rank - 1);
+        std::nth_element(first, p99, last);
+
+        return RollingSummary{
+            .min = min,
+            .avg = sum / static_cast<f64>(m_count),
+            .p99 = *p99,
+            .last = m_samples[(m_next + Capacity - 1) % Capacity],
+            .count = static_cast<u32>(m_count),
+        };
+    }
+
+} // namespace parallax::core
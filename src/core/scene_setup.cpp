@@ -0,0 +1,55 @@
+/// @file scene_setup.cpp
+/// @brief Shared startup steps: default star catalog, Earth orientation data.
+
+#include "core/scene_setup.hpp"
+
+#include "catalog/catalog_loader.hpp"
+#include "core/logger.hpp"
+
+#include <filesystem>
+
+namespace parallax::core
+{
+
+void load_default_star_catalog(catalog::CatalogManager& manager, catalog::MagnitudeFilter& star_layers)
+{
+    const std::filesystem::path binary_catalog_path{"data/catalogs/bright.plxcat"};
+    const std::filesystem::path catalog_path{"data/catalogs/bright_stars.csv"};
+
+    if (std::filesystem::exists(binary_catalog_path)
+        && manager.load(binary_catalog_path).has_value())
+    {
+        // Layers read the mapping directly; no heap copy of the catalog
+        star_layers.build(manager);
+        PLX_CORE_INFO("Star catalog loaded: {} stars from {}", manager.get_star_count(),
+                      binary_catalog_path.string());
+    }
+    else if (auto loaded_stars = catalog::CatalogLoader::load_bright_star_csv(catalog_path, 0);
+             loaded_stars.has_value())
+    {
+        PLX_CORE_INFO("Star catalog loaded: {} stars from {}", loaded_stars->size(), catalog_path.string());
+        star_layers.build(std::move(loaded_stars.value()));
+    }
+    else
+    {
+        PLX_CORE_WARN("Failed to load star catalog from {}. Rendering will show no stars.",
+                      catalog_path.string());
+    }
+}
+
+void load_default_earth_orientation(astro::TimeScales& time_scales)
+{
+    const std::filesystem::path iers_path{"data/iers/finals2000A.all"};
+
+    if (!std::filesystem::exists(iers_path))
+    {
+        PLX_CORE_INFO("No IERS table at {}: UT1 taken as UTC", iers_path.string());
+        return;
+    }
+    if (!time_scales.load_iers_table(iers_path))
+    {
+        PLX_CORE_WARN("Ignoring {}: UT1 taken as UTC", iers_path.string());
+    }
+}
+
+} // namespace parallax::core
@@ -0,0 +1,22 @@
+#pragma once
+
+/// @file scene_setup.hpp
+/// @brief Startup steps shared by the interactive and headless front ends.
+
+#include "astro/time_scales.hpp"
+#include "catalog/catalog_manager.hpp"
+#include "catalog/magnitude_filter.hpp"
+
+namespace parallax::core
+{
+    /// @brief Load the bundled star catalog into star_layers:
+    /// data/catalogs/bright.plxcat if present (memory-mapped by manager and
+    /// read in place), else data/catalogs/bright_stars.csv.
+    /// star_layers stays empty (logged) if neither file could be read.
+    void load_default_star_catalog(catalog::CatalogManager& manager, catalog::MagnitudeFilter& star_layers);
+
+    /// @brief Load UT1 − UTC into time_scales from data/iers/finals2000A.all
+    /// if present; without it DUT1 is taken as 0 (UT1 within 0.9 s).
+    void load_default_earth_orientation(astro::TimeScales& time_scales);
+
+} // namespace parallax::core
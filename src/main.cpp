@@ -4,21 +4,43 @@
 #define SDL_MAIN_HANDLED
 
 #include "core/application.hpp"
+#include "core/command_line.hpp"
+#include "core/headless_renderer.hpp"
 #include "core/logger.hpp"
 
+#include <cstdio>
 #include <cstdlib>
+#include <string_view>
+#include <vector>
 
-int main()
+int main(int argc, char** argv)
 {
     parallax::core::Logger::init();
     PLX_CORE_INFO("Parallax v0.1.0 starting...");
 
+    const std::vector<std::string_view> args(argv + (argc > 0 ? 1 : 0), argv + argc);
+    const auto command_line = parallax::core::parse_command_line(args);
+    if (!command_line || command_line->help)
     {
-        parallax::core::Application app;
+        const auto usage = parallax::core::get_usage();
+        std::fwrite(usage.data(), 1, usage.size(), command_line ? stdout : stderr);
+        parallax::core::Logger::shutdown();
+        return command_line ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    int exit_code = EXIT_SUCCESS;
+    if (command_line->headless)
+    {
+        parallax::core::HeadlessRenderer renderer(command_line->headless_config);
+        exit_code = renderer.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    else
+    {
+        parallax::core::Application app(command_line->frames_in_flight);
         app.run();
     }
 
     PLX_CORE_INFO("Parallax shutdown complete.");
     parallax::core::Logger::shutdown();
-    return EXIT_SUCCESS;
-}
\ No newline at end of file
+    return exit_code;
+}
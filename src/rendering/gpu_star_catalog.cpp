@@ -0,0 +1,80 @@
+/// @file gpu_star_catalog.cpp
+/// @brief GpuStarCatalog packing and StarCullPushConstants construction.
+
+#include "rendering/gpu_star_catalog.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace parallax::rendering
+{
+
+// -----------------------------------------------------------------
+// Catalog packing
+// -----------------------------------------------------------------
+
+GpuStarCatalog GpuStarCatalog::from_layers(const catalog::MagnitudeFilter& star_layers)
+{
+    std::vector<Vec4f> direction_mag;
+    std::vector<f32> color_bv;
+    direction_mag.reserve(star_layers.get_star_count());
+    color_bv.reserve(star_layers.get_star_count());
+
+    // Every layer, including those the CPU path has not loaded
+    star_layers.visit_all_layers([&](u32 /*layer*/, const catalog::SpatialIndex& index) {
+        const auto& stars = index.get_stars();
+        const auto mag = stars.get_mag_v();
+        const auto color = stars.get_color_bv();
+
+        for (std::size_t i = 0; i < stars.size(); ++i)
+        {
+            direction_mag.emplace_back(Vec3f{stars.get_direction(i)}, mag[i]);
+            color_bv.push_back(color[i]);
+        }
+    });
+
+    // Brightest first; stable so equal magnitudes keep (layer, pixel) order
+    std::vector<u32> order(direction_mag.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](u32 a, u32 b) {
+        return direction_mag[a].w < direction_mag[b].w;
+    });
+
+    GpuStarCatalog catalog;
+    catalog.direction_mag.reserve(order.size());
+    catalog.color_bv.reserve(order.size());
+    for (const u32 row : order)
+    {
+        catalog.direction_mag.push_back(direction_mag[row]);
+        catalog.color_bv.push_back(color_bv[row]);
+    }
+    return catalog;
+}
+
+// -----------------------------------------------------------------
+// Push constants
+// -----------------------------------------------------------------
+
+StarCullPushConstants StarCullPushConstants::from_projection(const ProjectionContext& projection,
+                                                             f32 mag_limit,
+                                                             u32 star_count)
+{
+    // glm matrices are column-major: row r is (m[0][r], m[1][r], m[2][r])
+    const Mat3d& m = projection.get_view_matrix();
+    const auto row = [&](int r) {
+        return Vec4f{static_cast<f32>(m[0][r]), static_cast<f32>(m[1][r]), static_cast<f32>(m[2][r]), 0.0f};
+    };
+
+    return StarCullPushConstants{
+        .view_right = row(0),
+        .view_up = row(1),
+        .view_forward = row(2),
+        .zenith = Vec4f{Vec3f{projection.get_zenith()}, static_cast<f32>(projection.get_cos_cull())},
+        .scale = static_cast<f32>(projection.get_scale()),
+        .mag_limit = mag_limit,
+        .star_count = star_count,
+        .padding = 0,
+    };
+}
+
+} // namespace parallax::rendering
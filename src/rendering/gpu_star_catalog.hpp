@@ -0,0 +1,55 @@
+#pragma once
+
+/// @file gpu_star_catalog.hpp
+/// @brief Static star catalog layout and per-frame parameters for the compute cull path.
+
+#include "catalog/magnitude_filter.hpp"
+#include "core/types.hpp"
+#include "rendering/projection_context.hpp"
+
+#include <vector>
+
+namespace parallax::rendering
+{
+    /// @brief Whole catalog in the layout starfield_cull.comp reads.
+    ///
+    /// Uploaded once; afterwards the GPU path only needs a push constant per
+    /// frame. Stars are sorted brightest first across all magnitude layers,
+    /// so the stars within a magnitude limit are a prefix and the dispatch
+    /// only needs to cover that prefix.
+    struct GpuStarCatalog
+    {
+        std::vector<Vec4f> direction_mag;   ///< xyz = J2000 unit vector, w = visual magnitude
+        std::vector<f32> color_bv;          ///< B-V color index, same row order
+
+        /// @brief Gather every layer of a magnitude filter, brightest first.
+        [[nodiscard]] static GpuStarCatalog from_layers(const catalog::MagnitudeFilter& star_layers);
+
+        [[nodiscard]] u32 size() const { return static_cast<u32>(direction_mag.size()); }
+        [[nodiscard]] bool empty() const { return direction_mag.empty(); }
+    };
+
+    /// @brief Push constants of starfield_cull.comp (std430-compatible, 80 bytes).
+    ///
+    /// The view rotation is passed as three rows so the shader computes the
+    /// camera-frame vector with three dot products and no mat3 padding rules
+    /// are involved. Values are ProjectionContext's, rounded to f32.
+    struct StarCullPushConstants
+    {
+        Vec4f view_right;       ///< Row 0 of the input → camera rotation (w unused)
+        Vec4f view_up;          ///< Row 1
+        Vec4f view_forward;     ///< Row 2
+        Vec4f zenith;           ///< xyz = zenith in the input frame, w = cos(FOV × 0.75)
+        f32 scale;              ///< 1 / tan(FOV / 2)
+        f32 mag_limit;          ///< Faintest magnitude drawn
+        u32 star_count;         ///< Catalog rows to test (bright prefix)
+        u32 padding;
+
+        /// @brief Pack a frame's projection for the shader.
+        [[nodiscard]] static StarCullPushConstants from_projection(const ProjectionContext& projection,
+                                                                   f32 mag_limit,
+                                                                   u32 star_count);
+    };
+    static_assert(sizeof(StarCullPushConstants) == 80, "StarCullPushConstants must match the shader block");
+
+} // namespace parallax::rendering
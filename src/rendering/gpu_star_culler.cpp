@@ -0,0 +1,425 @@
+/// @file gpu_star_culler.cpp
+/// @brief GpuStarCuller implementation: catalog upload, compute pipeline, per-frame dispatch.
+
+#include "rendering/gpu_star_culler.hpp"
+
+#include "core/logger.hpp"
+#include "rendering/star_vertex.hpp"
+#include "vulkan/shader_module.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+void check_vk(VkResult result, const char* operation)
+{
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("Vulkan error in {}: VkResult = {}", operation, static_cast<int>(result));
+        std::abort();
+    }
+}
+
+} // anonymous namespace
+
+namespace parallax::rendering
+{
+
+// -----------------------------------------------------------------
+// Construction / Destruction
+// -----------------------------------------------------------------
+
+GpuStarCuller::GpuStarCuller(const vulkan::Context& context,
+                             const std::filesystem::path& shader_dir,
+                             const GpuStarCatalog& catalog)
+    : m_context{context}
+    , m_star_count{catalog.size()}
+{
+    m_magnitudes.reserve(m_star_count);
+    for (const auto& star : catalog.direction_mag)
+    {
+        m_magnitudes.push_back(star.w);
+    }
+
+    create_buffers(catalog);
+    upload_catalog(catalog);
+    create_descriptors();
+    create_pipeline(shader_dir);
+
+    PLX_CORE_INFO("GPU star culler initialized ({} stars resident, {} KiB)",
+                  m_star_count,
+                  (m_color_offset + sizeof(f32) * m_star_count) / 1024);
+}
+
+GpuStarCuller::~GpuStarCuller()
+{
+    VkDevice device = m_context.get_device();
+
+    if (m_pipeline != VK_NULL_HANDLE)
+    {
+        vkDestroyPipeline(device, m_pipeline, nullptr);
+    }
+    if (m_pipeline_layout != VK_NULL_HANDLE)
+    {
+        vkDestroyPipelineLayout(device, m_pipeline_layout, nullptr);
+    }
+    if (m_descriptor_pool != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorPool(device, m_descriptor_pool, nullptr);
+    }
+    if (m_descriptor_set_layout != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorSetLayout(device, m_descriptor_set_layout, nullptr);
+    }
+
+    auto& allocator = m_context.get_allocator();
+    allocator.destroy_buffer(m_indirect);
+    allocator.destroy_buffer(m_instances);
+    allocator.destroy_buffer(m_catalog);
+
+    PLX_CORE_TRACE("GPU star culler destroyed");
+}
+
+// -----------------------------------------------------------------
+// record() — reset counter, cull, make results visible to the draw
+// -----------------------------------------------------------------
+
+void GpuStarCuller::record(VkCommandBuffer cmd, const StarCullPushConstants& push_constants) const
+{
+    // Earlier frames' draws may still read the instance buffer and the
+    // indirect command: let them finish before both are overwritten
+    vkCmdPipelineBarrier(cmd,
+                         VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+    // vertexCount = 1 (one point per instance), instanceCount = 0
+    const VkDrawIndirectCommand reset{
+        .vertexCount = 1,
+        .instanceCount = 0,
+        .firstVertex = 0,
+        .firstInstance = 0,
+    };
+    vkCmdUpdateBuffer(cmd, m_indirect.buffer, 0, sizeof(reset), &reset);
+
+    VkBufferMemoryBarrier reset_barrier{};
+    reset_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    reset_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    reset_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    reset_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    reset_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    reset_barrier.buffer = m_indirect.buffer;
+    reset_barrier.offset = 0;
+    reset_barrier.size = VK_WHOLE_SIZE;
+
+    vkCmdPipelineBarrier(cmd,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         0, 0, nullptr, 1, &reset_barrier, 0, nullptr);
+
+    if (push_constants.star_count > 0)
+    {
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipeline);
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE,
+                                m_pipeline_layout, 0, 1,
+                                &m_descriptor_set, 0, nullptr);
+        vkCmdPushConstants(cmd, m_pipeline_layout,
+                           VK_SHADER_STAGE_COMPUTE_BIT,
+                           0, sizeof(StarCullPushConstants),
+                           &push_constants);
+
+        const u32 group_count = (push_constants.star_count + kWorkgroupSize - 1) / kWorkgroupSize;
+        vkCmdDispatch(cmd, group_count, 1, 1);
+    }
+
+    // Appended stars → vertex shader, final count → indirect draw
+    VkMemoryBarrier cull_barrier{};
+    cull_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    cull_barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    cull_barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+
+    vkCmdPipelineBarrier(cmd,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                         0, 1, &cull_barrier, 0, nullptr, 0, nullptr);
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+VkBuffer GpuStarCuller::get_instance_buffer() const
+{
+    return m_instances.buffer;
+}
+
+VkDeviceSize GpuStarCuller::get_instance_buffer_size() const
+{
+    return sizeof(PackedStarVertex) * static_cast<VkDeviceSize>(m_star_count);
+}
+
+VkBuffer GpuStarCuller::get_indirect_buffer() const
+{
+    return m_indirect.buffer;
+}
+
+u32 GpuStarCuller::get_star_count() const
+{
+    return m_star_count;
+}
+
+u32 GpuStarCuller::count_within(f32 mag_limit) const
+{
+    const auto end = std::upper_bound(m_magnitudes.begin(), m_magnitudes.end(), mag_limit);
+    return static_cast<u32>(end - m_magnitudes.begin());
+}
+
+// -----------------------------------------------------------------
+// Buffers (device-local)
+//
+// The catalog holds both columns in one allocation; the color column
+// starts at an offset usable as a storage-buffer descriptor offset.
+// -----------------------------------------------------------------
+
+void GpuStarCuller::create_buffers(const GpuStarCatalog& catalog)
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(m_context.get_physical_device(), &properties);
+    const VkDeviceSize offset_alignment = std::max<VkDeviceSize>(
+        properties.limits.minStorageBufferOffsetAlignment, 1);
+
+    const VkDeviceSize direction_bytes = sizeof(Vec4f) * catalog.direction_mag.size();
+    m_color_offset = (direction_bytes + offset_alignment - 1) / offset_alignment * offset_alignment;
+    const VkDeviceSize catalog_bytes = m_color_offset + sizeof(f32) * catalog.color_bv.size();
+
+    auto& allocator = m_context.get_allocator();
+
+    m_catalog = allocator.create_buffer(vulkan::BufferDesc{
+        .size = catalog_bytes,
+        .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        .location = vulkan::MemoryLocation::DeviceLocal,
+        .category = vulkan::MemoryCategory::CatalogTiles,
+    });
+
+    m_instances = allocator.create_buffer(vulkan::BufferDesc{
+        .size = get_instance_buffer_size(),
+        .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        .location = vulkan::MemoryLocation::DeviceLocal,
+        .category = vulkan::MemoryCategory::InstanceBuffers,
+    });
+
+    m_indirect = allocator.create_buffer(vulkan::BufferDesc{
+        .size = sizeof(VkDrawIndirectCommand),
+        .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT
+               | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        .location = vulkan::MemoryLocation::DeviceLocal,
+        .category = vulkan::MemoryCategory::InstanceBuffers,
+    });
+
+    PLX_CORE_TRACE("GPU star culler buffers created: catalog {} bytes, instances {} bytes",
+                   catalog_bytes, get_instance_buffer_size());
+}
+
+// -----------------------------------------------------------------
+// One-time catalog upload: staging buffer → device-local copy
+// -----------------------------------------------------------------
+
+void GpuStarCuller::upload_catalog(const GpuStarCatalog& catalog)
+{
+    VkDevice device = m_context.get_device();
+
+    const VkDeviceSize direction_bytes = sizeof(Vec4f) * catalog.direction_mag.size();
+    const VkDeviceSize color_bytes = sizeof(f32) * catalog.color_bv.size();
+    const VkDeviceSize staging_bytes = m_color_offset + color_bytes;
+
+    auto& allocator = m_context.get_allocator();
+    vulkan::Buffer staging = allocator.create_buffer(vulkan::BufferDesc{
+        .size = staging_bytes,
+        .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        .location = vulkan::MemoryLocation::HostUpload,
+        .category = vulkan::MemoryCategory::Staging,
+    });
+
+    std::memcpy(staging.mapped, catalog.direction_mag.data(), direction_bytes);
+    std::memcpy(static_cast<std::byte*>(staging.mapped) + m_color_offset, catalog.color_bv.data(), color_bytes);
+
+    // Transient pool: the upload happens once, at load time
+    VkCommandPoolCreateInfo pool_info{};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    pool_info.queueFamilyIndex = m_context.get_graphics_queue_family();
+
+    VkCommandPool pool = VK_NULL_HANDLE;
+    check_vk(vkCreateCommandPool(device, &pool_info, nullptr, &pool),
+             "vkCreateCommandPool (GPU star upload)");
+
+    VkCommandBufferAllocateInfo alloc_info{};
+    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.commandPool = pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = 1;
+
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    check_vk(vkAllocateCommandBuffers(device, &alloc_info, &cmd),
+             "vkAllocateCommandBuffers (GPU star upload)");
+
+    VkCommandBufferBeginInfo begin_info{};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    check_vk(vkBeginCommandBuffer(cmd, &begin_info), "vkBeginCommandBuffer (GPU star upload)");
+
+    const VkBufferCopy region{
+        .srcOffset = 0,
+        .dstOffset = 0,
+        .size = staging_bytes,
+    };
+    vkCmdCopyBuffer(cmd, staging.buffer, m_catalog.buffer, 1, &region);
+
+    // Later compute dispatches read the copied catalog
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = m_catalog.buffer;
+    barrier.offset = 0;
+    barrier.size = VK_WHOLE_SIZE;
+    vkCmdPipelineBarrier(cmd,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+    check_vk(vkEndCommandBuffer(cmd), "vkEndCommandBuffer (GPU star upload)");
+
+    VkSubmitInfo submit_info{};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &cmd;
+
+    check_vk(vkQueueSubmit(m_context.get_graphics_queue(), 1, &submit_info, VK_NULL_HANDLE),
+             "vkQueueSubmit (GPU star upload)");
+    check_vk(vkQueueWaitIdle(m_context.get_graphics_queue()), "vkQueueWaitIdle (GPU star upload)");
+
+    vkDestroyCommandPool(device, pool, nullptr);
+    allocator.destroy_buffer(staging);
+}
+
+// -----------------------------------------------------------------
+// Descriptors: catalog directions, catalog colors, instances, draw command
+// -----------------------------------------------------------------
+
+void GpuStarCuller::create_descriptors()
+{
+    VkDevice device = m_context.get_device();
+
+    constexpr u32 kBindingCount = 4;
+    std::array<VkDescriptorSetLayoutBinding, kBindingCount> bindings{};
+    for (u32 i = 0; i < kBindingCount; ++i)
+    {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+
+    VkDescriptorSetLayoutCreateInfo layout_info{};
+    layout_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layout_info.bindingCount = kBindingCount;
+    layout_info.pBindings = bindings.data();
+
+    check_vk(vkCreateDescriptorSetLayout(device, &layout_info, nullptr, &m_descriptor_set_layout),
+             "vkCreateDescriptorSetLayout (GPU star culler)");
+
+    VkDescriptorPoolSize pool_size{};
+    pool_size.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    pool_size.descriptorCount = kBindingCount;
+
+    VkDescriptorPoolCreateInfo pool_info{};
+    pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    pool_info.poolSizeCount = 1;
+    pool_info.pPoolSizes = &pool_size;
+    pool_info.maxSets = 1;
+
+    check_vk(vkCreateDescriptorPool(device, &pool_info, nullptr, &m_descriptor_pool),
+             "vkCreateDescriptorPool (GPU star culler)");
+
+    VkDescriptorSetAllocateInfo alloc_info{};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorPool = m_descriptor_pool;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.pSetLayouts = &m_descriptor_set_layout;
+
+    check_vk(vkAllocateDescriptorSets(device, &alloc_info, &m_descriptor_set),
+             "vkAllocateDescriptorSets (GPU star culler)");
+
+    const std::array<VkDescriptorBufferInfo, kBindingCount> buffer_infos = {{
+        {m_catalog.buffer, 0, sizeof(Vec4f) * m_star_count},
+        {m_catalog.buffer, m_color_offset, sizeof(f32) * m_star_count},
+        {m_instances.buffer, 0, VK_WHOLE_SIZE},
+        {m_indirect.buffer, 0, VK_WHOLE_SIZE},
+    }};
+
+    std::array<VkWriteDescriptorSet, kBindingCount> writes{};
+    for (u32 i = 0; i < kBindingCount; ++i)
+    {
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = m_descriptor_set;
+        writes[i].dstBinding = i;
+        writes[i].dstArrayElement = 0;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[i].descriptorCount = 1;
+        writes[i].pBufferInfo = &buffer_infos[i];
+    }
+
+    vkUpdateDescriptorSets(device, kBindingCount, writes.data(), 0, nullptr);
+}
+
+// -----------------------------------------------------------------
+// Compute pipeline: starfield_cull.comp + push constants
+// -----------------------------------------------------------------
+
+void GpuStarCuller::create_pipeline(const std::filesystem::path& shader_dir)
+{
+    VkDevice device = m_context.get_device();
+
+    VkShaderModule comp_module = vulkan::create_shader_module(device, shader_dir / "starfield_cull.comp.spv");
+
+    VkPushConstantRange push_range{};
+    push_range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    push_range.offset = 0;
+    push_range.size = sizeof(StarCullPushConstants);
+
+    VkPipelineLayoutCreateInfo layout_info{};
+    layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layout_info.setLayoutCount = 1;
+    layout_info.pSetLayouts = &m_descriptor_set_layout;
+    layout_info.pushConstantRangeCount = 1;
+    layout_info.pPushConstantRanges = &push_range;
+
+    check_vk(vkCreatePipelineLayout(device, &layout_info, nullptr, &m_pipeline_layout),
+             "vkCreatePipelineLayout (GPU star culler)");
+
+    VkComputePipelineCreateInfo pipeline_info{};
+    pipeline_info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipeline_info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipeline_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_info.stage.module = comp_module;
+    pipeline_info.stage.pName = "main";
+    pipeline_info.layout = m_pipeline_layout;
+
+    m_pipeline = m_context.get_pipeline_cache().create_compute_pipeline(pipeline_info, "GPU star cull");
+
+    PLX_CORE_INFO("GPU star cull pipeline created (workgroup {}, push constants {} bytes)",
+                  kWorkgroupSize, sizeof(StarCullPushConstants));
+
+    vkDestroyShaderModule(device, comp_module, nullptr);
+}
+
+} // namespace parallax::rendering
@@ -0,0 +1,101 @@
+#pragma once
+
+/// @file gpu_star_culler.hpp
+/// @brief Compute-shader star transform and cull: static catalog buffers + indirect draw.
+
+#include "core/types.hpp"
+#include "rendering/gpu_star_catalog.hpp"
+#include "vulkan/allocator.hpp"
+#include "vulkan/context.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <filesystem>
+#include <vector>
+
+namespace parallax::rendering
+{
+    /// @brief Runs starfield_cull.comp over a catalog uploaded once to device-local memory.
+    ///
+    /// Owns:
+    /// - the catalog buffer (direction + magnitude rows, then B-V colors),
+    ///   filled through a staging copy at construction and never written again;
+    /// - the instance buffer the shader appends visible stars to (one slot per
+    ///   catalog star, so it cannot overflow), as PackedStarVertex;
+    /// - a VkDrawIndirectCommand whose instanceCount is the append counter.
+    ///
+    /// Per frame the CPU only records a push constant and a dispatch, so no
+    /// star data crosses the bus. Everything used is core Vulkan 1.0 (no
+    /// subgroup operations, no 64-bit shader types), which keeps the path
+    /// runnable on software drivers such as lavapipe.
+    class GpuStarCuller
+    {
+    public:
+        /// @brief Upload the catalog and create the compute pipeline.
+        /// @param context The Vulkan context (device, graphics queue).
+        /// @param shader_dir Directory containing compiled SPIR-V files.
+        /// @param catalog Stars to upload (must not be empty).
+        GpuStarCuller(const vulkan::Context& context,
+                      const std::filesystem::path& shader_dir,
+                      const GpuStarCatalog& catalog);
+
+        /// @brief Destroy all GPU resources.
+        ~GpuStarCuller();
+
+        GpuStarCuller(const GpuStarCuller&) = delete;
+        GpuStarCuller& operator=(const GpuStarCuller&) = delete;
+        GpuStarCuller(GpuStarCuller&&) = delete;
+        GpuStarCuller& operator=(GpuStarCuller&&) = delete;
+
+        /// @brief Record the reset, dispatch and barriers that make the
+        /// instance and indirect buffers ready for the vertex stage.
+        ///
+        /// Must be recorded outside a render pass, before the draw that reads
+        /// the result. Also waits for earlier draws still reading the buffers.
+        void record(VkCommandBuffer cmd, const StarCullPushConstants& push_constants) const;
+
+        /// @brief Visible stars as PackedStarVertex (valid after record()).
+        [[nodiscard]] VkBuffer get_instance_buffer() const;
+
+        /// @brief Bytes of the instance buffer (catalog size × sizeof(PackedStarVertex)).
+        [[nodiscard]] VkDeviceSize get_instance_buffer_size() const;
+
+        /// @brief One VkDrawIndirectCommand (1 vertex, visible-star instances).
+        [[nodiscard]] VkBuffer get_indirect_buffer() const;
+
+        /// @brief Stars uploaded.
+        [[nodiscard]] u32 get_star_count() const;
+
+        /// @brief Leading catalog rows with magnitude ≤ mag_limit (the
+        /// dispatch size for that limit; the catalog is brightest first).
+        [[nodiscard]] u32 count_within(f32 mag_limit) const;
+
+    private:
+        void create_buffers(const GpuStarCatalog& catalog);
+        void upload_catalog(const GpuStarCatalog& catalog);
+        void create_descriptors();
+        void create_pipeline(const std::filesystem::path& shader_dir);
+
+        const vulkan::Context& m_context;
+        u32 m_star_count = 0;
+        std::vector<f32> m_magnitudes;          ///< Host copy of the sorted magnitude column
+
+        // Catalog: direction_mag rows at 0, colors at m_color_offset
+        vulkan::Buffer m_catalog;
+        VkDeviceSize m_color_offset = 0;        ///< Aligned to minStorageBufferOffsetAlignment
+
+        vulkan::Buffer m_instances;
+        vulkan::Buffer m_indirect;
+
+        VkDescriptorSetLayout m_descriptor_set_layout = VK_NULL_HANDLE;
+        VkDescriptorPool m_descriptor_pool = VK_NULL_HANDLE;
+        VkDescriptorSet m_descriptor_set = VK_NULL_HANDLE;
+
+        VkPipelineLayout m_pipeline_layout = VK_NULL_HANDLE;
+        VkPipeline m_pipeline = VK_NULL_HANDLE;
+
+        /// Must match local_size_x in starfield_cull.comp
+        static constexpr u32 kWorkgroupSize = 256;
+    };
+
+} // namespace parallax::rendering
@@ -0,0 +1,134 @@
+/// @file projection_context.cpp
+/// @brief ProjectionContext: per-frame camera rotation + batch gnomonic projection.
+
+#include "rendering/projection_context.hpp"
+
+#include "core/types.hpp"
+
+#include <glm/matrix.hpp>
+
+#include <cassert>
+#include <cmath>
+
+namespace parallax::rendering
+{
+
+// -----------------------------------------------------------------
+// Construction
+//
+// Camera frame in horizontal components (north, east, zenith), for a
+// pointing at (alt_p, az_p):
+//   right   = (-sin az_p,          cos az_p,          0)
+//   up      = (-sin alt_p cos az_p, -sin alt_p sin az_p, cos alt_p)
+//   forward = ( cos alt_p cos az_p,  cos alt_p sin az_p, sin alt_p)
+//
+// For a star h, (h·right, h·up, h·forward) are exactly dx, dy and cos_sep
+// of Coordinates::horizontal_to_screen.
+// -----------------------------------------------------------------
+
+ProjectionContext::ProjectionContext(const Camera& camera, const Mat3d& to_horizontal)
+{
+    const auto pointing = camera.get_pointing();
+    const f64 fov_rad = camera.get_fov_rad();
+
+    const f64 sin_alt = std::sin(pointing.alt);
+    const f64 cos_alt = std::cos(pointing.alt);
+    const f64 sin_az  = std::sin(pointing.az);
+    const f64 cos_az  = std::cos(pointing.az);
+
+    // Written as rows; glm matrices are column-major
+    const Mat3d horizontal_to_view = glm::transpose(Mat3d{
+        Vec3d{-sin_az,            cos_az,            0.0},        // right
+        Vec3d{-sin_alt * cos_az, -sin_alt * sin_az,  cos_alt},    // up
+        Vec3d{ cos_alt * cos_az,  cos_alt * sin_az,  sin_alt},    // forward
+    });
+
+    m_to_view = horizontal_to_view * to_horizontal;
+
+    // Zenith in the input frame: third row of to_horizontal
+    m_zenith = Vec3d{to_horizontal[0][2], to_horizontal[1][2], to_horizontal[2][2]};
+
+    m_cos_cull = std::cos(fov_rad * 0.75);
+    m_scale = 1.0 / std::tan(fov_rad * 0.5);
+}
+
+// -----------------------------------------------------------------
+// Batch projection: rotate, cull, divide, compact
+// -----------------------------------------------------------------
+
+u32 ProjectionContext::project(std::span<const f64> x, std::span<const f64> y, std::span<const f64> z,
+                               std::span<StarVertex> vertices) const
+{
+    assert(y.size() == x.size() && z.size() == x.size());
+    assert(vertices.size() >= x.size());
+
+    // Matrix rows as scalars (glm is column-major: m[column][row]), so each
+    // component is three multiply-adds over the x/y/z columns
+    const f64 zen_x = m_zenith.x, zen_y = m_zenith.y, zen_z = m_zenith.z;
+    const f64 r00 = m_to_view[0][0], r01 = m_to_view[1][0], r02 = m_to_view[2][0];
+    const f64 r10 = m_to_view[0][1], r11 = m_to_view[1][1], r12 = m_to_view[2][1];
+    const f64 r20 = m_to_view[0][2], r21 = m_to_view[1][2], r22 = m_to_view[2][2];
+
+    u32 visible = 0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        // Below the horizon
+        if (zen_x * x[i] + zen_y * y[i] + zen_z * z[i] < 0.0)
+        {
+            continue;
+        }
+
+        // Outside the view cone (separation > FOV × 0.75), or behind the
+        // tangent plane where the projection is undefined
+        const f64 view_z = r20 * x[i] + r21 * y[i] + r22 * z[i];
+        if (view_z < m_cos_cull || view_z <= 0.0)
+        {
+            continue;
+        }
+
+        const f64 view_x = r00 * x[i] + r01 * y[i] + r02 * z[i];
+        const f64 view_y = r10 * x[i] + r11 * y[i] + r12 * z[i];
+        const f64 inv_z = m_scale / view_z;
+        const auto screen_x = static_cast<f32>(view_x * inv_z);
+        const auto screen_y = static_cast<f32>(view_y * inv_z);
+
+        if (std::abs(screen_x) > 1.0f || std::abs(screen_y) > 1.0f)
+        {
+            continue;
+        }
+
+        StarVertex& out = vertices[visible++];
+        out.screen_x   = screen_x;
+        out.screen_y   = screen_y;
+        out.brightness = vertices[i].brightness;
+        out.color_bv   = vertices[i].color_bv;
+    }
+
+    return visible;
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+const Mat3d& ProjectionContext::get_view_matrix() const
+{
+    return m_to_view;
+}
+
+f64 ProjectionContext::get_cos_cull() const
+{
+    return m_cos_cull;
+}
+
+const Vec3d& ProjectionContext::get_zenith() const
+{
+    return m_zenith;
+}
+
+f64 ProjectionContext::get_scale() const
+{
+    return m_scale;
+}
+
+} // namespace parallax::rendering
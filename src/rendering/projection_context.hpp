@@ -0,0 +1,68 @@
+#pragma once
+
+/// @file projection_context.hpp
+/// @brief Per-frame screen projection with all camera-dependent trig hoisted out of the star loop.
+
+#include "core/types.hpp"
+#include "rendering/camera.hpp"
+#include "rendering/star_vertex.hpp"
+
+#include <span>
+
+namespace parallax::rendering
+{
+    /// @brief Camera state reduced to a rotation and three scalars, built once per frame.
+    ///
+    /// Produces the same screen positions as Coordinates::horizontal_to_screen
+    /// (which stays the scalar reference), but works on unit vectors:
+    /// - one 3×3 rotation takes a star into the camera frame
+    ///   (x = right, y = up, z = forward), so z is cos(separation);
+    /// - the FOV test compares z with cos(FOV × 0.75) instead of taking acos;
+    /// - the tangent-plane projection is x/z, y/z times 1 / tan(FOV / 2).
+    ///
+    /// The input frame is whatever `to_horizontal` maps from: pass the
+    /// per-frame equatorial → horizontal matrix to project J2000 directions
+    /// directly, or the identity for vectors already in the horizontal frame.
+    class ProjectionContext
+    {
+    public:
+        /// @param camera Pointing and field of view for this frame.
+        /// @param to_horizontal Rotation from the input frame to the horizontal
+        ///                      frame (x = north, y = east, z = zenith).
+        explicit ProjectionContext(const Camera& camera, const Mat3d& to_horizontal = Mat3d{1.0});
+
+        /// @brief Project a batch of unit vectors and keep the visible ones.
+        ///
+        /// The vectors come as separate x/y/z columns (the StarCatalogSoA
+        /// layout). vertices[i] belongs to row i; its brightness and color_bv
+        /// are filled by the caller beforehand. Stars below the horizon, outside
+        /// the view cone or off screen are dropped, and the survivors are
+        /// compacted to the front of `vertices` (order preserved) with their
+        /// screen position filled in.
+        ///
+        /// @param x, y, z Unit vector components in the input frame (same size).
+        /// @param vertices At least x.size() slots.
+        /// @return Number of visible stars now at the front of `vertices`.
+        u32 project(std::span<const f64> x, std::span<const f64> y, std::span<const f64> z,
+                    std::span<StarVertex> vertices) const;
+
+        /// @brief Full rotation from the input frame to the camera frame.
+        [[nodiscard]] const Mat3d& get_view_matrix() const;
+
+        /// @brief cos(FOV × 0.75): stars with a smaller camera-frame z are culled.
+        [[nodiscard]] f64 get_cos_cull() const;
+
+        /// @brief Zenith direction in the input frame (horizon test).
+        [[nodiscard]] const Vec3d& get_zenith() const;
+
+        /// @brief 1 / tan(FOV / 2): tangent-plane coordinate → NDC.
+        [[nodiscard]] f64 get_scale() const;
+
+    private:
+        Mat3d m_to_view;        ///< Input frame → camera frame (right, up, forward)
+        Vec3d m_zenith;         ///< Zenith in the input frame (horizon test)
+        f64 m_cos_cull;         ///< cos(FOV × 0.75)
+        f64 m_scale;            ///< 1 / tan(FOV / 2)
+    };
+
+} // namespace parallax::rendering
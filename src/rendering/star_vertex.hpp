@@ -0,0 +1,61 @@
+#pragma once
+
+/// @file star_vertex.hpp
+/// @brief Per-instance star data shared by the CPU projection and the starfield shader.
+
+#include "core/types.hpp"
+
+#include <glm/gtc/packing.hpp>
+
+namespace parallax::rendering
+{
+    /// @brief Per-instance star data as produced by the projection (full precision).
+    /// Working format on the CPU; the GPU receives PackedStarVertex.
+    struct StarVertex
+    {
+        f32 screen_x;      ///< Normalized device coords [-1, 1]
+        f32 screen_y;      ///< Normalized device coords [-1, 1]
+        f32 brightness;    ///< Linear brightness (Pogson formula)
+        f32 color_bv;      ///< B-V color index (converted to RGB in shader)
+    };
+
+    /// @brief 8-byte star instance read by starfield.vert as a uvec2.
+    ///
+    /// - position: screen x/y as 16-bit unorm over [-1, 1] (x in the low half),
+    ///   decoded with unpackUnorm2x16. One step is 2/65535 NDC, i.e. 0.06 px
+    ///   across 3840 px, so the worst-case rounding error is 0.03 px.
+    /// - brightness_color: brightness and B-V as half floats (brightness in
+    ///   the low half), decoded with unpackHalf2x16; ~3 significant digits,
+    ///   well beyond what 8-bit output can show.
+    ///
+    /// Half the bytes of StarVertex, so per-frame upload and buffer memory halve.
+    struct PackedStarVertex
+    {
+        u32 position;
+        u32 brightness_color;
+    };
+    static_assert(sizeof(PackedStarVertex) == 8, "PackedStarVertex must match uvec2 in starfield.vert");
+
+    /// @brief Quantize a vertex; the same encoding starfield_cull.comp writes.
+    [[nodiscard]] inline PackedStarVertex pack_star_vertex(const StarVertex& vertex)
+    {
+        return PackedStarVertex{
+            .position = glm::packUnorm2x16(Vec2f{vertex.screen_x, vertex.screen_y} * 0.5f + 0.5f),
+            .brightness_color = glm::packHalf2x16(Vec2f{vertex.brightness, vertex.color_bv}),
+        };
+    }
+
+    /// @brief Decode as the vertex shader does.
+    [[nodiscard]] inline StarVertex unpack_star_vertex(const PackedStarVertex& packed)
+    {
+        const Vec2f position = glm::unpackUnorm2x16(packed.position) * 2.0f - 1.0f;
+        const Vec2f brightness_color = glm::unpackHalf2x16(packed.brightness_color);
+        return StarVertex{
+            .screen_x = position.x,
+            .screen_y = position.y,
+            .brightness = brightness_color.x,
+            .color_bv = brightness_color.y,
+        };
+    }
+
+} // namespace parallax::rendering
@@ -5,12 +5,13 @@
 
 #include "core/logger.hpp"
 #include "core/types.hpp"
+#include "vulkan/shader_module.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
-#include <cstring>
-#include <fstream>
+#include <limits>
 
 namespace
 {
@@ -24,27 +25,6 @@ void check_vk(VkResult result, const char* operation)
     }
 }
 
-/// @brief Find a suitable memory type for the given requirements.
-uint32_t find_memory_type(VkPhysicalDevice physical_device,
-                          uint32_t type_filter,
-                          VkMemoryPropertyFlags properties)
-{
-    VkPhysicalDeviceMemoryProperties mem_props;
-    vkGetPhysicalDeviceMemoryProperties(physical_device, &mem_props);
-
-    for (uint32_t i = 0; i < mem_props.memoryTypeCount; ++i)
-    {
-        if ((type_filter & (1u << i)) &&
-            (mem_props.memoryTypes[i].propertyFlags & properties) == properties)
-        {
-            return i;
-        }
-    }
-
-    PLX_CORE_CRITICAL("Failed to find suitable memory type");
-    std::abort();
-}
-
 } // anonymous namespace
 
 namespace parallax::rendering
@@ -55,17 +35,24 @@ namespace parallax::rendering
 // -----------------------------------------------------------------
 
 Starfield::Starfield(const vulkan::Context& context,
+                     core::JobSystem& jobs,
                      VkRenderPass render_pass,
                      const std::filesystem::path& shader_dir,
+                     u32 frames_in_flight,
                      u32 max_stars)
     : m_context{context}
+    , m_jobs{jobs}
+    , m_staged_upload{!context.has_unified_memory() && context.supports_timeline_semaphores()}
 {
-    create_storage_buffer(max_stars);
+    create_storage_buffer(max_stars, frames_in_flight);
+    create_upload_resources(frames_in_flight);
     create_descriptor_set_layout();
     create_descriptor_pool_and_set();
     create_pipeline(render_pass, shader_dir);
 
-    PLX_CORE_INFO("Starfield renderer initialized (buffer capacity: {} stars)", max_stars);
+    PLX_CORE_INFO("Starfield renderer initialized (buffer capacity: {} stars x {} frames in flight, {})",
+                  max_stars, frames_in_flight,
+                  m_staged_upload ? "device-local, staged uploads" : "host-visible");
 }
 
 Starfield::~Starfield()
@@ -88,14 +75,16 @@ Starfield::~Starfield()
     {
         vkDestroyDescriptorSetLayout(device, m_descriptor_set_layout, nullptr);
     }
-    if (m_storage_buffer != VK_NULL_HANDLE)
+    if (m_upload_semaphore != VK_NULL_HANDLE)
     {
-        vkDestroyBuffer(device, m_storage_buffer, nullptr);
+        vkDestroySemaphore(device, m_upload_semaphore, nullptr);
     }
-    if (m_storage_memory != VK_NULL_HANDLE)
+    if (m_transfer_pool != VK_NULL_HANDLE)
     {
-        vkFreeMemory(device, m_storage_memory, nullptr);
+        vkDestroyCommandPool(device, m_transfer_pool, nullptr);
     }
+    m_context.get_allocator().destroy_buffer(m_staging);
+    m_context.get_allocator().destroy_buffer(m_storage);
 
     PLX_CORE_TRACE("Starfield renderer destroyed");
 }
@@ -104,78 +93,303 @@ Starfield::~Starfield()
 // update() — CPU-side transform pipeline
 // -----------------------------------------------------------------
 
-void Starfield::update(std::span<const catalog::StarEntry> stars,
-                       const astro::ObserverLocation& observer,
-                       f64 lst,
-                       const Camera& camera)
+void Starfield::update(const catalog::MagnitudeFilter& star_layers,
+                       const Mat3d& celestial_to_horizontal,
+                       const Camera& camera,
+                       core::FrameArena& arena,
+                       u32 frame_index)
 {
+    // The slot's previous upload may still be reading its staging region
+    // (the graphics fence only covers uploads that frame actually waited on)
+    if (m_upload_values[frame_index] != 0)
+    {
+        VkSemaphoreWaitInfo wait_info{};
+        wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        wait_info.semaphoreCount = 1;
+        wait_info.pSemaphores = &m_upload_semaphore;
+        wait_info.pValues = &m_upload_values[frame_index];
+
+        check_vk(vkWaitSemaphores(m_context.get_device(), &wait_info, std::numeric_limits<uint64_t>::max()),
+                 "vkWaitSemaphores (starfield upload)");
+        m_upload_values[frame_index] = 0;
+    }
+
     const auto pointing = camera.get_pointing();
     const f64 fov_rad = camera.get_fov_rad();
     const f32 mag_limit = camera.get_magnitude_limit();
 
-    std::vector<StarVertex> vertices;
-    vertices.reserve(std::min(static_cast<u32>(stars.size()), m_buffer_capacity));
+    // One rotation per frame takes J2000 unit vectors straight to the camera
+    // frame; no per-star trig remains in the projection
+    const ProjectionContext projection(camera, celestial_to_horizontal);
 
-    for (const auto& star : stars)
+    // GPU path: the whole frame's input is one push constant
+    if (m_path == StarfieldPath::GpuCompute)
     {
-        // Skip stars fainter than the magnitude limit
-        if (star.mag_v > mag_limit)
-        {
-            continue;
-        }
+        m_cull_push_constants = StarCullPushConstants::from_projection(
+            projection, mag_limit, m_gpu_culler->count_within(mag_limit));
+        m_visible_counts[frame_index] = 0;
+        return;
+    }
+
+    // View cone: same radius horizontal_to_screen accepts (FOV × 0.75),
+    // centered on the pointing direction rotated back to J2000 RA/Dec
+    const auto center = astro::Coordinates::unit_vector_to_equatorial(
+        glm::transpose(celestial_to_horizontal) * astro::Coordinates::horizontal_to_unit_vector(pointing));
+    star_layers.query_disc(center.ra, center.dec, fov_rad * 0.75, m_view_pixels);
+
+    // Layers fainter than the limit are skipped entirely
+    const u32 layer_count = catalog::MagnitudeFilter::active_layer_count(mag_limit);
 
-        // RA/Dec → Alt/Az
-        const astro::EquatorialCoord eq{.ra = star.ra, .dec = star.dec};
-        const auto hz = astro::Coordinates::equatorial_to_horizontal(eq, observer, lst);
+    // 1. Work list: the bright prefix of every pixel bucket under the view,
+    //    in (layer, pixel) order, each with its own candidate slots. Sized
+    //    for the worst case, then candidates get whatever the arena has left
+    const auto batch_slots = arena.allocate_array<ProjectionBatch>(
+        static_cast<std::size_t>(layer_count) * m_view_pixels.size());
+    const std::size_t max_candidates = arena.get_remaining() / sizeof(StarVertex);
 
-        // Skip stars below the horizon
-        if (hz.alt < 0.0)
+    u32 batch_count = 0;
+    u32 candidate_count = 0;
+    bool truncated = false;
+
+    for (u32 layer = 0; layer < layer_count && !truncated; ++layer)
+    {
+        const auto& index = star_layers.get_layer(layer);
+        const auto mag = index.get_stars().get_mag_v();
+
+        for (const u32 pixel : m_view_pixels)
         {
-            continue;
+            // Pixel buckets are brightest first, so the stars within the
+            // limit form a prefix of the bucket
+            const auto bucket = index.pixel_range(pixel);
+            const auto bright_end = std::upper_bound(mag.begin() + bucket.begin,
+                                                     mag.begin() + bucket.end, mag_limit);
+            const auto n = static_cast<u32>(bright_end - mag.begin()) - bucket.begin;
+            if (n == 0)
+            {
+                continue;
+            }
+            if (batch_count == batch_slots.size() || candidate_count + n > max_candidates)
+            {
+                truncated = true;
+                break;
+            }
+
+            batch_slots[batch_count++] = ProjectionBatch{
+                .layer = layer,
+                .first_row = bucket.begin,
+                .count = n,
+                .candidate = candidate_count,
+                .visible = 0,
+                .output = 0,
+            };
+            candidate_count += n;
         }
+    }
+
+    if (truncated && !m_warned_arena_full)
+    {
+        PLX_CORE_WARN("Starfield: frame arena full, candidates truncated to {} stars", candidate_count);
+        m_warned_arena_full = true;
+    }
+
+    const auto batches = batch_slots.first(batch_count);
+    const auto candidates = arena.allocate_array<StarVertex>(candidate_count);
+
+    // 2. Transform: jobs write disjoint candidate ranges and their own
+    //    batches' visible counts
+    m_jobs.parallel_for(batch_count, kMinBatchesPerJob, [&](u32 begin, u32 end) {
+        project_batches(star_layers, projection, batches.subspan(begin, end - begin), candidates);
+    });
 
-        // Alt/Az → screen projection
-        const auto screen_pos = astro::Coordinates::horizontal_to_screen(hz, pointing, fov_rad);
-        if (!screen_pos.has_value())
+    // 3. Compact survivors in batch order (deterministic), up to capacity,
+    //    straight into the persistently mapped ring: one sequential 8-byte
+    //    write per visible star, quantized on the way
+    u32 count = 0;
+    for (auto& batch : batches)
+    {
+        batch.visible = std::min(batch.visible, m_buffer_capacity - count);
+        batch.output = count;
+        count += batch.visible;
+    }
+
+    PackedStarVertex* const mapped = reinterpret_cast<PackedStarVertex*>(
+        static_cast<std::byte*>(m_mapped_ptr) + frame_index * m_region_stride);
+    m_jobs.parallel_for(batch_count, kMinBatchesPerJob, [&](u32 begin, u32 end) {
+        for (const auto& batch : batches.subspan(begin, end - begin))
         {
-            continue;
+            const auto first = candidates.begin() + batch.candidate;
+            std::transform(first, first + batch.visible, mapped + batch.output, pack_star_vertex);
         }
+    });
 
-        // Magnitude → brightness (Pogson formula)
-        // brightness = 10^(-0.4 * (mag - mag_zero))
-        //
-        // Normalize so mag=0 → brightness=1.0 (Vega system).
-        // Brighter stars (negative mag) get values > 1.0,
-        // fainter stars get values < 1.0.
-        // We normalize in the shader via the brightness_scale push constant.
-        const f64 raw_brightness = std::pow(10.0, -0.4 * (static_cast<f64>(star.mag_v) - kMagZero));
-
-        // Normalize to [0, 1] range using a reference:
-        // Sirius at mag -1.46 gives ~3.84, we want that to map to ~1.0
-        // Use a simple normalization: brightness / max_expected_brightness
-        // max_expected is for mag = -1.5 → pow(10, 0.6) ≈ 3.98
-        constexpr f64 kMaxBrightness = 3.98;
-        const f64 brightness = std::min(raw_brightness / kMaxBrightness, 1.0);
-
-        vertices.push_back(StarVertex{
-            .screen_x   = screen_pos->x,
-            .screen_y   = screen_pos->y,
-            .brightness = static_cast<f32>(brightness),
-            .color_bv   = star.color_bv,
-        });
+    m_visible_counts[frame_index] = count;
 
-        // Don't exceed buffer capacity
-        if (vertices.size() >= m_buffer_capacity)
+    // 4. Discrete GPUs: move the region to VRAM on the transfer queue
+    if (m_staged_upload && count > 0)
+    {
+        submit_upload(frame_index, count);
+    }
+}
+
+void Starfield::submit_upload(u32 frame_index, u32 count)
+{
+    VkCommandBuffer cmd = m_transfer_commands[frame_index];
+    check_vk(vkResetCommandBuffer(cmd, 0), "vkResetCommandBuffer (starfield upload)");
+
+    VkCommandBufferBeginInfo begin_info{};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    check_vk(vkBeginCommandBuffer(cmd, &begin_info), "vkBeginCommandBuffer (starfield upload)");
+
+    // Only the visible stars, not the whole region
+    VkBufferCopy region{};
+    region.srcOffset = frame_index * m_region_stride;
+    region.dstOffset = frame_index * m_region_stride;
+    region.size = sizeof(PackedStarVertex) * count;
+    vkCmdCopyBuffer(cmd, m_staging.buffer, m_storage.buffer, 1, &region);
+
+    check_vk(vkEndCommandBuffer(cmd), "vkEndCommandBuffer (starfield upload)");
+
+    // The signal makes the copy available; the graphics submit waits on the
+    // value at its vertex stage. Both queues share the buffers concurrently,
+    // so no ownership transfer is needed
+    const u64 signal_value = ++m_upload_counter;
+
+    VkTimelineSemaphoreSubmitInfo timeline_info{};
+    timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timeline_info.signalSemaphoreValueCount = 1;
+    timeline_info.pSignalSemaphoreValues = &signal_value;
+
+    VkSubmitInfo submit_info{};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.pNext = &timeline_info;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &cmd;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &m_upload_semaphore;
+
+    check_vk(vkQueueSubmit(m_context.get_transfer_queue(), 1, &submit_info, VK_NULL_HANDLE),
+             "vkQueueSubmit (starfield upload)");
+
+    m_upload_values[frame_index] = signal_value;
+}
+
+void Starfield::project_batches(const catalog::MagnitudeFilter& star_layers,
+                                const ProjectionContext& projection,
+                                std::span<ProjectionBatch> batches,
+                                std::span<StarVertex> candidates)
+{
+    for (auto& batch : batches)
+    {
+        // Only the columns the transform needs are streamed
+        const auto& stars = star_layers.get_layer(batch.layer).get_stars();
+        const auto mag = stars.get_mag_v().subspan(batch.first_row, batch.count);
+        const auto color_bv = stars.get_color_bv().subspan(batch.first_row, batch.count);
+        const auto slots = candidates.subspan(batch.candidate, batch.count);
+
+        for (u32 i = 0; i < batch.count; ++i)
         {
-            break;
+            slots[i].brightness = magnitude_to_brightness(mag[i]);
+            slots[i].color_bv = color_bv[i];
         }
+
+        // Horizon + view-cone cull and screen projection; survivors are
+        // compacted to the front of the slots
+        batch.visible = projection.project(stars.get_direction_x().subspan(batch.first_row, batch.count),
+                                           stars.get_direction_y().subspan(batch.first_row, batch.count),
+                                           stars.get_direction_z().subspan(batch.first_row, batch.count),
+                                           slots);
     }
+}
+
+// -----------------------------------------------------------------
+// Magnitude → brightness (Pogson formula)
+// brightness = 10^(-0.4 * (mag - mag_zero))
+//
+// Normalize so mag=0 → brightness=1.0 (Vega system).
+// Brighter stars (negative mag) get values > 1.0,
+// fainter stars get values < 1.0.
+// We normalize in the shader via the brightness_scale push constant.
+// -----------------------------------------------------------------
 
-    m_visible_count = static_cast<u32>(vertices.size());
+f32 Starfield::magnitude_to_brightness(f32 mag)
+{
+    const f64 raw_brightness = std::pow(10.0, -0.4 * (static_cast<f64>(mag) - kMagZero));
+
+    // Normalize to [0, 1] range using a reference:
+    // Sirius at mag -1.46 gives ~3.84, we want that to map to ~1.0
+    // Use a simple normalization: brightness / max_expected_brightness
+    // max_expected is for mag = -1.5 → pow(10, 0.6) ≈ 3.98
+    constexpr f64 kMaxBrightness = 3.98;
+    return static_cast<f32>(std::min(raw_brightness / kMaxBrightness, 1.0));
+}
 
-    if (m_visible_count > 0)
+// -----------------------------------------------------------------
+// GPU compute path
+// -----------------------------------------------------------------
+
+void Starfield::upload_catalog(const catalog::MagnitudeFilter& star_layers,
+                               const std::filesystem::path& shader_dir)
+{
+    const auto catalog = GpuStarCatalog::from_layers(star_layers);
+    if (catalog.empty())
     {
-        upload_star_data(vertices);
+        PLX_CORE_WARN("Starfield: empty catalog, GPU compute path unavailable");
+        return;
+    }
+
+    m_gpu_culler = std::make_unique<GpuStarCuller>(m_context, shader_dir, catalog);
+
+    // Second set of the same layout: the culler's instance buffer, bound
+    // with dynamic offset 0, so the graphics pipeline is shared by both paths
+    VkDescriptorSetAllocateInfo alloc_info{};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorPool = m_descriptor_pool;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.pSetLayouts = &m_descriptor_set_layout;
+
+    check_vk(vkAllocateDescriptorSets(m_context.get_device(), &alloc_info, &m_gpu_descriptor_set),
+             "vkAllocateDescriptorSets (starfield GPU path)");
+
+    VkDescriptorBufferInfo buffer_desc{};
+    buffer_desc.buffer = m_gpu_culler->get_instance_buffer();
+    buffer_desc.offset = 0;
+    buffer_desc.range = m_gpu_culler->get_instance_buffer_size();
+
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = m_gpu_descriptor_set;
+    write.dstBinding = 0;
+    write.dstArrayElement = 0;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+    write.descriptorCount = 1;
+    write.pBufferInfo = &buffer_desc;
+
+    vkUpdateDescriptorSets(m_context.get_device(), 1, &write, 0, nullptr);
+}
+
+void Starfield::set_path(StarfieldPath path)
+{
+    if (path == StarfieldPath::GpuCompute && !m_gpu_culler)
+    {
+        PLX_CORE_WARN("Starfield: GPU compute path requested without a resident catalog, staying on CPU");
+        return;
+    }
+
+    m_path = path;
+    PLX_CORE_INFO("Starfield transform path: {}", path == StarfieldPath::GpuCompute ? "GPU compute" : "CPU");
+}
+
+StarfieldPath Starfield::get_path() const
+{
+    return m_path;
+}
+
+void Starfield::record_compute(VkCommandBuffer cmd) const
+{
+    if (m_path == StarfieldPath::GpuCompute)
+    {
+        m_gpu_culler->record(cmd, m_cull_push_constants);
     }
 }
 
@@ -183,35 +397,58 @@ void Starfield::update(std::span<const catalog::StarEntry> stars,
 // draw() — record draw commands
 // -----------------------------------------------------------------
 
-void Starfield::draw(VkCommandBuffer cmd) const
+void Starfield::draw(VkCommandBuffer cmd, u32 frame_index) const
 {
-    if (m_visible_count == 0)
+    const bool gpu_path = (m_path == StarfieldPath::GpuCompute);
+    const u32 visible_count = m_visible_counts[frame_index];
+    if (!gpu_path && visible_count == 0)
     {
         return;
     }
 
     vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline);
 
+    // The dynamic offset selects this frame's region of the ring; the GPU
+    // path has a single instance buffer at offset 0
+    const auto dynamic_offset = gpu_path ? 0u : static_cast<uint32_t>(frame_index * m_region_stride);
     vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS,
                             m_pipeline_layout, 0, 1,
-                            &m_descriptor_set, 0, nullptr);
+                            gpu_path ? &m_gpu_descriptor_set : &m_descriptor_set,
+                            1, &dynamic_offset);
 
     vkCmdPushConstants(cmd, m_pipeline_layout,
                        VK_SHADER_STAGE_VERTEX_BIT,
                        0, sizeof(StarfieldPushConstants),
                        &m_push_constants);
 
-    // Instanced draw: 1 vertex per instance, m_visible_count instances
-    vkCmdDraw(cmd, 1, m_visible_count, 0, 0);
+    if (gpu_path)
+    {
+        // Instance count was written by the compute shader
+        vkCmdDrawIndirect(cmd, m_gpu_culler->get_indirect_buffer(), 0, 1, sizeof(VkDrawIndirectCommand));
+        return;
+    }
+
+    // Instanced draw: 1 vertex per instance, visible_count instances
+    vkCmdDraw(cmd, 1, visible_count, 0, 0);
 }
 
 // -----------------------------------------------------------------
 // Accessors
 // -----------------------------------------------------------------
 
-u32 Starfield::get_visible_count() const
+VkSemaphore Starfield::get_upload_semaphore() const
+{
+    return m_upload_semaphore;
+}
+
+u64 Starfield::get_upload_value(u32 frame_index) const
 {
-    return m_visible_count;
+    return m_upload_values[frame_index];
+}
+
+u32 Starfield::get_visible_count(u32 frame_index) const
+{
+    return m_visible_counts[frame_index];
 }
 
 VkPipeline Starfield::get_pipeline() const
@@ -225,59 +462,128 @@ VkPipelineLayout Starfield::get_pipeline_layout() const
 }
 
 // -----------------------------------------------------------------
-// Storage buffer (host-visible, persistently mapped)
+// Storage ring (suballocated through the context's Allocator)
+//
+// One region of max_stars vertices per frame in flight. Region starts
+// must honour minStorageBufferOffsetAlignment to be usable as dynamic
+// offsets, so the stride is the region size rounded up to it.
+//
+// Staged: the shader reads a device-local ring, the CPU writes a
+// host-visible staging ring of the same layout. Otherwise the shader
+// reads the host-visible ring directly.
 // -----------------------------------------------------------------
 
-void Starfield::create_storage_buffer(u32 max_stars)
+void Starfield::create_storage_buffer(u32 max_stars, u32 frames_in_flight)
 {
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(m_context.get_physical_device(), &properties);
+    const VkDeviceSize offset_alignment = std::max<VkDeviceSize>(
+        properties.limits.minStorageBufferOffsetAlignment, 1);
+
     m_buffer_capacity = max_stars;
-    const VkDeviceSize buffer_size = sizeof(StarVertex) * max_stars;
+    m_region_stride = (sizeof(PackedStarVertex) * max_stars + offset_alignment - 1)
+                    / offset_alignment * offset_alignment;
+    m_visible_counts.assign(frames_in_flight, 0);
+    const VkDeviceSize buffer_size = m_region_stride * frames_in_flight;
+
+    auto& allocator = m_context.get_allocator();
+    if (m_staged_upload)
+    {
+        // Written by the transfer queue, read by the graphics queue
+        const uint32_t queue_families[] = {m_context.get_graphics_queue_family(),
+                                           m_context.get_transfer_queue_family()};
+        const bool shared = queue_families[0] != queue_families[1];
+
+        m_storage = allocator.create_buffer(vulkan::BufferDesc{
+            .size = buffer_size,
+            .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            .location = vulkan::MemoryLocation::DeviceLocal,
+            .category = vulkan::MemoryCategory::InstanceBuffers,
+            .queue_families = shared ? std::span<const uint32_t>(queue_families) : std::span<const uint32_t>{},
+        });
+        m_staging = allocator.create_buffer(vulkan::BufferDesc{
+            .size = buffer_size,
+            .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            .location = vulkan::MemoryLocation::HostUpload,
+            .category = vulkan::MemoryCategory::Staging,
+        });
+        m_mapped_ptr = m_staging.mapped;
+    }
+    else
+    {
+        m_storage = allocator.create_buffer(vulkan::BufferDesc{
+            .size = buffer_size,
+            .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            .location = vulkan::MemoryLocation::HostUpload,
+            .category = vulkan::MemoryCategory::InstanceBuffers,
+        });
+        m_mapped_ptr = m_storage.mapped;
+    }
 
-    VkBufferCreateInfo buffer_info{};
-    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    buffer_info.size = buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    PLX_CORE_TRACE("Starfield storage buffer created: {} bytes ({} regions of {} stars{})",
+                   buffer_size, frames_in_flight, max_stars, m_staged_upload ? ", staged" : "");
+}
+
+// -----------------------------------------------------------------
+// Upload resources: per-slot transfer command buffers + a timeline
+// semaphore counting completed copies (staged mode only)
+// -----------------------------------------------------------------
+
+void Starfield::create_upload_resources(u32 frames_in_flight)
+{
+    m_upload_values.assign(frames_in_flight, 0);
+    if (!m_staged_upload)
+    {
+        return;
+    }
 
     VkDevice device = m_context.get_device();
 
-    check_vk(vkCreateBuffer(device, &buffer_info, nullptr, &m_storage_buffer),
-             "vkCreateBuffer (starfield storage)");
+    VkCommandPoolCreateInfo pool_info{};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex = m_context.get_transfer_queue_family();
 
-    VkMemoryRequirements mem_requirements;
-    vkGetBufferMemoryRequirements(device, m_storage_buffer, &mem_requirements);
+    check_vk(vkCreateCommandPool(device, &pool_info, nullptr, &m_transfer_pool),
+             "vkCreateCommandPool (starfield upload)");
 
-    VkMemoryAllocateInfo alloc_info{};
-    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    alloc_info.allocationSize = mem_requirements.size;
-    alloc_info.memoryTypeIndex = find_memory_type(
-        m_context.get_physical_device(),
-        mem_requirements.memoryTypeBits,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    m_transfer_commands.resize(frames_in_flight);
 
-    check_vk(vkAllocateMemory(device, &alloc_info, nullptr, &m_storage_memory),
-             "vkAllocateMemory (starfield storage)");
+    VkCommandBufferAllocateInfo alloc_info{};
+    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.commandPool = m_transfer_pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = frames_in_flight;
 
-    check_vk(vkBindBufferMemory(device, m_storage_buffer, m_storage_memory, 0),
-             "vkBindBufferMemory (starfield storage)");
+    check_vk(vkAllocateCommandBuffers(device, &alloc_info, m_transfer_commands.data()),
+             "vkAllocateCommandBuffers (starfield upload)");
 
-    // Persistently map the buffer
-    check_vk(vkMapMemory(device, m_storage_memory, 0, buffer_size, 0, &m_mapped_ptr),
-             "vkMapMemory (starfield storage)");
+    VkSemaphoreTypeCreateInfo type_info{};
+    type_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    type_info.initialValue = 0;
 
-    PLX_CORE_TRACE("Starfield storage buffer created: {} bytes ({} stars)",
-                   buffer_size, max_stars);
+    VkSemaphoreCreateInfo semaphore_info{};
+    semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphore_info.pNext = &type_info;
+
+    check_vk(vkCreateSemaphore(device, &semaphore_info, nullptr, &m_upload_semaphore),
+             "vkCreateSemaphore (starfield upload)");
+
+    PLX_CORE_TRACE("Starfield uploads on the {} queue",
+                   m_context.has_dedicated_transfer_queue() ? "dedicated transfer" : "graphics");
 }
 
 // -----------------------------------------------------------------
-// Descriptor set layout: single storage buffer at binding 0
+// Descriptor set layout: single dynamic storage buffer at binding 0
+// (one region of the ring, chosen by the offset given at bind time)
 // -----------------------------------------------------------------
 
 void Starfield::create_descriptor_set_layout()
 {
     VkDescriptorSetLayoutBinding binding{};
     binding.binding = 0;
-    binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
     binding.descriptorCount = 1;
     binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
 
@@ -300,16 +606,16 @@ void Starfield::create_descriptor_pool_and_set()
 {
     VkDevice device = m_context.get_device();
 
-    // Pool
+    // Pool: room for the ring's set and the GPU path's set
     VkDescriptorPoolSize pool_size{};
-    pool_size.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    pool_size.descriptorCount = 1;
+    pool_size.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+    pool_size.descriptorCount = 2;
 
     VkDescriptorPoolCreateInfo pool_info{};
     pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     pool_info.poolSizeCount = 1;
     pool_info.pPoolSizes = &pool_size;
-    pool_info.maxSets = 1;
+    pool_info.maxSets = 2;
 
     check_vk(vkCreateDescriptorPool(device, &pool_info, nullptr, &m_descriptor_pool),
              "vkCreateDescriptorPool (starfield)");
@@ -324,18 +630,19 @@ void Starfield::create_descriptor_pool_and_set()
     check_vk(vkAllocateDescriptorSets(device, &alloc_info, &m_descriptor_set),
              "vkAllocateDescriptorSets (starfield)");
 
-    // Write the storage buffer into the descriptor set
+    // Write the storage buffer into the descriptor set: the range covers
+    // one region, the dynamic offset at bind time picks which
     VkDescriptorBufferInfo buffer_desc{};
-    buffer_desc.buffer = m_storage_buffer;
+    buffer_desc.buffer = m_storage.buffer;
     buffer_desc.offset = 0;
-    buffer_desc.range = VK_WHOLE_SIZE;
+    buffer_desc.range = sizeof(PackedStarVertex) * m_buffer_capacity;
 
     VkWriteDescriptorSet write{};
     write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
     write.dstSet = m_descriptor_set;
     write.dstBinding = 0;
     write.dstArrayElement = 0;
-    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
     write.descriptorCount = 1;
     write.pBufferInfo = &buffer_desc;
 
@@ -352,8 +659,8 @@ void Starfield::create_pipeline(VkRenderPass render_pass,
     VkDevice device = m_context.get_device();
 
     // Shader modules
-    VkShaderModule vert_module = create_shader_module(shader_dir / "starfield.vert.spv");
-    VkShaderModule frag_module = create_shader_module(shader_dir / "starfield.frag.spv");
+    VkShaderModule vert_module = vulkan::create_shader_module(device, shader_dir / "starfield.vert.spv");
+    VkShaderModule frag_module = vulkan::create_shader_module(device, shader_dir / "starfield.frag.spv");
 
     VkPipelineShaderStageCreateInfo vert_stage{};
     vert_stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -469,64 +776,13 @@ void Starfield::create_pipeline(VkRenderPass render_pass,
     pipeline_info.renderPass = render_pass;
     pipeline_info.subpass = 0;
 
-    check_vk(
-        vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &m_pipeline),
-        "vkCreateGraphicsPipelines (starfield)");
+    m_pipeline = m_context.get_pipeline_cache().create_graphics_pipeline(pipeline_info, "starfield");
 
-    PLX_CORE_INFO("Starfield pipeline created (POINT_LIST, additive blend, storage buffer)");
+    PLX_CORE_INFO("Starfield pipeline created (POINT_LIST, additive blend, dynamic storage buffer)");
 
     // Clean up shader modules
     vkDestroyShaderModule(device, frag_module, nullptr);
     vkDestroyShaderModule(device, vert_module, nullptr);
 }
 
-// -----------------------------------------------------------------
-// Shader module loader
-// -----------------------------------------------------------------
-
-VkShaderModule Starfield::create_shader_module(const std::filesystem::path& path) const
-{
-    std::ifstream file(path, std::ios::ate | std::ios::binary);
-    if (!file.is_open())
-    {
-        PLX_CORE_CRITICAL("Failed to open shader file: {}", path.string());
-        std::abort();
-    }
-
-    auto file_size = static_cast<std::size_t>(file.tellg());
-    if (file_size == 0 || file_size % 4 != 0)
-    {
-        PLX_CORE_CRITICAL("Invalid SPIR-V file (size {} not aligned to 4): {}",
-                          file_size, path.string());
-        std::abort();
-    }
-
-    std::vector<uint32_t> code(file_size / sizeof(uint32_t));
-    file.seekg(0);
-    file.read(reinterpret_cast<char*>(code.data()), static_cast<std::streamsize>(file_size));
-    file.close();
-
-    VkShaderModuleCreateInfo create_info{};
-    create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    create_info.codeSize = file_size;
-    create_info.pCode = code.data();
-
-    VkShaderModule module = VK_NULL_HANDLE;
-    check_vk(vkCreateShaderModule(m_context.get_device(), &create_info, nullptr, &module),
-             "vkCreateShaderModule (starfield)");
-
-    PLX_CORE_TRACE("Shader module loaded: {}", path.filename().string());
-    return module;
-}
-
-// -----------------------------------------------------------------
-// Upload star data to persistently mapped buffer
-// -----------------------------------------------------------------
-
-void Starfield::upload_star_data(const std::vector<StarVertex>& vertices)
-{
-    const std::size_t byte_size = vertices.size() * sizeof(StarVertex);
-    std::memcpy(m_mapped_ptr, vertices.data(), byte_size);
-}
-
 } // namespace parallax::rendering
\ No newline at end of file
@@ -4,30 +4,29 @@
 /// @brief Starfield renderer: CPU-side star processing + GPU storage buffer + instanced draw.
 
 #include "astro/coordinates.hpp"
+#include "catalog/magnitude_filter.hpp"
 #include "catalog/star_entry.hpp"
+#include "core/frame_arena.hpp"
+#include "core/job_system.hpp"
 #include "core/types.hpp"
 #include "rendering/camera.hpp"
+#include "rendering/gpu_star_catalog.hpp"
+#include "rendering/gpu_star_culler.hpp"
+#include "rendering/projection_context.hpp"
+#include "rendering/star_vertex.hpp"
+#include "vulkan/allocator.hpp"
 #include "vulkan/context.hpp"
 
 #include <vulkan/vulkan.h>
 
 #include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <span>
 #include <vector>
 
 namespace parallax::rendering
 {
-    /// @brief Per-instance star data uploaded to GPU each frame.
-    /// Matches the vec4 layout in the starfield vertex shader.
-    struct StarVertex
-    {
-        f32 screen_x;      ///< Normalized device coords [-1, 1]
-        f32 screen_y;      ///< Normalized device coords [-1, 1]
-        f32 brightness;    ///< Linear brightness (Pogson formula)
-        f32 color_bv;      ///< B-V color index (converted to RGB in shader)
-    };
-
     /// @brief Push constants for starfield rendering parameters.
     struct StarfieldPushConstants
     {
@@ -35,23 +34,56 @@ namespace parallax::rendering
         f32 brightness_scale;   ///< Scaling factor for brightness
     };
 
+    /// @brief Where the per-frame star transform and cull run.
+    enum class StarfieldPath
+    {
+        Cpu,            ///< HEALPix query + ProjectionContext on the job system, mapped upload
+        GpuCompute,     ///< starfield_cull.comp over the resident catalog, indirect draw
+    };
+
     /// @brief Manages starfield rendering: CPU-side transform pipeline + GPU resources.
     ///
     /// Each frame:
-    /// 1. CPU: Transform catalog stars (RA/Dec → Alt/Az → screen), compute brightness
-    /// 2. CPU: Upload StarVertex array to GPU storage buffer
+    /// 1. CPU: Query the HEALPix pixels under the view cone, transform their stars
+    ///    (unit vector → horizontal frame → screen), compute brightness
+    /// 2. CPU: Quantize the visible stars to PackedStarVertex (8 bytes) straight
+    ///    into the mapped GPU storage buffer, in the region owned by this
+    ///    frame in flight
     /// 3. GPU: Instanced point draw with additive blending
+    ///
+    /// The storage buffer is a ring with one region per frame in flight,
+    /// bound through a dynamic storage-buffer descriptor whose offset selects
+    /// the region. update() for frame slot N only touches region N, which the
+    /// caller guarantees the GPU is done with (its fence was waited on), so
+    /// the CPU never overwrites vertices a previous frame is still drawing.
+    ///
+    /// On discrete GPUs the ring is device-local and the CPU writes a
+    /// host-visible staging ring of the same shape instead; update() then
+    /// copies the frame's region on the transfer queue and signals a timeline
+    /// semaphore that the graphics submit waits on (get_upload_semaphore()),
+    /// so the vertex shader reads VRAM instead of pulling across the bus.
+    /// Unified-memory devices, and devices without timeline semaphores,
+    /// keep the host-visible ring and draw from it directly.
+    ///
+    /// After upload_catalog(), StarfieldPath::GpuCompute moves steps 1–2 to a
+    /// compute shader (see GpuStarCuller): update() only packs a push
+    /// constant, record_compute() culls into a device-local instance buffer
+    /// and draw() issues vkCmdDrawIndirect with the GPU-side count.
     class Starfield
     {
     public:
         /// @brief Create GPU resources: storage buffer, descriptor set, pipeline.
         /// @param context The Vulkan context (device, physical device).
+        /// @param jobs Job system that runs the per-frame transform.
         /// @param render_pass The render pass this pipeline will be used with.
         /// @param shader_dir Directory containing compiled SPIR-V files.
-        /// @param max_stars Maximum number of stars to reserve buffer space for.
+        /// @param frames_in_flight Ring regions (frames the CPU may run ahead).
+        /// @param max_stars Maximum number of stars per frame.
         Starfield(const vulkan::Context& context,
+                  core::JobSystem& jobs,
                   VkRenderPass render_pass,
                   const std::filesystem::path& shader_dir,
+                  u32 frames_in_flight,
                   u32 max_stars = 200000);
 
         /// @brief Destroy all GPU resources.
@@ -64,26 +96,73 @@ namespace parallax::rendering
 
         /// @brief Process catalog stars and upload visible ones to GPU buffer.
         ///
-        /// Performs the full CPU-side transform pipeline:
-        /// RA/Dec → Alt/Az (skip if below horizon) → screen projection (skip if off-screen)
-        /// → magnitude→brightness (Pogson) → pack into StarVertex.
+        /// Only magnitude layers that can hold stars brighter than the camera's
+        /// limit are read, and only their pixels overlapping the view cone;
+        /// within each pixel stars are brightest first, so the scan stops at
+        /// the first star past the limit. Layers store stars as SoA columns
+        /// and only RA, Dec, magnitude and color are read.
+        /// Each candidate then goes through the CPU-side transform pipeline:
+        /// magnitude→brightness (Pogson), then a batch ProjectionContext::project
+        /// of the J2000 unit vectors (skip if below horizon, outside the view
+        /// cone or off-screen) → pack into StarVertex.
         ///
-        /// @param stars The full star catalog.
-        /// @param observer Observer geographic location.
-        /// @param lst Local sidereal time in radians.
+        /// The per-pixel batches are transformed as parallel_for jobs, each
+        /// into its own region of a candidate buffer; survivors are then
+        /// packed and compacted in (layer, pixel, magnitude) order into the
+        /// mapped buffer, so the output does not depend on how jobs were scheduled.
+        ///
+        /// The work list and candidate buffer are frame-arena scratch; if the
+        /// arena cannot hold every candidate, the faintest batches are dropped.
+        ///
+        /// @param star_layers Star catalog split into magnitude layers.
+        /// @param celestial_to_horizontal J2000 (GCRS) → horizontal rotation for this
+        ///        frame, precession and nutation included (astro::Precession).
         /// @param camera The camera (pointing + FOV + magnitude limit).
-        void update(std::span<const catalog::StarEntry> stars,
-                    const astro::ObserverLocation& observer,
-                    f64 lst,
-                    const Camera& camera);
+        /// @param arena Scratch memory for this frame (already begun).
+        /// @param frame_index Frame-in-flight slot whose fence has been waited on.
+        void update(const catalog::MagnitudeFilter& star_layers,
+                    const Mat3d& celestial_to_horizontal,
+                    const Camera& camera,
+                    core::FrameArena& arena,
+                    u32 frame_index);
+
+        /// @brief Keep a copy of the whole catalog on the GPU for the compute path.
+        ///
+        /// One-time staging upload (blocks until it completes). Does nothing
+        /// for an empty catalog, which leaves the CPU path as the only one.
+        /// @param star_layers Star catalog split into magnitude layers.
+        /// @param shader_dir Directory containing compiled SPIR-V files.
+        void upload_catalog(const catalog::MagnitudeFilter& star_layers,
+                            const std::filesystem::path& shader_dir);
+
+        /// @brief Select the transform path for following frames.
+        /// GpuCompute falls back to Cpu until upload_catalog() has run.
+        void set_path(StarfieldPath path);
+
+        /// @brief Transform path in use.
+        [[nodiscard]] StarfieldPath get_path() const;
+
+        /// @brief Record the compute cull for this frame (GPU path only).
+        /// Must be called outside a render pass, before draw().
+        void record_compute(VkCommandBuffer cmd) const;
 
         /// @brief Record draw commands into a command buffer.
         /// Must be called inside an active render pass.
         /// @param cmd The command buffer to record into.
-        void draw(VkCommandBuffer cmd) const;
+        /// @param frame_index Slot passed to the matching update().
+        void draw(VkCommandBuffer cmd, u32 frame_index) const;
+
+        /// @brief Timeline semaphore signalled when a staged upload lands
+        /// (VK_NULL_HANDLE when drawing straight from host-visible memory).
+        [[nodiscard]] VkSemaphore get_upload_semaphore() const;
+
+        /// @brief Value of get_upload_semaphore() the graphics submit for a
+        /// slot must wait for before its vertex stage (0 = nothing pending).
+        [[nodiscard]] u64 get_upload_value(u32 frame_index) const;
 
-        /// @brief Number of visible stars after the last update().
-        [[nodiscard]] u32 get_visible_count() const;
+        /// @brief Number of visible stars written by the last update() of a slot.
+        /// The GPU path keeps its count on the device and reports 0 here.
+        [[nodiscard]] u32 get_visible_count(u32 frame_index) const;
 
         /// @brief Get the pipeline handle (for binding).
         [[nodiscard]] VkPipeline get_pipeline() const;
@@ -92,40 +171,78 @@ namespace parallax::rendering
         [[nodiscard]] VkPipelineLayout get_pipeline_layout() const;
 
     private:
-        void create_storage_buffer(u32 max_stars);
+        void create_storage_buffer(u32 max_stars, u32 frames_in_flight);
+        void create_upload_resources(u32 frames_in_flight);
+
+        /// @brief Copy a slot's staged vertices to the device-local ring.
+        void submit_upload(u32 frame_index, u32 count);
         void create_descriptor_set_layout();
         void create_descriptor_pool_and_set();
         void create_pipeline(VkRenderPass render_pass,
                              const std::filesystem::path& shader_dir);
 
-        /// @brief Load a SPIR-V file and create a VkShaderModule.
-        [[nodiscard]] VkShaderModule create_shader_module(
-            const std::filesystem::path& path) const;
-
-        /// @brief Upload star vertex data to the mapped storage buffer.
-        void upload_star_data(const std::vector<StarVertex>& vertices);
+        /// @brief Normalized linear brightness for a visual magnitude (Pogson).
+        [[nodiscard]] static f32 magnitude_to_brightness(f32 mag);
+
+        /// @brief Stars of one pixel bucket in one layer, and where they go.
+        struct ProjectionBatch
+        {
+            u32 layer;
+            u32 first_row;      ///< Row in the layer's StarCatalogSoA
+            u32 count;          ///< Bright prefix of the bucket
+            u32 candidate;      ///< First slot in m_candidates
+            u32 visible;        ///< Survivors after project() (written by the job)
+            u32 output;         ///< First slot in the mapped buffer (set during compaction)
+        };
+
+        /// @brief Transform batches into their candidate slots.
+        static void project_batches(const catalog::MagnitudeFilter& star_layers,
+                                    const ProjectionContext& projection,
+                                    std::span<ProjectionBatch> batches,
+                                    std::span<StarVertex> candidates);
 
         const vulkan::Context& m_context;
+        core::JobSystem& m_jobs;
 
         // GPU resources
-        VkBuffer m_storage_buffer = VK_NULL_HANDLE;
-        VkDeviceMemory m_storage_memory = VK_NULL_HANDLE;
-        void* m_mapped_ptr = nullptr;         ///< Persistently mapped buffer pointer
-        u32 m_buffer_capacity = 0;            ///< Max stars the buffer can hold
+        vulkan::Buffer m_storage;             ///< Ring read by the vertex shader
+        vulkan::Buffer m_staging;             ///< Host-side ring (staged upload only)
+        void* m_mapped_ptr = nullptr;         ///< Persistently mapped ring the CPU writes
+        u32 m_buffer_capacity = 0;            ///< Max stars per region
+        VkDeviceSize m_region_stride = 0;     ///< Bytes between regions (offset-alignment padded)
 
         VkDescriptorSetLayout m_descriptor_set_layout = VK_NULL_HANDLE;
         VkDescriptorPool m_descriptor_pool = VK_NULL_HANDLE;
         VkDescriptorSet m_descriptor_set = VK_NULL_HANDLE;
+        VkDescriptorSet m_gpu_descriptor_set = VK_NULL_HANDLE;  ///< GpuStarCuller's instance buffer
 
         VkPipelineLayout m_pipeline_layout = VK_NULL_HANDLE;
         VkPipeline m_pipeline = VK_NULL_HANDLE;
 
+        // Staged upload (discrete GPUs)
+        bool m_staged_upload = false;
+        VkCommandPool m_transfer_pool = VK_NULL_HANDLE;
+        std::vector<VkCommandBuffer> m_transfer_commands;  ///< One per frame in flight
+        VkSemaphore m_upload_semaphore = VK_NULL_HANDLE;   ///< Timeline
+        u64 m_upload_counter = 0;                           ///< Last value signalled
+        std::vector<u64> m_upload_values;                   ///< Per slot; 0 = no copy pending
+
+        // GPU compute path
+        std::unique_ptr<GpuStarCuller> m_gpu_culler;
+        StarfieldPath m_path = StarfieldPath::Cpu;
+        StarCullPushConstants m_cull_push_constants{};
+
         // Frame state
-        u32 m_visible_count = 0;
+        std::vector<u32> m_visible_counts;    ///< Per frame-in-flight region
+        std::vector<u32> m_view_pixels;       ///< HEALPix pixels under the view cone (reused)
+        bool m_warned_arena_full = false;     ///< Arena overflow is logged once
         StarfieldPushConstants m_push_constants = {6.0f, 1.5f};
 
         // Magnitude zero-point (Vega system: Vega ≈ mag 0)
         static constexpr f64 kMagZero = 0.0;
+
+        /// Pixel batches per job at minimum (a batch is ~10–100 stars)
+        static constexpr u32 kMinBatchesPerJob = 16;
     };
 
 } // namespace parallax::rendering
\ No newline at end of file
@@ -0,0 +1,258 @@
+/// @file allocator.cpp
+/// @brief GPU memory manager implementation (VMA allocator, category accounting, budgets).
+
+#include "vulkan/allocator.hpp"
+
+#include "core/logger.hpp"
+
+#include <cstdlib>
+
+namespace
+{
+
+void check_vk(VkResult result, const char* operation)
+{
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("Vulkan error in {}: VkResult = {}", operation, static_cast<int>(result));
+        std::abort();
+    }
+}
+
+constexpr parallax::u64 kMiB = 1024 * 1024;
+
+} // anonymous namespace
+
+namespace parallax::vulkan
+{
+
+// -----------------------------------------------------------------
+// Construction / Destruction
+// -----------------------------------------------------------------
+
+Allocator::Allocator(VkInstance instance,
+                     VkPhysicalDevice physical_device,
+                     VkDevice device,
+                     uint32_t api_version,
+                     bool memory_budget)
+    : m_physical_device{physical_device}
+    , m_memory_budget{memory_budget}
+{
+    VmaAllocatorCreateInfo create_info{};
+    create_info.instance = instance;
+    create_info.physicalDevice = physical_device;
+    create_info.device = device;
+    create_info.vulkanApiVersion = api_version;
+    if (memory_budget)
+    {
+        create_info.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
+
+    check_vk(vmaCreateAllocator(&create_info, &m_allocator), "vmaCreateAllocator");
+
+    PLX_CORE_INFO("GPU memory allocator created (budget: {})",
+                  memory_budget ? "VK_EXT_memory_budget" : "estimated from heap sizes");
+}
+
+Allocator::~Allocator()
+{
+    for (std::size_t i = 0; i < m_category_usage.size(); ++i)
+    {
+        if (m_category_usage[i].load() != 0)
+        {
+            PLX_CORE_WARN("GPU memory leak: {} bytes of {} still allocated",
+                          m_category_usage[i].load(),
+                          get_category_name(static_cast<MemoryCategory>(i)));
+        }
+    }
+
+    vmaDestroyAllocator(m_allocator);
+    PLX_CORE_TRACE("GPU memory allocator destroyed");
+}
+
+// -----------------------------------------------------------------
+// Buffers
+// -----------------------------------------------------------------
+
+Buffer Allocator::create_buffer(const BufferDesc& desc)
+{
+    VkBufferCreateInfo buffer_info{};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = desc.size;
+    buffer_info.usage = desc.usage;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (desc.queue_families.size() > 1)
+    {
+        buffer_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        buffer_info.queueFamilyIndexCount = static_cast<uint32_t>(desc.queue_families.size());
+        buffer_info.pQueueFamilyIndices = desc.queue_families.data();
+    }
+
+    VmaAllocationCreateInfo alloc_info{};
+    if (desc.location == MemoryLocation::HostUpload)
+    {
+        // Coherent so callers never flush; mapped once for the buffer's lifetime
+        alloc_info.usage = VMA_MEMORY_USAGE_AUTO;
+        alloc_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT
+                         | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    }
+    else if (desc.location == MemoryLocation::HostReadback)
+    {
+        // Cached memory makes CPU reads fast; coherent so no invalidate is needed
+        alloc_info.usage = VMA_MEMORY_USAGE_AUTO;
+        alloc_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT
+                         | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        alloc_info.preferredFlags = VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    }
+    else
+    {
+        alloc_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+    }
+
+    Buffer buffer{};
+    VmaAllocationInfo info{};
+    check_vk(vmaCreateBuffer(m_allocator, &buffer_info, &alloc_info, &buffer.buffer, &buffer.allocation, &info),
+             "vmaCreateBuffer");
+
+    buffer.mapped = info.pMappedData;
+    buffer.size = info.size;
+    buffer.category = desc.category;
+    charge(buffer.category, buffer.size);
+    return buffer;
+}
+
+void Allocator::destroy_buffer(Buffer& buffer)
+{
+    if (buffer.buffer == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    vmaDestroyBuffer(m_allocator, buffer.buffer, buffer.allocation);
+    release(buffer.category, buffer.size);
+    buffer = Buffer{};
+}
+
+// -----------------------------------------------------------------
+// Images
+// -----------------------------------------------------------------
+
+Image Allocator::create_image(const VkImageCreateInfo& image_info, MemoryCategory category)
+{
+    // Render targets are large and long-lived: let VMA give them their own
+    // VkDeviceMemory when the driver prefers it
+    VmaAllocationCreateInfo alloc_info{};
+    alloc_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+
+    Image image{};
+    VmaAllocationInfo info{};
+    check_vk(vmaCreateImage(m_allocator, &image_info, &alloc_info, &image.image, &image.allocation, &info),
+             "vmaCreateImage");
+
+    image.size = info.size;
+    image.category = category;
+    charge(image.category, image.size);
+    return image;
+}
+
+void Allocator::destroy_image(Image& image)
+{
+    if (image.image == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    vmaDestroyImage(m_allocator, image.image, image.allocation);
+    release(image.category, image.size);
+    image = Image{};
+}
+
+// -----------------------------------------------------------------
+// Usage + budget
+// -----------------------------------------------------------------
+
+void Allocator::begin_frame(u32 frame_index)
+{
+    vmaSetCurrentFrameIndex(m_allocator, frame_index);
+}
+
+u64 Allocator::get_category_usage(MemoryCategory category) const
+{
+    return m_category_usage[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+}
+
+MemoryBudget Allocator::get_device_local_budget() const
+{
+    VkPhysicalDeviceMemoryProperties mem_props{};
+    vkGetPhysicalDeviceMemoryProperties(m_physical_device, &mem_props);
+
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS]{};
+    vmaGetHeapBudgets(m_allocator, budgets);
+
+    MemoryBudget result{};
+    for (uint32_t i = 0; i < mem_props.memoryHeapCount; ++i)
+    {
+        if ((mem_props.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0)
+        {
+            result.usage += budgets[i].usage;
+            result.budget += budgets[i].budget;
+        }
+    }
+    return result;
+}
+
+bool Allocator::has_memory_budget() const
+{
+    return m_memory_budget;
+}
+
+VmaAllocator Allocator::get_handle() const
+{
+    return m_allocator;
+}
+
+void Allocator::log_usage() const
+{
+    const MemoryBudget budget = get_device_local_budget();
+    PLX_CORE_INFO("GPU memory: {} / {} MiB of device-local budget{}",
+                  budget.usage / kMiB, budget.budget / kMiB,
+                  m_memory_budget ? "" : " (estimated)");
+
+    for (std::size_t i = 0; i < m_category_usage.size(); ++i)
+    {
+        const auto category = static_cast<MemoryCategory>(i);
+        PLX_CORE_INFO("  {}: {} KiB", get_category_name(category), get_category_usage(category) / 1024);
+    }
+}
+
+const char* Allocator::get_category_name(MemoryCategory category)
+{
+    switch (category)
+    {
+    case MemoryCategory::CatalogTiles:
+        return "catalog tiles";
+    case MemoryCategory::InstanceBuffers:
+        return "instance buffers";
+    case MemoryCategory::RenderTargets:
+        return "render targets";
+    case MemoryCategory::Staging:
+        return "staging";
+    case MemoryCategory::Count:
+        break;
+    }
+    return "unknown";
+}
+
+void Allocator::charge(MemoryCategory category, VkDeviceSize size)
+{
+    m_category_usage[static_cast<std::size_t>(category)].fetch_add(size, std::memory_order_relaxed);
+}
+
+void Allocator::release(MemoryCategory category, VkDeviceSize size)
+{
+    m_category_usage[static_cast<std::size_t>(category)].fetch_sub(size, std::memory_order_relaxed);
+}
+
+} // namespace parallax::vulkan
@@ -0,0 +1,150 @@
+#pragma once
+
+/// @file allocator.hpp
+/// @brief GPU memory manager: VMA suballocation, per-category usage, heap budgets.
+
+#include "core/types.hpp"
+
+#include <vulkan/vulkan.h>
+#include <vk_mem_alloc.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <span>
+
+namespace parallax::vulkan
+{
+    /// @brief What a GPU allocation is for, so memory pressure can be
+    /// attributed (and the streaming system can evict the right thing).
+    enum class MemoryCategory : u8
+    {
+        CatalogTiles,       ///< Resident star catalog data
+        InstanceBuffers,    ///< Per-frame visible-star instances and draw commands
+        RenderTargets,      ///< Offscreen color / depth images
+        Staging,            ///< Host-side upload buffers
+        Count
+    };
+
+    /// @brief Where an allocation lives.
+    enum class MemoryLocation : u8
+    {
+        DeviceLocal,        ///< VRAM; written by copies or shaders only
+        HostUpload,         ///< Host-visible, coherent, persistently mapped; CPU writes sequentially
+        HostReadback,       ///< Host-visible, coherent, persistently mapped; CPU reads (cached if possible)
+    };
+
+    /// @brief Parameters for Allocator::create_buffer().
+    struct BufferDesc
+    {
+        VkDeviceSize size = 0;
+        VkBufferUsageFlags usage = 0;
+        MemoryLocation location = MemoryLocation::DeviceLocal;
+        MemoryCategory category = MemoryCategory::Staging;
+        /// Queue families sharing the buffer concurrently (empty or one = exclusive)
+        std::span<const uint32_t> queue_families = {};
+    };
+
+    /// @brief A buffer and its suballocation.
+    struct Buffer
+    {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        void* mapped = nullptr;             ///< Persistent mapping (host-visible locations only)
+        VkDeviceSize size = 0;              ///< Bytes charged to the category
+        MemoryCategory category = MemoryCategory::Staging;
+    };
+
+    /// @brief An image and its suballocation.
+    struct Image
+    {
+        VkImage image = VK_NULL_HANDLE;
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        VkDeviceSize size = 0;              ///< Bytes charged to the category
+        MemoryCategory category = MemoryCategory::RenderTargets;
+    };
+
+    /// @brief Usage against the budget of the device-local heaps (summed).
+    struct MemoryBudget
+    {
+        u64 usage = 0;      ///< Bytes in use by this process
+        u64 budget = 0;     ///< Bytes the process can use before the OS starts evicting
+    };
+
+    /// @brief Owns the VmaAllocator; the single path to device memory.
+    ///
+    /// Buffers and images are suballocated from VMA's block pools, so a
+    /// resource no longer costs one vkAllocateMemory (and one slot of
+    /// maxMemoryAllocationCount). Every allocation is charged to a
+    /// MemoryCategory; get_category_usage() reports the totals.
+    ///
+    /// With VK_EXT_memory_budget enabled the heap budget comes from the
+    /// driver and reflects other processes; without it VMA estimates 80% of
+    /// the heap size. Budgets refresh when begin_frame() advances the frame.
+    ///
+    /// Created and owned by vulkan::Context.
+    class Allocator
+    {
+    public:
+        /// @brief Create the VmaAllocator for a device.
+        /// @param memory_budget True if VK_EXT_memory_budget is enabled on the device.
+        Allocator(VkInstance instance,
+                  VkPhysicalDevice physical_device,
+                  VkDevice device,
+                  uint32_t api_version,
+                  bool memory_budget);
+
+        /// @brief Destroy the VmaAllocator; every resource must be freed first.
+        ~Allocator();
+
+        Allocator(const Allocator&) = delete;
+        Allocator& operator=(const Allocator&) = delete;
+        Allocator(Allocator&&) = delete;
+        Allocator& operator=(Allocator&&) = delete;
+
+        /// @brief Create a buffer with memory bound (and mapped unless DeviceLocal).
+        [[nodiscard]] Buffer create_buffer(const BufferDesc& desc);
+
+        /// @brief Destroy a buffer and release its memory (no-op on an empty Buffer).
+        void destroy_buffer(Buffer& buffer);
+
+        /// @brief Create a device-local image with memory bound.
+        [[nodiscard]] Image create_image(const VkImageCreateInfo& image_info, MemoryCategory category);
+
+        /// @brief Destroy an image and release its memory (no-op on an empty Image).
+        void destroy_image(Image& image);
+
+        /// @brief Advance VMA's frame index (refreshes the cached budget).
+        void begin_frame(u32 frame_index);
+
+        /// @brief Bytes currently allocated for a category.
+        [[nodiscard]] u64 get_category_usage(MemoryCategory category) const;
+
+        /// @brief Usage and budget of the device-local heaps.
+        [[nodiscard]] MemoryBudget get_device_local_budget() const;
+
+        /// @brief True if the budget comes from VK_EXT_memory_budget.
+        [[nodiscard]] bool has_memory_budget() const;
+
+        /// @brief The underlying VmaAllocator.
+        [[nodiscard]] VmaAllocator get_handle() const;
+
+        /// @brief Log per-category usage and the device-local budget.
+        void log_usage() const;
+
+        /// @brief Human-readable category name.
+        [[nodiscard]] static const char* get_category_name(MemoryCategory category);
+
+    private:
+        void charge(MemoryCategory category, VkDeviceSize size);
+        void release(MemoryCategory category, VkDeviceSize size);
+
+        VmaAllocator m_allocator = VK_NULL_HANDLE;
+        VkPhysicalDevice m_physical_device = VK_NULL_HANDLE;
+        bool m_memory_budget = false;
+
+        /// Bytes per category (streaming may allocate off the main thread)
+        std::array<std::atomic<u64>, static_cast<std::size_t>(MemoryCategory::Count)> m_category_usage{};
+    };
+
+} // namespace parallax::vulkan
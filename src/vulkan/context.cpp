@@ -3,6 +3,7 @@
 
 #include "vulkan/context.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <optional>
 #include <set>
@@ -143,6 +144,7 @@ struct QueueFamilyIndices
 {
     std::optional<uint32_t> graphics;
     std::optional<uint32_t> present;
+    std::optional<uint32_t> transfer;   ///< Transfer-capable family without graphics, if any
 
     [[nodiscard]] bool is_complete() const
     {
@@ -167,8 +169,16 @@ QueueFamilyIndices find_queue_families(VkPhysicalDevice device, VkSurfaceKHR sur
             indices.graphics = i;
         }
 
+        // Headless: nothing to present, the graphics family stands in
         VkBool32 present_support = VK_FALSE;
-        vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &present_support);
+        if (surface == VK_NULL_HANDLE)
+        {
+            present_support = indices.graphics.has_value() ? VK_TRUE : VK_FALSE;
+        }
+        else
+        {
+            vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &present_support);
+        }
         if (present_support == VK_TRUE)
         {
             indices.present = i;
@@ -180,6 +190,22 @@ QueueFamilyIndices find_queue_families(VkPhysicalDevice device, VkSurfaceKHR sur
         }
     }
 
+    // Transfer: prefer a transfer-only family (dedicated DMA engine), then
+    // any non-graphics family that can transfer (async compute)
+    constexpr VkQueueFlags kEngineFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+    for (const VkQueueFlags excluded : {kEngineFlags, VkQueueFlags{VK_QUEUE_GRAPHICS_BIT}})
+    {
+        for (uint32_t i = 0; i < count && !indices.transfer; ++i)
+        {
+            const VkQueueFlags flags = families[i].queueFlags;
+            if ((flags & excluded) == 0
+                && (flags & (VK_QUEUE_TRANSFER_BIT | VK_QUEUE_COMPUTE_BIT)) != 0)
+            {
+                indices.transfer = i;
+            }
+        }
+    }
+
     return indices;
 }
 
@@ -214,6 +240,22 @@ bool check_device_extension_support(VkPhysicalDevice device)
     return true;
 }
 
+// -----------------------------------------------------------------
+// Check a single optional device extension
+// -----------------------------------------------------------------
+bool has_device_extension(VkPhysicalDevice device, std::string_view name)
+{
+    uint32_t count = 0;
+    vkEnumerateDeviceExtensionProperties(device, nullptr, &count, nullptr);
+
+    std::vector<VkExtensionProperties> available(count);
+    vkEnumerateDeviceExtensionProperties(device, nullptr, &count, available.data());
+
+    return std::any_of(available.begin(), available.end(), [name](const VkExtensionProperties& ext) {
+        return std::string_view{ext.extensionName} == name;
+    });
+}
+
 } // anonymous namespace
 
 // =================================================================
@@ -243,15 +285,47 @@ Context::Context(const ContextConfig& config, core::Window& window)
         std::abort();
     }
 
+    create_device_objects(config);
+}
+
+Context::Context(const ContextConfig& config)
+{
+    // Headless: no window extensions, no surface, no swapchain
+    create_instance(config, {});
+
+    if (m_validation_enabled)
+    {
+        setup_debug_messenger();
+    }
+
+    PLX_CORE_INFO("Vulkan context is headless (no surface, offscreen rendering only)");
+    create_device_objects(config);
+}
+
+void Context::create_device_objects(const ContextConfig& config)
+{
     // 4. Pick physical device (needs instance + surface for queue families)
     pick_physical_device();
 
     // 5. Create logical device (needs physical device + queue families)
     create_logical_device();
+
+    // 6. Memory allocator (needs device)
+    m_allocator = std::make_unique<Allocator>(m_instance, m_physical_device, m_device,
+                                              m_api_version, m_memory_budget);
+
+    // 7. Pipeline cache (needs device; seeded from disk)
+    m_pipeline_cache = std::make_unique<PipelineCache>(m_physical_device, m_device, config.pipeline_cache_dir);
 }
 
 Context::~Context()
 {
+    // Saves the cache to disk; needs the device
+    m_pipeline_cache.reset();
+
+    // Everything allocated through it is gone by now
+    m_allocator.reset();
+
     if (m_device != VK_NULL_HANDLE)
     {
         vkDestroyDevice(m_device, nullptr);
@@ -413,6 +487,30 @@ void Context::pick_physical_device()
     auto indices = find_queue_families(m_physical_device, m_surface);
     m_graphics_family = indices.graphics.value();
     m_present_family = indices.present.value();
+    m_transfer_family = indices.transfer.value_or(m_graphics_family);
+
+    VkPhysicalDeviceProperties props{};
+    vkGetPhysicalDeviceProperties(m_physical_device, &props);
+    m_unified_memory = props.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU
+                    || props.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU;
+
+    // Timeline semaphores are core in 1.2 but still an optional feature
+    if (props.apiVersion >= VK_API_VERSION_1_2)
+    {
+        VkPhysicalDeviceVulkan12Features features12{};
+        features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_12_FEATURES;
+
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &features12;
+        vkGetPhysicalDeviceFeatures2(m_physical_device, &features2);
+
+        m_timeline_semaphores = (features12.timelineSemaphore == VK_TRUE);
+    }
+
+    // The instance asks for 1.3; VMA must not assume more than both support
+    m_api_version = std::min<uint32_t>(props.apiVersion, VK_API_VERSION_1_3);
+    m_memory_budget = has_device_extension(m_physical_device, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
 
     log_device_properties(m_physical_device);
 }
@@ -425,6 +523,12 @@ bool Context::is_device_suitable(VkPhysicalDevice device) const
         return false;
     }
 
+    // Headless: queues are all that is needed
+    if (m_surface == VK_NULL_HANDLE)
+    {
+        return true;
+    }
+
     if (!check_device_extension_support(device))
     {
         return false;
@@ -497,6 +601,12 @@ void Context::log_device_properties(VkPhysicalDevice device) const
     PLX_CORE_INFO("  VRAM: {} MB", vram_bytes / (1024 * 1024));
     PLX_CORE_INFO("  Graphics queue family: {}", m_graphics_family);
     PLX_CORE_INFO("  Present queue family: {}", m_present_family);
+    PLX_CORE_INFO("  Transfer queue family: {} ({})", m_transfer_family,
+                  has_dedicated_transfer_queue() ? "dedicated" : "shared with graphics");
+    PLX_CORE_INFO("  Memory: {}, timeline semaphores: {}, memory budget: {}",
+                  m_unified_memory ? "unified" : "discrete",
+                  m_timeline_semaphores ? "yes" : "no",
+                  m_memory_budget ? "yes" : "no");
 }
 
 // -----------------------------------------------------------------
@@ -504,7 +614,7 @@ void Context::log_device_properties(VkPhysicalDevice device) const
 // -----------------------------------------------------------------
 void Context::create_logical_device()
 {
-    std::set<uint32_t> unique_families = {m_graphics_family, m_present_family};
+    std::set<uint32_t> unique_families = {m_graphics_family, m_present_family, m_transfer_family};
 
     constexpr float kQueuePriority = 1.0f;
     std::vector<VkDeviceQueueCreateInfo> queue_create_infos;
@@ -522,13 +632,32 @@ void Context::create_logical_device()
 
     VkPhysicalDeviceFeatures device_features{};
 
+    VkPhysicalDeviceVulkan12Features features12{};
+    features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_12_FEATURES;
+    features12.timelineSemaphore = m_timeline_semaphores ? VK_TRUE : VK_FALSE;
+
     VkDeviceCreateInfo create_info{};
     create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    if (m_timeline_semaphores)
+    {
+        create_info.pNext = &features12;
+    }
     create_info.queueCreateInfoCount = static_cast<uint32_t>(queue_create_infos.size());
     create_info.pQueueCreateInfos = queue_create_infos.data();
     create_info.pEnabledFeatures = &device_features;
-    create_info.enabledExtensionCount = static_cast<uint32_t>(std::size(kRequiredDeviceExtensions));
-    create_info.ppEnabledExtensionNames = kRequiredDeviceExtensions;
+
+    // Required extensions (swapchain, unless headless) + optional ones the device has
+    std::vector<const char*> extensions;
+    if (m_surface != VK_NULL_HANDLE)
+    {
+        extensions.assign(std::begin(kRequiredDeviceExtensions), std::end(kRequiredDeviceExtensions));
+    }
+    if (m_memory_budget)
+    {
+        extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+    create_info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    create_info.ppEnabledExtensionNames = extensions.data();
 
     // Deprecated but some older drivers still look at device-level layers
     std::vector<const char*> layers;
@@ -544,6 +673,7 @@ void Context::create_logical_device()
 
     vkGetDeviceQueue(m_device, m_graphics_family, 0, &m_graphics_queue);
     vkGetDeviceQueue(m_device, m_present_family, 0, &m_present_queue);
+    vkGetDeviceQueue(m_device, m_transfer_family, 0, &m_transfer_queue);
 
     PLX_CORE_INFO("Vulkan logical device created");
 }
@@ -587,6 +717,46 @@ uint32_t Context::get_present_queue_family() const
     return m_present_family;
 }
 
+VkQueue Context::get_transfer_queue() const
+{
+    return m_transfer_queue;
+}
+
+uint32_t Context::get_transfer_queue_family() const
+{
+    return m_transfer_family;
+}
+
+bool Context::has_dedicated_transfer_queue() const
+{
+    return m_transfer_family != m_graphics_family;
+}
+
+bool Context::supports_timeline_semaphores() const
+{
+    return m_timeline_semaphores;
+}
+
+bool Context::is_headless() const
+{
+    return m_surface == VK_NULL_HANDLE;
+}
+
+bool Context::has_unified_memory() const
+{
+    return m_unified_memory;
+}
+
+Allocator& Context::get_allocator() const
+{
+    return *m_allocator;
+}
+
+PipelineCache& Context::get_pipeline_cache() const
+{
+    return *m_pipeline_cache;
+}
+
 VkSurfaceKHR Context::get_surface() const
 {
     return m_surface;
@@ -5,10 +5,14 @@
 
 #include "core/logger.hpp"
 #include "core/window.hpp"
+#include "vulkan/allocator.hpp"
+#include "vulkan/pipeline_cache.hpp"
 
 #include <vulkan/vulkan.h>
 
 #include <cstdint>
+#include <filesystem>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -20,17 +24,28 @@ namespace parallax::vulkan
         std::string app_name = "Parallax";
         uint32_t app_version = VK_MAKE_API_VERSION(0, 0, 1, 0);
         bool enable_validation = true;
+        std::filesystem::path pipeline_cache_dir = "cache";   ///< Per-device pipeline cache files
     };
 
     /// @brief Owns the core Vulkan objects: instance, device, and queues.
     ///
     /// Creates a VkInstance with optional validation layers, obtains a surface
     /// from the Window, selects a physical device (preferring discrete GPUs),
-    /// and creates a logical device with graphics and present queue families.
+    /// and creates a logical device with graphics, present and transfer queues.
+    ///
+    /// The transfer queue comes from a transfer-only family (the DMA engine)
+    /// when the device has one, otherwise it is the graphics queue. Timeline
+    /// semaphores are enabled when supported, for cross-queue handoffs.
+    ///
+    /// All device memory goes through the Allocator it owns (VMA, with
+    /// VK_EXT_memory_budget enabled when the device has it), and every
+    /// pipeline through its PipelineCache, persisted in config.pipeline_cache_dir.
     ///
     /// The constructor takes a Window reference to query required extensions
     /// and create the VkSurfaceKHR after instance creation — resolving the
-    /// instance↔surface dependency naturally.
+    /// instance↔surface dependency naturally. The headless constructor skips
+    /// the surface and swapchain entirely (offscreen rendering, e.g. under
+    /// lavapipe with no display); the present queue is then the graphics queue.
     class Context
     {
     public:
@@ -39,6 +54,10 @@ namespace parallax::vulkan
         /// @param window The application window (used for extensions and surface creation).
         explicit Context(const ContextConfig& config, core::Window& window);
 
+        /// @brief Create a headless context: no surface, no swapchain extension.
+        /// @param config Context configuration.
+        explicit Context(const ContextConfig& config);
+
         /// @brief Destroy logical device, debug messenger, surface, and instance (reverse order).
         ~Context();
 
@@ -68,7 +87,32 @@ namespace parallax::vulkan
         /// @brief Index of the present queue family.
         [[nodiscard]] uint32_t get_present_queue_family() const;
 
-        /// @brief The window surface owned by this context.
+        /// @brief Queue for buffer uploads (may be the graphics queue).
+        [[nodiscard]] VkQueue get_transfer_queue() const;
+
+        /// @brief Index of the transfer queue family.
+        [[nodiscard]] uint32_t get_transfer_queue_family() const;
+
+        /// @brief True if uploads run on their own queue family (DMA engine).
+        [[nodiscard]] bool has_dedicated_transfer_queue() const;
+
+        /// @brief True if timelineSemaphore was enabled on the device.
+        [[nodiscard]] bool supports_timeline_semaphores() const;
+
+        /// @brief True if created without a surface (offscreen only).
+        [[nodiscard]] bool is_headless() const;
+
+        /// @brief True for integrated / CPU devices, where host-visible memory
+        /// is the device's own memory and staging copies gain nothing.
+        [[nodiscard]] bool has_unified_memory() const;
+
+        /// @brief The device memory allocator.
+        [[nodiscard]] Allocator& get_allocator() const;
+
+        /// @brief The pipeline cache all pipelines are created through.
+        [[nodiscard]] PipelineCache& get_pipeline_cache() const;
+
+        /// @brief The window surface owned by this context (VK_NULL_HANDLE if headless).
         [[nodiscard]] VkSurfaceKHR get_surface() const;
 
         /// @brief Block until all device operations are complete.
@@ -77,6 +121,7 @@ namespace parallax::vulkan
     private:
         void create_instance(const ContextConfig& config, const std::vector<const char*>& window_extensions);
         void setup_debug_messenger();
+        void create_device_objects(const ContextConfig& config);
         void pick_physical_device();
         void create_logical_device();
 
@@ -96,9 +141,17 @@ namespace parallax::vulkan
         VkDevice m_device = VK_NULL_HANDLE;
         VkQueue m_graphics_queue = VK_NULL_HANDLE;
         VkQueue m_present_queue = VK_NULL_HANDLE;
+        VkQueue m_transfer_queue = VK_NULL_HANDLE;
         uint32_t m_graphics_family = 0;
         uint32_t m_present_family = 0;
+        uint32_t m_transfer_family = 0;
         bool m_validation_enabled = false;
+        bool m_timeline_semaphores = false;
+        bool m_unified_memory = false;
+        bool m_memory_budget = false;
+        uint32_t m_api_version = VK_API_VERSION_1_0;
+        std::unique_ptr<Allocator> m_allocator;
+        std::unique_ptr<PipelineCache> m_pipeline_cache;
     };
 
 } // namespace parallax::vulkan
\ No newline at end of file
@@ -0,0 +1,247 @@
+/// @file gpu_profiler.cpp
+/// @brief GpuProfiler implementation: per-frame query pools, late readback, per-pass rolling stats.
+
+#include "vulkan/gpu_profiler.hpp"
+
+#include "core/logger.hpp"
+#include "vulkan/context.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+
+void check_vk(VkResult result, const char* operation)
+{
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("Vulkan error in {}: VkResult = {}", operation, static_cast<int>(result));
+        std::abort();
+    }
+}
+
+} // anonymous namespace
+
+namespace parallax::vulkan
+{
+
+// -----------------------------------------------------------------
+// Construction / Destruction
+// -----------------------------------------------------------------
+
+GpuProfiler::GpuProfiler(const Context& context, u32 frames_in_flight)
+    : m_device{context.get_device()}
+{
+    if constexpr (!PLX_ENABLE_GPU_PROFILER)
+    {
+        PLX_CORE_INFO("GPU profiler compiled out (PLX_ENABLE_GPU_PROFILER=OFF)");
+        return;
+    }
+
+    VkPhysicalDeviceProperties props{};
+    vkGetPhysicalDeviceProperties(context.get_physical_device(), &props);
+
+    uint32_t family_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(context.get_physical_device(), &family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> families(family_count);
+    vkGetPhysicalDeviceQueueFamilyProperties(context.get_physical_device(), &family_count, families.data());
+
+    const u32 valid_bits = families[context.get_graphics_queue_family()].timestampValidBits;
+    if (valid_bits == 0 || props.limits.timestampPeriod <= 0.0f)
+    {
+        PLX_CORE_WARN("GPU profiler disabled: graphics queue has no timestamp support");
+        return;
+    }
+
+    m_enabled = true;
+    m_ns_per_tick = static_cast<f64>(props.limits.timestampPeriod);
+    m_valid_mask = (valid_bits >= 64) ? ~u64{0} : ((u64{1} << valid_bits) - 1);
+
+    VkQueryPoolCreateInfo pool_info{};
+    pool_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    pool_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    pool_info.queryCount = kMaxScopesPerFrame * 2;
+
+    m_frames.resize(frames_in_flight);
+    for (auto& frame : m_frames)
+    {
+        check_vk(vkCreateQueryPool(m_device, &pool_info, nullptr, &frame.pool), "vkCreateQueryPool");
+    }
+
+    PLX_CORE_INFO("GPU profiler: {} query pools × {} timestamps ({:.2f} ns/tick, {} valid bits)",
+                  frames_in_flight, pool_info.queryCount, m_ns_per_tick, valid_bits);
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    for (auto& frame : m_frames)
+    {
+        vkDestroyQueryPool(m_device, frame.pool, nullptr);
+    }
+    PLX_CORE_TRACE("GPU profiler destroyed");
+}
+
+// -----------------------------------------------------------------
+// Recording
+// -----------------------------------------------------------------
+
+void GpuProfiler::begin_frame(VkCommandBuffer cmd, u32 frame_index)
+{
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    m_current = &m_frames[frame_index];
+    collect(*m_current);
+
+    vkCmdResetQueryPool(cmd, m_current->pool, 0, kMaxScopesPerFrame * 2);
+    m_current->scope_count = 0;
+}
+
+u32 GpuProfiler::begin_scope(VkCommandBuffer cmd, const char* name)
+{
+    if (!m_enabled || m_current == nullptr || m_current->scope_count == kMaxScopesPerFrame)
+    {
+        return kInvalidScope;
+    }
+
+    const u32 pass = find_or_add_pass(name);
+    if (pass == kInvalidScope)
+    {
+        return kInvalidScope;
+    }
+
+    const u32 scope = m_current->scope_count++;
+    m_current->scopes[scope] = ScopeRecord{.pass = pass, .closed = false};
+    vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_current->pool, scope * 2);
+    return scope;
+}
+
+void GpuProfiler::end_scope(VkCommandBuffer cmd, u32 scope)
+{
+    if (scope == kInvalidScope || m_current == nullptr)
+    {
+        return;
+    }
+
+    vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_current->pool, scope * 2 + 1);
+    m_current->scopes[scope].closed = true;
+}
+
+// -----------------------------------------------------------------
+// Readback: the slot's fence has signalled, so no wait is needed
+// -----------------------------------------------------------------
+
+void GpuProfiler::collect(FrameQueries& frame)
+{
+    if (frame.scope_count == 0)
+    {
+        return;
+    }
+
+    // Pairs of (timestamp, availability) per query
+    std::array<u64, kMaxScopesPerFrame * 2 * 2> results{};
+    const u32 query_count = frame.scope_count * 2;
+    const VkResult result = vkGetQueryPoolResults(
+        m_device, frame.pool, 0, query_count,
+        sizeof(u64) * 2 * query_count, results.data(), sizeof(u64) * 2,
+        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+    if (result != VK_SUCCESS && result != VK_NOT_READY)
+    {
+        PLX_CORE_WARN("vkGetQueryPoolResults failed: VkResult = {}", static_cast<int>(result));
+        return;
+    }
+
+    for (u32 i = 0; i < frame.scope_count; ++i)
+    {
+        const u64* begin = &results[i * 4];
+        const u64* end = &results[i * 4 + 2];
+        if (!frame.scopes[i].closed || begin[1] == 0 || end[1] == 0)
+        {
+            continue;
+        }
+
+        const u64 ticks = ((end[0] & m_valid_mask) - (begin[0] & m_valid_mask)) & m_valid_mask;
+        m_passes[frame.scopes[i].pass].ms.add(static_cast<f64>(ticks) * m_ns_per_tick * 1e-6);
+    }
+
+    frame.scope_count = 0;
+}
+
+void GpuProfiler::collect_pending()
+{
+    for (auto& frame : m_frames)
+    {
+        collect(frame);
+    }
+}
+
+u32 GpuProfiler::find_or_add_pass(const char* name)
+{
+    for (u32 i = 0; i < m_pass_count; ++i)
+    {
+        if (m_passes[i].name == name || std::strcmp(m_passes[i].name, name) == 0)
+        {
+            return i;
+        }
+    }
+
+    if (m_pass_count == kMaxPasses)
+    {
+        PLX_CORE_WARN("GPU profiler: more than {} passes, '{}' is not timed", kMaxPasses, name);
+        return kInvalidScope;
+    }
+
+    m_passes[m_pass_count].name = name;
+    return m_pass_count++;
+}
+
+// -----------------------------------------------------------------
+// Metrics
+// -----------------------------------------------------------------
+
+std::vector<GpuPassStats> GpuProfiler::get_pass_stats() const
+{
+    std::vector<GpuPassStats> stats;
+    stats.reserve(m_pass_count);
+    for (u32 i = 0; i < m_pass_count; ++i)
+    {
+        stats.push_back(GpuPassStats{.name = m_passes[i].name, .ms = m_passes[i].ms.summarize()});
+    }
+    return stats;
+}
+
+std::optional<core::RollingSummary> GpuProfiler::find_pass_stats(std::string_view name) const
+{
+    for (u32 i = 0; i < m_pass_count; ++i)
+    {
+        if (name == m_passes[i].name && m_passes[i].ms.get_count() > 0)
+        {
+            return m_passes[i].ms.summarize();
+        }
+    }
+    return std::nullopt;
+}
+
+void GpuProfiler::log_stats() const
+{
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    for (const auto& pass : get_pass_stats())
+    {
+        PLX_CORE_INFO("GPU {:<16} min {:.3f} ms, avg {:.3f} ms, p99 {:.3f} ms ({} frames)",
+                      pass.name, pass.ms.min, pass.ms.avg, pass.ms.p99, pass.ms.count);
+    }
+}
+
+bool GpuProfiler::is_enabled() const
+{
+    return m_enabled;
+}
+
+} // namespace parallax::vulkan
@@ -0,0 +1,177 @@
+#pragma once
+
+/// @file gpu_profiler.hpp
+/// @brief GPU pass timing with timestamp queries, read back without stalling.
+///
+/// Build with -DPLX_ENABLE_GPU_PROFILER=OFF to strip it: PLX_GPU_SCOPE
+/// expands to nothing and GpuProfiler creates no query pools.
+
+#include "core/rolling_stats.hpp"
+#include "core/types.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#ifndef PLX_ENABLE_GPU_PROFILER
+#define PLX_ENABLE_GPU_PROFILER 1
+#endif
+
+namespace parallax::vulkan
+{
+    class Context;
+
+    /// @brief Rolling GPU time of one named pass, in milliseconds.
+    struct GpuPassStats
+    {
+        const char* name = nullptr;
+        core::RollingSummary ms;
+    };
+
+    /// @brief Times command-buffer regions with vkCmdWriteTimestamp.
+    ///
+    /// One VkQueryPool per frame in flight. begin_frame() is recorded at the
+    /// start of a slot's command buffer, after the slot's fence has been
+    /// waited on: the slot's previous timestamps are complete by then, so
+    /// they are collected without VK_QUERY_RESULT_WAIT_BIT (results arrive
+    /// frames_in_flight frames late, and nothing ever stalls). The pool is
+    /// then reset for the new frame.
+    ///
+    /// Passes are identified by name (string literals); scopes may nest.
+    /// Each pass keeps a rolling window of kWindow samples. No allocation
+    /// happens per frame once every pass name has been seen.
+    ///
+    /// Devices whose graphics queue has no timestamp bits get a profiler
+    /// that records nothing (is_enabled() = false).
+    class GpuProfiler
+    {
+    public:
+        /// Samples kept per pass for min / avg / p99
+        static constexpr std::size_t kWindow = 256;
+
+        /// Timed scopes per frame (each uses two queries)
+        static constexpr u32 kMaxScopesPerFrame = 32;
+
+        /// Distinct pass names
+        static constexpr u32 kMaxPasses = 16;
+
+        /// Returned by begin_scope() when nothing was recorded
+        static constexpr u32 kInvalidScope = ~0u;
+
+        /// @brief Create one timestamp query pool per frame in flight.
+        GpuProfiler(const Context& context, u32 frames_in_flight);
+
+        /// @brief Destroy the query pools. The GPU must be idle.
+        ~GpuProfiler();
+
+        GpuProfiler(const GpuProfiler&) = delete;
+        GpuProfiler& operator=(const GpuProfiler&) = delete;
+        GpuProfiler(GpuProfiler&&) = delete;
+        GpuProfiler& operator=(GpuProfiler&&) = delete;
+
+        /// @brief Collect the slot's previous results and reset its pool.
+        /// Record first into the command buffer, outside any render pass.
+        void begin_frame(VkCommandBuffer cmd, u32 frame_index);
+
+        /// @brief Write the start timestamp of a pass.
+        /// @param name Pass name; must outlive the profiler (use a literal).
+        /// @return Scope id for end_scope() (kInvalidScope if out of queries).
+        [[nodiscard]] u32 begin_scope(VkCommandBuffer cmd, const char* name);
+
+        /// @brief Write the end timestamp of a scope from begin_scope().
+        void end_scope(VkCommandBuffer cmd, u32 scope);
+
+        /// @brief Collect every slot's outstanding results (GPU must be idle),
+        /// e.g. before the final log_stats().
+        void collect_pending();
+
+        /// @brief Rolling stats of every pass seen so far.
+        [[nodiscard]] std::vector<GpuPassStats> get_pass_stats() const;
+
+        /// @brief Rolling stats of one pass (nullopt if it never completed).
+        [[nodiscard]] std::optional<core::RollingSummary> find_pass_stats(std::string_view name) const;
+
+        /// @brief Log min / avg / p99 per pass.
+        void log_stats() const;
+
+        /// @brief False if timestamps are unsupported or the profiler is compiled out.
+        [[nodiscard]] bool is_enabled() const;
+
+    private:
+        struct ScopeRecord
+        {
+            u32 pass = 0;           ///< Index into m_passes
+            bool closed = false;
+        };
+
+        struct FrameQueries
+        {
+            VkQueryPool pool = VK_NULL_HANDLE;
+            std::array<ScopeRecord, kMaxScopesPerFrame> scopes{};
+            u32 scope_count = 0;
+        };
+
+        struct Pass
+        {
+            const char* name = nullptr;
+            core::RollingStats<kWindow> ms;
+        };
+
+        void collect(FrameQueries& frame);
+        [[nodiscard]] u32 find_or_add_pass(const char* name);
+
+        VkDevice m_device = VK_NULL_HANDLE;
+        bool m_enabled = false;
+        f64 m_ns_per_tick = 1.0;                ///< VkPhysicalDeviceLimits::timestampPeriod
+        u64 m_valid_mask = ~u64{0};             ///< timestampValidBits of the graphics queue
+
+        std::vector<FrameQueries> m_frames;
+        FrameQueries* m_current = nullptr;
+        std::array<Pass, kMaxPasses> m_passes{};
+        u32 m_pass_count = 0;
+    };
+
+    /// @brief RAII timed region: begin_scope() now, end_scope() at scope exit.
+    class GpuScope
+    {
+    public:
+        GpuScope(GpuProfiler& profiler, VkCommandBuffer cmd, const char* name)
+            : m_profiler{profiler}
+            , m_cmd{cmd}
+            , m_scope{profiler.begin_scope(cmd, name)}
+        {
+        }
+
+        ~GpuScope()
+        {
+            m_profiler.end_scope(m_cmd, m_scope);
+        }
+
+        GpuScope(const GpuScope&) = delete;
+        GpuScope& operator=(const GpuScope&) = delete;
+        GpuScope(GpuScope&&) = delete;
+        GpuScope& operator=(GpuScope&&) = delete;
+
+    private:
+        GpuProfiler& m_profiler;
+        VkCommandBuffer m_cmd;
+        u32 m_scope;
+    };
+
+} // namespace parallax::vulkan
+
+// -----------------------------------------------------------------
+// Scoped marker: PLX_GPU_SCOPE(profiler, cmd, "starfield_draw");
+// -----------------------------------------------------------------
+#define PLX_GPU_SCOPE_CONCAT_INNER(a, b) a##b
+#define PLX_GPU_SCOPE_CONCAT(a, b) PLX_GPU_SCOPE_CONCAT_INNER(a, b)
+
+#if PLX_ENABLE_GPU_PROFILER
+#define PLX_GPU_SCOPE(profiler, cmd, name) \
+    ::parallax::vulkan::GpuScope PLX_GPU_SCOPE_CONCAT(plx_gpu_scope_, __LINE__){profiler, cmd, name}
+#else
+#define PLX_GPU_SCOPE(profiler, cmd, name) static_cast<void>(0)
+#endif
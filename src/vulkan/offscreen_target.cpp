@@ -0,0 +1,152 @@
+/// @file offscreen_target.cpp
+/// @brief OffscreenTarget implementation: color image, framebuffer, readback copy.
+
+#include "vulkan/offscreen_target.hpp"
+
+#include "core/logger.hpp"
+#include "vulkan/context.hpp"
+
+#include <cstdlib>
+
+namespace
+{
+
+void check_vk(VkResult result, const char* operation)
+{
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("Vulkan error in {}: VkResult = {}", operation, static_cast<int>(result));
+        std::abort();
+    }
+}
+
+constexpr VkDeviceSize kBytesPerPixel = 4;
+
+} // anonymous namespace
+
+namespace parallax::vulkan
+{
+
+// -----------------------------------------------------------------
+// Construction / Destruction
+// -----------------------------------------------------------------
+
+OffscreenTarget::OffscreenTarget(const Context& context, VkRenderPass render_pass, VkExtent2D extent)
+    : m_context{context}
+    , m_extent{extent}
+{
+    VkDevice device = m_context.get_device();
+    Allocator& allocator = m_context.get_allocator();
+
+    VkImageCreateInfo image_info{};
+    image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = kColorFormat;
+    image_info.extent = {m_extent.width, m_extent.height, 1};
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    m_image = allocator.create_image(image_info, MemoryCategory::RenderTargets);
+
+    VkImageViewCreateInfo view_info{};
+    view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    view_info.image = m_image.image;
+    view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    view_info.format = kColorFormat;
+    view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    view_info.subresourceRange.levelCount = 1;
+    view_info.subresourceRange.layerCount = 1;
+    check_vk(vkCreateImageView(device, &view_info, nullptr, &m_image_view), "vkCreateImageView (offscreen)");
+
+    VkFramebufferCreateInfo framebuffer_info{};
+    framebuffer_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebuffer_info.renderPass = render_pass;
+    framebuffer_info.attachmentCount = 1;
+    framebuffer_info.pAttachments = &m_image_view;
+    framebuffer_info.width = m_extent.width;
+    framebuffer_info.height = m_extent.height;
+    framebuffer_info.layers = 1;
+    check_vk(vkCreateFramebuffer(device, &framebuffer_info, nullptr, &m_framebuffer),
+             "vkCreateFramebuffer (offscreen)");
+
+    m_readback = allocator.create_buffer({
+        .size = VkDeviceSize{m_extent.width} * m_extent.height * kBytesPerPixel,
+        .usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        .location = MemoryLocation::HostReadback,
+        .category = MemoryCategory::RenderTargets,
+    });
+
+    PLX_CORE_INFO("Offscreen target created: {}x{} ({} KiB readback)",
+                  m_extent.width, m_extent.height, m_readback.size / 1024);
+}
+
+OffscreenTarget::~OffscreenTarget()
+{
+    VkDevice device = m_context.get_device();
+    Allocator& allocator = m_context.get_allocator();
+
+    allocator.destroy_buffer(m_readback);
+    vkDestroyFramebuffer(device, m_framebuffer, nullptr);
+    vkDestroyImageView(device, m_image_view, nullptr);
+    allocator.destroy_image(m_image);
+
+    PLX_CORE_TRACE("Offscreen target destroyed");
+}
+
+// -----------------------------------------------------------------
+// Readback: image (TRANSFER_SRC, left there by the render pass) → buffer
+// -----------------------------------------------------------------
+
+void OffscreenTarget::record_readback(VkCommandBuffer cmd) const
+{
+    VkBufferImageCopy region{};
+    region.bufferOffset = 0;
+    region.bufferRowLength = 0;     // tightly packed
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.layerCount = 1;
+    region.imageExtent = {m_extent.width, m_extent.height, 1};
+
+    vkCmdCopyImageToBuffer(cmd, m_image.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           m_readback.buffer, 1, &region);
+
+    // Make the copy visible to host reads after the fence
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = m_readback.buffer;
+    barrier.offset = 0;
+    barrier.size = VK_WHOLE_SIZE;
+
+    vkCmdPipelineBarrier(cmd,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                         0, 0, nullptr, 1, &barrier, 0, nullptr);
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+VkFramebuffer OffscreenTarget::get_framebuffer() const
+{
+    return m_framebuffer;
+}
+
+VkExtent2D OffscreenTarget::get_extent() const
+{
+    return m_extent;
+}
+
+std::span<const u8> OffscreenTarget::get_pixels() const
+{
+    return {static_cast<const u8*>(m_readback.mapped), static_cast<std::size_t>(m_readback.size)};
+}
+
+} // namespace parallax::vulkan
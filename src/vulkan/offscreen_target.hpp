@@ -0,0 +1,66 @@
+#pragma once
+
+/// @file offscreen_target.hpp
+/// @brief Offscreen color target with a host-readable copy, for headless rendering.
+
+#include "core/types.hpp"
+#include "vulkan/allocator.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <span>
+
+namespace parallax::vulkan
+{
+    class Context;
+
+    /// @brief Color image + view + framebuffer that a render pass draws into
+    /// instead of a swapchain image, plus a readback buffer for its pixels.
+    ///
+    /// The render pass must end the attachment in TRANSFER_SRC_OPTIMAL (see
+    /// the offscreen Pipeline constructor); record_readback() then copies the
+    /// image into the persistently mapped buffer, tightly packed RGBA8.
+    class OffscreenTarget
+    {
+    public:
+        /// @brief Color format of the target (sRGB, like typical swapchains).
+        static constexpr VkFormat kColorFormat = VK_FORMAT_R8G8B8A8_SRGB;
+
+        /// @brief Create the image, view, framebuffer and readback buffer.
+        /// @param context The Vulkan context (device, allocator).
+        /// @param render_pass Render pass the framebuffer must be compatible with.
+        /// @param extent Target size in pixels.
+        OffscreenTarget(const Context& context, VkRenderPass render_pass, VkExtent2D extent);
+
+        /// @brief Destroy all resources. The GPU must be idle.
+        ~OffscreenTarget();
+
+        OffscreenTarget(const OffscreenTarget&) = delete;
+        OffscreenTarget& operator=(const OffscreenTarget&) = delete;
+        OffscreenTarget(OffscreenTarget&&) = delete;
+        OffscreenTarget& operator=(OffscreenTarget&&) = delete;
+
+        /// @brief Record the image → buffer copy, after the render pass ends.
+        /// The pixels are valid once the submission's fence has signalled.
+        void record_readback(VkCommandBuffer cmd) const;
+
+        /// @brief Framebuffer for vkCmdBeginRenderPass.
+        [[nodiscard]] VkFramebuffer get_framebuffer() const;
+
+        /// @brief Target size in pixels.
+        [[nodiscard]] VkExtent2D get_extent() const;
+
+        /// @brief Last read-back frame: width × height RGBA8 pixels, rows top to bottom.
+        [[nodiscard]] std::span<const u8> get_pixels() const;
+
+    private:
+        const Context& m_context;
+        VkExtent2D m_extent{};
+
+        Image m_image;
+        VkImageView m_image_view = VK_NULL_HANDLE;
+        VkFramebuffer m_framebuffer = VK_NULL_HANDLE;
+        Buffer m_readback;
+    };
+
+} // namespace parallax::vulkan
@@ -3,8 +3,9 @@
 
 #include "vulkan/pipeline.hpp"
 
+#include "vulkan/shader_module.hpp"
+
 #include <cstdlib>
-#include <fstream>
 
 namespace
 {
@@ -29,11 +30,20 @@ Pipeline::Pipeline(const Context& context,
     : m_context{context}
     , m_extent{swapchain.get_extent()}
 {
-    create_render_pass(swapchain.get_image_format());
+    create_render_pass(swapchain.get_image_format(), VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
     create_pipeline(shader_dir);
     create_framebuffers(swapchain);
 }
 
+Pipeline::Pipeline(const Context& context,
+                   VkFormat color_format,
+                   const std::filesystem::path& shader_dir)
+    : m_context{context}
+{
+    create_render_pass(color_format, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    create_pipeline(shader_dir);
+}
+
 Pipeline::~Pipeline()
 {
     VkDevice device = m_context.get_device();
@@ -68,7 +78,7 @@ void Pipeline::recreate_framebuffers(const Swapchain& swapchain)
 // -----------------------------------------------------------------
 // Render pass: single subpass, color attachment, clear to black
 // -----------------------------------------------------------------
-void Pipeline::create_render_pass(VkFormat color_format)
+void Pipeline::create_render_pass(VkFormat color_format, VkImageLayout final_layout)
 {
     VkAttachmentDescription color_attachment{};
     color_attachment.format = color_format;
@@ -78,7 +88,7 @@ void Pipeline::create_render_pass(VkFormat color_format)
     color_attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     color_attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     color_attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    color_attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    color_attachment.finalLayout = final_layout;
 
     VkAttachmentReference color_ref{};
     color_ref.attachment = 0;
@@ -98,14 +108,27 @@ void Pipeline::create_render_pass(VkFormat color_format)
     dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
     dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
 
+    // Offscreen: subpass 0 → external, so the copy that reads the image
+    // back waits for the color writes (and the final layout transition)
+    VkSubpassDependency readback_dependency{};
+    readback_dependency.srcSubpass = 0;
+    readback_dependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+    readback_dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    readback_dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    readback_dependency.dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    readback_dependency.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+    const VkSubpassDependency dependencies[] = {dependency, readback_dependency};
+    const bool offscreen = (final_layout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
     VkRenderPassCreateInfo create_info{};
     create_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
     create_info.attachmentCount = 1;
     create_info.pAttachments = &color_attachment;
     create_info.subpassCount = 1;
     create_info.pSubpasses = &subpass;
-    create_info.dependencyCount = 1;
-    create_info.pDependencies = &dependency;
+    create_info.dependencyCount = offscreen ? 2 : 1;
+    create_info.pDependencies = dependencies;
 
     check_vk(
         vkCreateRenderPass(m_context.get_device(), &create_info, nullptr, &m_render_pass),
@@ -124,8 +147,8 @@ void Pipeline::create_pipeline(const std::filesystem::path& shader_dir)
     // -----------------------------------------------------------------
     // Load shader modules
     // -----------------------------------------------------------------
-    VkShaderModule vert_module = create_shader_module(shader_dir / "test_star.vert.spv");
-    VkShaderModule frag_module = create_shader_module(shader_dir / "test_star.frag.spv");
+    VkShaderModule vert_module = create_shader_module(device, shader_dir / "test_star.vert.spv");
+    VkShaderModule frag_module = create_shader_module(device, shader_dir / "test_star.frag.spv");
 
     VkPipelineShaderStageCreateInfo vert_stage{};
     vert_stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -239,9 +262,7 @@ void Pipeline::create_pipeline(const std::filesystem::path& shader_dir)
     pipeline_info.renderPass = m_render_pass;
     pipeline_info.subpass = 0;
 
-    check_vk(
-        vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &m_pipeline),
-        "vkCreateGraphicsPipelines");
+    m_pipeline = m_context.get_pipeline_cache().create_graphics_pipeline(pipeline_info, "test star");
 
     PLX_CORE_INFO("Graphics pipeline created (POINT_LIST, dynamic viewport/scissor)");
 
@@ -295,45 +316,6 @@ void Pipeline::destroy_framebuffers()
     m_framebuffers.clear();
 }
 
-// -----------------------------------------------------------------
-// SPIR-V file loader → VkShaderModule
-// -----------------------------------------------------------------
-VkShaderModule Pipeline::create_shader_module(const std::filesystem::path& path) const
-{
-    // Read entire file as binary
-    std::ifstream file(path, std::ios::ate | std::ios::binary);
-    if (!file.is_open())
-    {
-        PLX_CORE_CRITICAL("Failed to open shader file: {}", path.string());
-        std::abort();
-    }
-
-    auto file_size = static_cast<std::size_t>(file.tellg());
-    if (file_size == 0 || file_size % 4 != 0)
-    {
-        PLX_CORE_CRITICAL("Invalid SPIR-V file (size {} not aligned to 4): {}", file_size, path.string());
-        std::abort();
-    }
-
-    std::vector<uint32_t> code(file_size / sizeof(uint32_t));
-    file.seekg(0);
-    file.read(reinterpret_cast<char*>(code.data()), static_cast<std::streamsize>(file_size));
-    file.close();
-
-    VkShaderModuleCreateInfo create_info{};
-    create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    create_info.codeSize = file_size;
-    create_info.pCode = code.data();
-
-    VkShaderModule module = VK_NULL_HANDLE;
-    check_vk(
-        vkCreateShaderModule(m_context.get_device(), &create_info, nullptr, &module),
-        "vkCreateShaderModule");
-
-    PLX_CORE_TRACE("Shader module loaded: {}", path.filename().string());
-    return module;
-}
-
 // -----------------------------------------------------------------
 // Accessors
 // -----------------------------------------------------------------
@@ -19,6 +19,10 @@ namespace parallax::vulkan
     ///
     /// Phase 1 test pipeline: renders a single white point at screen center.
     /// Topology is POINT_LIST, no depth buffer, no blending, dynamic viewport/scissor.
+    ///
+    /// The offscreen constructor builds the same render pass for a plain color
+    /// image that ends in TRANSFER_SRC_OPTIMAL (ready for readback) and creates
+    /// no framebuffers; the OffscreenTarget owns its own.
     class Pipeline
     {
     public:
@@ -30,6 +34,14 @@ namespace parallax::vulkan
                  const Swapchain& swapchain,
                  const std::filesystem::path& shader_dir);
 
+        /// @brief Create render pass and pipeline for offscreen rendering (no framebuffers).
+        /// @param context The Vulkan context (device).
+        /// @param color_format Format of the offscreen color target.
+        /// @param shader_dir Directory containing compiled .spv shader files.
+        Pipeline(const Context& context,
+                 VkFormat color_format,
+                 const std::filesystem::path& shader_dir);
+
         /// @brief Destroy framebuffers, pipeline, layout, render pass, and shader modules.
         ~Pipeline();
 
@@ -56,14 +68,11 @@ namespace parallax::vulkan
         [[nodiscard]] VkFramebuffer get_framebuffer(uint32_t image_index) const;
 
     private:
-        void create_render_pass(VkFormat color_format);
+        void create_render_pass(VkFormat color_format, VkImageLayout final_layout);
         void create_pipeline(const std::filesystem::path& shader_dir);
         void create_framebuffers(const Swapchain& swapchain);
         void destroy_framebuffers();
 
-        /// @brief Load a SPIR-V file and create a VkShaderModule.
-        [[nodiscard]] VkShaderModule create_shader_module(const std::filesystem::path& path) const;
-
         const Context& m_context;
 
         VkRenderPass m_render_pass = VK_NULL_HANDLE;
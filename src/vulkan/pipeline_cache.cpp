@@ -0,0 +1,179 @@
+/// @file pipeline_cache.cpp
+/// @brief PipelineCache implementation: seeded creation, timed pipeline builds, save on shutdown.
+
+#include "vulkan/pipeline_cache.hpp"
+
+#include "core/logger.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+void check_vk(VkResult result, const char* operation)
+{
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("Vulkan error in {}: VkResult = {}", operation, static_cast<int>(result));
+        std::abort();
+    }
+}
+
+parallax::u64 elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<parallax::u64>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+} // anonymous namespace
+
+namespace parallax::vulkan
+{
+
+// -----------------------------------------------------------------
+// Construction / Destruction
+// -----------------------------------------------------------------
+
+PipelineCache::PipelineCache(VkPhysicalDevice physical_device,
+                             VkDevice device,
+                             const std::filesystem::path& directory)
+    : m_device{device}
+{
+    VkPhysicalDeviceProperties props{};
+    vkGetPhysicalDeviceProperties(physical_device, &props);
+
+    PipelineCacheKey key{
+        .vendor_id = props.vendorID,
+        .device_id = props.deviceID,
+    };
+    std::memcpy(key.uuid.data(), props.pipelineCacheUUID, key.uuid.size());
+    m_path = pipeline_cache_path(directory, key);
+
+    const auto blob = load_pipeline_cache_file(m_path, key);
+    m_warm = blob.has_value();
+    if (m_warm)
+    {
+        m_cold_build_us = blob->cold_build_us;
+    }
+
+    VkPipelineCacheCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    if (m_warm)
+    {
+        create_info.initialDataSize = blob->data.size();
+        create_info.pInitialData = blob->data.data();
+    }
+
+    check_vk(vkCreatePipelineCache(m_device, &create_info, nullptr, &m_cache), "vkCreatePipelineCache");
+
+    PLX_CORE_INFO("Pipeline cache {}: {}", m_warm ? "loaded" : "empty (cold start)", m_path.string());
+}
+
+PipelineCache::~PipelineCache()
+{
+    save();
+    vkDestroyPipelineCache(m_device, m_cache, nullptr);
+    PLX_CORE_TRACE("Pipeline cache destroyed");
+}
+
+// -----------------------------------------------------------------
+// Pipeline creation
+// -----------------------------------------------------------------
+
+VkPipeline PipelineCache::create_graphics_pipeline(const VkGraphicsPipelineCreateInfo& info, const char* name)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    const VkResult result = vkCreateGraphicsPipelines(m_device, m_cache, 1, &info, nullptr, &pipeline);
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("vkCreateGraphicsPipelines ({}) failed: VkResult = {}", name, static_cast<int>(result));
+        std::abort();
+    }
+
+    m_build_us += elapsed_us(start);
+    ++m_pipeline_count;
+    return pipeline;
+}
+
+VkPipeline PipelineCache::create_compute_pipeline(const VkComputePipelineCreateInfo& info, const char* name)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    const VkResult result = vkCreateComputePipelines(m_device, m_cache, 1, &info, nullptr, &pipeline);
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("vkCreateComputePipelines ({}) failed: VkResult = {}", name, static_cast<int>(result));
+        std::abort();
+    }
+
+    m_build_us += elapsed_us(start);
+    ++m_pipeline_count;
+    return pipeline;
+}
+
+// -----------------------------------------------------------------
+// Accessors
+// -----------------------------------------------------------------
+
+VkPipelineCache PipelineCache::get_handle() const
+{
+    return m_cache;
+}
+
+bool PipelineCache::is_warm() const
+{
+    return m_warm;
+}
+
+void PipelineCache::log_startup() const
+{
+    const f64 build_ms = static_cast<f64>(m_build_us) / 1000.0;
+    if (!m_warm || m_cold_build_us == 0)
+    {
+        PLX_CORE_INFO("Pipelines: {} created in {:.1f} ms (cold, cache written on shutdown)",
+                      m_pipeline_count, build_ms);
+        return;
+    }
+
+    const f64 cold_ms = static_cast<f64>(m_cold_build_us) / 1000.0;
+    PLX_CORE_INFO("Pipelines: {} created in {:.1f} ms from cache (cold start took {:.1f} ms, saved {:.1f} ms)",
+                  m_pipeline_count, build_ms, cold_ms, cold_ms - build_ms);
+}
+
+// -----------------------------------------------------------------
+// Save: the driver's merged blob, plus the cold build time
+// -----------------------------------------------------------------
+
+void PipelineCache::save() const
+{
+    std::size_t size = 0;
+    check_vk(vkGetPipelineCacheData(m_device, m_cache, &size, nullptr), "vkGetPipelineCacheData (size)");
+
+    PipelineCacheBlob blob{
+        .data = std::vector<std::byte>(size),
+        // The first run without a file defines the baseline; later runs keep it
+        .cold_build_us = (m_warm && m_cold_build_us != 0) ? m_cold_build_us : m_build_us,
+    };
+
+    // VK_INCOMPLETE only if the cache grew between the two calls
+    const VkResult result = vkGetPipelineCacheData(m_device, m_cache, &size, blob.data.data());
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_WARN("Pipeline cache not saved: vkGetPipelineCacheData returned {}", static_cast<int>(result));
+        return;
+    }
+    blob.data.resize(size);
+
+    if (save_pipeline_cache_file(m_path, blob))
+    {
+        PLX_CORE_INFO("Pipeline cache saved: {} ({} KiB)", m_path.string(), (size + 1023) / 1024);
+    }
+}
+
+} // namespace parallax::vulkan
@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file pipeline_cache.hpp
+/// @brief VkPipelineCache persisted across runs, with creation-time accounting.
+
+#include "core/types.hpp"
+#include "vulkan/pipeline_cache_file.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <filesystem>
+
+namespace parallax::vulkan
+{
+    /// @brief Owns the device's VkPipelineCache and its file on disk.
+    ///
+    /// Construction seeds the cache from "<directory>/pipelines_<vendor>_<device>.bin"
+    /// when the file's header matches this device's vendor, device and
+    /// pipelineCacheUUID (a driver update changes the UUID and so discards it).
+    /// Every pipeline is created through create_graphics_pipeline() /
+    /// create_compute_pipeline(), which pass the cache and time the call.
+    /// Destruction writes the merged cache back atomically.
+    ///
+    /// The file also remembers how long pipeline creation took on the run
+    /// that started without a cache, so warm starts can report the time saved.
+    ///
+    /// Created and owned by vulkan::Context.
+    class PipelineCache
+    {
+    public:
+        /// @brief Create the cache, seeded from disk when a matching file exists.
+        PipelineCache(VkPhysicalDevice physical_device, VkDevice device, const std::filesystem::path& directory);
+
+        /// @brief Save the cache to disk and destroy it.
+        ~PipelineCache();
+
+        PipelineCache(const PipelineCache&) = delete;
+        PipelineCache& operator=(const PipelineCache&) = delete;
+        PipelineCache(PipelineCache&&) = delete;
+        PipelineCache& operator=(PipelineCache&&) = delete;
+
+        /// @brief vkCreateGraphicsPipelines through the cache (aborts on failure).
+        [[nodiscard]] VkPipeline create_graphics_pipeline(const VkGraphicsPipelineCreateInfo& info, const char* name);
+
+        /// @brief vkCreateComputePipelines through the cache (aborts on failure).
+        [[nodiscard]] VkPipeline create_compute_pipeline(const VkComputePipelineCreateInfo& info, const char* name);
+
+        /// @brief The VkPipelineCache handle.
+        [[nodiscard]] VkPipelineCache get_handle() const;
+
+        /// @brief True if the cache was seeded from a valid file.
+        [[nodiscard]] bool is_warm() const;
+
+        /// @brief Log pipeline count, creation time and the time saved vs a cold start.
+        void log_startup() const;
+
+        /// @brief Write the cache to disk now (also done on destruction).
+        void save() const;
+
+    private:
+        VkDevice m_device = VK_NULL_HANDLE;
+        VkPipelineCache m_cache = VK_NULL_HANDLE;
+        std::filesystem::path m_path;
+        bool m_warm = false;
+        u64 m_cold_build_us = 0;        ///< From the file (warm) or this run (cold)
+        u64 m_build_us = 0;             ///< Pipeline creation time this run
+        u32 m_pipeline_count = 0;
+    };
+
+} // namespace parallax::vulkan
@@ -0,0 +1,185 @@
+/// @file pipeline_cache_file.cpp
+/// @brief Pipeline cache file I/O and validation.
+
+#include "vulkan/pipeline_cache_file.hpp"
+
+#include "core/logger.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+namespace
+{
+
+// -----------------------------------------------------------------
+// File layout
+//
+//   [0, 4)   magic "PLXP"
+//   [4, 8)   format version (u32, little endian)
+//   [8, 16)  cold build time in microseconds (u64, little endian)
+//   [16, …)  vkGetPipelineCacheData blob
+// -----------------------------------------------------------------
+constexpr char kMagic[4] = {'P', 'L', 'X', 'P'};
+constexpr parallax::u32 kFormatVersion = 1;
+constexpr std::size_t kFileHeaderSize = 16;
+
+// VkPipelineCacheHeaderVersionOne, always least significant byte first
+constexpr std::size_t kVkHeaderSize = 32;
+constexpr parallax::u32 kVkHeaderVersionOne = 1;
+
+template <typename T>
+T read_le(std::span<const std::byte> bytes, std::size_t offset)
+{
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= static_cast<T>(std::to_integer<parallax::u8>(bytes[offset + i])) << (8 * i);
+    }
+    return value;
+}
+
+template <typename T>
+void write_le(std::byte* out, T value)
+{
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        out[i] = static_cast<std::byte>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+} // anonymous namespace
+
+namespace parallax::vulkan
+{
+
+std::filesystem::path pipeline_cache_path(const std::filesystem::path& directory, const PipelineCacheKey& key)
+{
+    char name[48];
+    std::snprintf(name, sizeof(name), "pipelines_%04x_%04x.bin", key.vendor_id, key.device_id);
+    return directory / name;
+}
+
+bool pipeline_cache_matches(std::span<const std::byte> data, const PipelineCacheKey& key)
+{
+    if (data.size() < kVkHeaderSize)
+    {
+        return false;
+    }
+
+    const auto header_size = read_le<u32>(data, 0);
+    const auto header_version = read_le<u32>(data, 4);
+    if (header_size < kVkHeaderSize || header_size > data.size() || header_version != kVkHeaderVersionOne)
+    {
+        return false;
+    }
+
+    if (read_le<u32>(data, 8) != key.vendor_id || read_le<u32>(data, 12) != key.device_id)
+    {
+        return false;
+    }
+
+    return std::memcmp(data.data() + 16, key.uuid.data(), key.uuid.size()) == 0;
+}
+
+std::optional<PipelineCacheBlob> load_pipeline_cache_file(const std::filesystem::path& path,
+                                                          const PipelineCacheKey& key)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        return std::nullopt;
+    }
+
+    const auto file_size = static_cast<std::size_t>(file.tellg());
+    if (file_size < kFileHeaderSize + kVkHeaderSize)
+    {
+        PLX_CORE_WARN("Pipeline cache {} is truncated ({} bytes), ignoring it", path.string(), file_size);
+        return std::nullopt;
+    }
+
+    std::vector<std::byte> bytes(file_size);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(file_size));
+    if (!file)
+    {
+        PLX_CORE_WARN("Pipeline cache {} could not be read, ignoring it", path.string());
+        return std::nullopt;
+    }
+
+    const std::span<const std::byte> all(bytes);
+    if (std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) != 0 || read_le<u32>(all, 4) != kFormatVersion)
+    {
+        PLX_CORE_WARN("Pipeline cache {} has an unknown format, ignoring it", path.string());
+        return std::nullopt;
+    }
+
+    const auto vk_data = all.subspan(kFileHeaderSize);
+    if (!pipeline_cache_matches(vk_data, key))
+    {
+        PLX_CORE_INFO("Pipeline cache {} was built for another device or driver, ignoring it", path.string());
+        return std::nullopt;
+    }
+
+    return PipelineCacheBlob{
+        .data = std::vector<std::byte>(vk_data.begin(), vk_data.end()),
+        .cold_build_us = read_le<u64>(all, 8),
+    };
+}
+
+bool save_pipeline_cache_file(const std::filesystem::path& path, const PipelineCacheBlob& blob)
+{
+    std::error_code ec;
+    if (path.has_parent_path())
+    {
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec)
+        {
+            PLX_CORE_ERROR("Pipeline cache: failed to create {}: {}", path.parent_path().string(), ec.message());
+            return false;
+        }
+    }
+
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            PLX_CORE_ERROR("Pipeline cache: failed to create {}", tmp_path.string());
+            return false;
+        }
+
+        std::byte header[kFileHeaderSize];
+        std::memcpy(header, kMagic, sizeof(kMagic));
+        write_le<u32>(header + 4, kFormatVersion);
+        write_le<u64>(header + 8, blob.cold_build_us);
+
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(blob.data.data()), static_cast<std::streamsize>(blob.data.size()));
+        out.close();
+
+        if (!out)
+        {
+            PLX_CORE_ERROR("Pipeline cache: failed to write {}", tmp_path.string());
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+
+    // rename() replaces the old file in one step (MoveFileEx with
+    // REPLACE_EXISTING on Windows)
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec)
+    {
+        PLX_CORE_ERROR("Pipeline cache: failed to replace {}: {}", path.string(), ec.message());
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace parallax::vulkan
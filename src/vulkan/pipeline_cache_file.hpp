@@ -0,0 +1,55 @@
+#pragma once
+
+/// @file pipeline_cache_file.hpp
+/// @brief On-disk pipeline cache: per-device file naming, header validation, atomic save.
+///
+/// Kept free of Vulkan types so the file handling can be tested without a device.
+
+#include "core/types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace parallax::vulkan
+{
+    /// @brief Identity a pipeline cache blob is only valid for.
+    struct PipelineCacheKey
+    {
+        u32 vendor_id = 0;
+        u32 device_id = 0;
+        std::array<u8, 16> uuid{};      ///< VkPhysicalDeviceProperties::pipelineCacheUUID
+    };
+
+    /// @brief Cache contents plus the bookkeeping Parallax keeps beside them.
+    struct PipelineCacheBlob
+    {
+        std::vector<std::byte> data;    ///< vkGetPipelineCacheData output, header included
+        u64 cold_build_us = 0;          ///< Pipeline creation time of the run that had no cache
+    };
+
+    /// @brief "<dir>/pipelines_<vendor>_<device>.bin" (ids in hex), so switching
+    /// GPUs never feeds one device another's cache.
+    [[nodiscard]] std::filesystem::path pipeline_cache_path(const std::filesystem::path& directory,
+                                                            const PipelineCacheKey& key);
+
+    /// @brief True if data starts with a VkPipelineCacheHeaderVersionOne for this
+    /// device (header size, version, vendor, device and UUID all match).
+    ///
+    /// Drivers are required to reject foreign data, but some crash on it instead,
+    /// so it is checked before the data ever reaches vkCreatePipelineCache.
+    [[nodiscard]] bool pipeline_cache_matches(std::span<const std::byte> data, const PipelineCacheKey& key);
+
+    /// @brief Read a cache file; nullopt if missing, malformed or for another device.
+    [[nodiscard]] std::optional<PipelineCacheBlob> load_pipeline_cache_file(const std::filesystem::path& path,
+                                                                            const PipelineCacheKey& key);
+
+    /// @brief Write a cache file through "<path>.tmp" + rename, so a crash
+    /// mid-write leaves the previous file intact. Creates the directory.
+    /// @return False (logged) on any I/O failure.
+    bool save_pipeline_cache_file(const std::filesystem::path& path, const PipelineCacheBlob& blob);
+
+} // namespace parallax::vulkan
@@ -0,0 +1,57 @@
+/// @file shader_module.cpp
+/// @brief SPIR-V loading and shader module creation.
+
+#include "vulkan/shader_module.hpp"
+
+#include "core/logger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+namespace parallax::vulkan
+{
+
+VkShaderModule create_shader_module(VkDevice device, const std::filesystem::path& path)
+{
+    // Read entire file as binary
+    std::ifstream file(path, std::ios::ate | std::ios::binary);
+    if (!file.is_open())
+    {
+        PLX_CORE_CRITICAL("Failed to open shader file: {}", path.string());
+        std::abort();
+    }
+
+    auto file_size = static_cast<std::size_t>(file.tellg());
+    if (file_size == 0 || file_size % 4 != 0)
+    {
+        PLX_CORE_CRITICAL("Invalid SPIR-V file (size {} not aligned to 4): {}", file_size, path.string());
+        std::abort();
+    }
+
+    std::vector<uint32_t> code(file_size / sizeof(uint32_t));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(code.data()), static_cast<std::streamsize>(file_size));
+    file.close();
+
+    VkShaderModuleCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    create_info.codeSize = file_size;
+    create_info.pCode = code.data();
+
+    VkShaderModule module = VK_NULL_HANDLE;
+    const VkResult result = vkCreateShaderModule(device, &create_info, nullptr, &module);
+    if (result != VK_SUCCESS)
+    {
+        PLX_CORE_CRITICAL("Vulkan error in vkCreateShaderModule ({}): VkResult = {}",
+                          path.filename().string(), static_cast<int>(result));
+        std::abort();
+    }
+
+    PLX_CORE_TRACE("Shader module loaded: {}", path.filename().string());
+    return module;
+}
+
+} // namespace parallax::vulkan
@@ -0,0 +1,19 @@
+#pragma once
+
+/// @file shader_module.hpp
+/// @brief SPIR-V file → VkShaderModule, shared by every pipeline.
+
+#include <vulkan/vulkan.h>
+
+#include <filesystem>
+
+namespace parallax::vulkan
+{
+    /// @brief Load a compiled SPIR-V file and create a shader module from it.
+    ///
+    /// Aborts if the file is missing, empty or not a whole number of 32-bit
+    /// words, or if module creation fails. The caller destroys the module once
+    /// the pipelines using it are built.
+    [[nodiscard]] VkShaderModule create_shader_module(VkDevice device, const std::filesystem::path& path);
+
+} // namespace parallax::vulkan
@@ -0,0 +1,28 @@
+/// @file vma_implementation.cpp
+/// @brief The single translation unit that compiles VulkanMemoryAllocator.
+///
+/// VMA is header-only; its implementation is not warning-clean under the
+/// project's -Wall -Wextra -Wpedantic -Werror, so warnings are silenced
+/// here and nowhere else.
+
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#pragma GCC diagnostic ignored "-Wpedantic"
+#pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+#pragma GCC diagnostic ignored "-Wparentheses"
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#elif defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#define VMA_IMPLEMENTATION
+#include <vk_mem_alloc.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#pragma warning(pop)
+#endif
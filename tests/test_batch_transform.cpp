@@ -0,0 +1,262 @@
+/// @file test_batch_transform.cpp
+/// @brief Unit tests for parallax::astro::BatchTransform.
+///
+/// Measures the worst-case error of every supported path against an extended
+/// precision reference over a dense sky grid and a set of edge cases, and
+/// checks it against the documented bounds.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "astro/batch_transform.hpp"
+#include "astro/coordinates.hpp"
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::astro;
+
+// =================================================================
+// Helpers
+// =================================================================
+
+/// Restores the detected path when a test case forces another one
+class PathGuard
+{
+public:
+    PathGuard() : m_saved(BatchTransform::get_path()) {}
+    ~PathGuard() { BatchTransform::set_path(m_saved); }
+
+    PathGuard(const PathGuard&) = delete;
+    PathGuard& operator=(const PathGuard&) = delete;
+
+private:
+    SimdPath m_saved;
+};
+
+static std::vector<SimdPath> supported_paths()
+{
+    std::vector<SimdPath> paths;
+    for (const SimdPath path : {SimdPath::Scalar, SimdPath::Avx2})
+    {
+        if (BatchTransform::is_supported(path))
+        {
+            paths.push_back(path);
+        }
+    }
+    return paths;
+}
+
+/// Sky sample: a regular RA/Dec grid plus poles, RA wrap and zenith points
+struct SkySample
+{
+    std::vector<f64> ra;
+    std::vector<f64> dec;
+};
+
+static SkySample make_sky(f64 lat, f64 lst)
+{
+    SkySample sky;
+    for (f64 dec_deg = -90.0; dec_deg <= 90.0; dec_deg += 2.5)
+    {
+        for (f64 ra_deg = 0.0; ra_deg < 360.0; ra_deg += 3.7)
+        {
+            sky.ra.push_back(ra_deg * astro_constants::kDegToRad);
+            sky.dec.push_back(dec_deg * astro_constants::kDegToRad);
+        }
+    }
+
+    // Catalog RA is in [0, 2π); the LST is not (see kLsts)
+    const f64 transit_ra = std::fmod(std::fmod(lst, astro_constants::kTwoPi) + astro_constants::kTwoPi,
+                                     astro_constants::kTwoPi);
+    const f64 edge_ra[] = {0.0, 1e-9, astro_constants::kTwoPi - 1e-9, transit_ra, transit_ra + 1e-7};
+    const f64 edge_dec[] = {-astro_constants::kHalfPi, astro_constants::kHalfPi, 0.0, lat, lat - 1e-7};
+    for (const f64 ra : edge_ra)
+    {
+        for (const f64 dec : edge_dec)
+        {
+            sky.ra.push_back(ra);
+            sky.dec.push_back(dec);
+        }
+    }
+    return sky;
+}
+
+/// Extended-precision reference. Altitude via atan2 rather than asin, so the
+/// reference itself stays accurate at the zenith.
+static HorizontalCoord reference_horizontal(f64 ra, f64 dec, const ObserverLocation& observer, f64 lst)
+{
+    using ld = long double;
+    const ld hour_angle = static_cast<ld>(lst) - static_cast<ld>(ra);
+    const ld sin_lat = std::sin(static_cast<ld>(observer.latitude_rad));
+    const ld cos_lat = std::cos(static_cast<ld>(observer.latitude_rad));
+    const ld sin_dec = std::sin(static_cast<ld>(dec));
+    const ld cos_dec = std::cos(static_cast<ld>(dec));
+
+    const ld up = sin_dec * sin_lat + cos_dec * cos_lat * std::cos(hour_angle);
+    const ld north = sin_dec * cos_lat - cos_dec * sin_lat * std::cos(hour_angle);
+    const ld east = -cos_dec * std::sin(hour_angle);
+
+    ld az = std::atan2(east, north);
+    if (az < 0.0L)
+    {
+        az += 2.0L * static_cast<ld>(astro_constants::kPi);
+    }
+    return HorizontalCoord{
+        .alt = static_cast<f64>(std::atan2(up, std::hypot(north, east))),
+        .az  = static_cast<f64>(az),
+    };
+}
+
+/// Angular error (radians): |Δalt| and |Δaz|·cos(alt), whichever is larger
+static f64 angular_error(f64 alt, f64 az, const HorizontalCoord& expected)
+{
+    f64 az_diff = std::abs(az - expected.az);
+    if (az_diff > astro_constants::kPi)
+    {
+        az_diff = astro_constants::kTwoPi - az_diff;
+    }
+    return std::max(std::abs(alt - expected.alt), az_diff * std::cos(expected.alt));
+}
+
+template <typename T>
+static f64 max_error_arcsec(SimdPath path, const ObserverLocation& observer, f64 lst)
+{
+    const SkySample sky = make_sky(observer.latitude_rad, lst);
+    const std::size_t n = sky.ra.size();
+
+    std::vector<T> ra(n), dec(n), alt(n), az(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ra[i] = static_cast<T>(sky.ra[i]);
+        dec[i] = static_cast<T>(sky.dec[i]);
+    }
+
+    const PathGuard guard;
+    REQUIRE(BatchTransform::set_path(path));
+    BatchTransform::equatorial_to_horizontal(std::span<const T>(ra), std::span<const T>(dec),
+                                             observer, lst, std::span<T>(alt), std::span<T>(az));
+
+    f64 worst = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        // Reference from the inputs as the kernel saw them
+        const auto expected = reference_horizontal(static_cast<f64>(ra[i]), static_cast<f64>(dec[i]),
+                                                   observer, lst);
+        worst = std::max(worst, angular_error(alt[i], az[i], expected));
+    }
+    return worst / astro_constants::kArcSecToRad;
+}
+
+static const ObserverLocation kObservers[] = {
+    {.latitude_rad = 28.76 * astro_constants::kDegToRad, .longitude_rad = 0.0},
+    {.latitude_rad = -33.86 * astro_constants::kDegToRad, .longitude_rad = 0.0},
+    {.latitude_rad = 90.0 * astro_constants::kDegToRad, .longitude_rad = 0.0},
+    {.latitude_rad = -89.99 * astro_constants::kDegToRad, .longitude_rad = 0.0},
+    {.latitude_rad = 0.0, .longitude_rad = 0.0},
+};
+
+static const f64 kLsts[] = {0.0, 1.7, 4.9, 123.456, -2.0};
+
+// =================================================================
+// Accuracy
+// =================================================================
+
+TEST_CASE("SIMD double path stays within kMaxErrorF64Arcsec")
+{
+    // The scalar path is Coordinates::equatorial_to_horizontal itself (asin
+    // altitude, ~0.01" near the zenith); the bound documents the kernels
+    for (const SimdPath path : supported_paths())
+    {
+        if (path == SimdPath::Scalar)
+        {
+            continue;
+        }
+
+        f64 worst = 0.0;
+        for (const auto& observer : kObservers)
+        {
+            for (const f64 lst : kLsts)
+            {
+                worst = std::max(worst, max_error_arcsec<f64>(path, observer, lst));
+            }
+        }
+        MESSAGE(std::string(BatchTransform::get_path_name(path)) << " f64 max error: " << worst << " arcsec");
+        CHECK(worst <= BatchTransform::kMaxErrorF64Arcsec);
+    }
+}
+
+TEST_CASE("Float path stays within kMaxErrorF32Arcsec")
+{
+    for (const SimdPath path : supported_paths())
+    {
+        f64 worst = 0.0;
+        for (const auto& observer : kObservers)
+        {
+            for (const f64 lst : kLsts)
+            {
+                worst = std::max(worst, max_error_arcsec<f32>(path, observer, lst));
+            }
+        }
+        MESSAGE(std::string(BatchTransform::get_path_name(path)) << " f32 max error: " << worst << " arcsec");
+        CHECK(worst <= BatchTransform::kMaxErrorF32Arcsec);
+    }
+}
+
+// =================================================================
+// Batching
+// =================================================================
+
+TEST_CASE("Every batch length matches element-wise results (tail handling)")
+{
+    const ObserverLocation observer{.latitude_rad = 51.48 * astro_constants::kDegToRad,
+                                    .longitude_rad = 0.0};
+    const f64 lst = 2.5;
+
+    for (const SimdPath path : supported_paths())
+    {
+        const PathGuard guard;
+        REQUIRE(BatchTransform::set_path(path));
+
+        for (std::size_t n = 0; n <= 19; ++n)
+        {
+            std::vector<f64> ra(n), dec(n), alt(n, -99.0), az(n, -99.0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                ra[i] = 0.37 * static_cast<f64>(i);
+                dec[i] = 1.4 - 0.15 * static_cast<f64>(i);
+            }
+
+            BatchTransform::equatorial_to_horizontal(std::span<const f64>(ra), std::span<const f64>(dec),
+                                                     observer, lst, std::span<f64>(alt), std::span<f64>(az));
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const auto expected = Coordinates::equatorial_to_horizontal(
+                    EquatorialCoord{.ra = ra[i], .dec = dec[i]}, observer, lst);
+                CHECK(angular_error(alt[i], az[i], expected) / astro_constants::kArcSecToRad
+                      <= BatchTransform::kMaxErrorF64Arcsec);
+                CHECK(az[i] >= 0.0);
+                CHECK(az[i] <= astro_constants::kTwoPi);
+            }
+        }
+    }
+}
+
+TEST_CASE("Scalar path is always available; unsupported paths are refused")
+{
+    const PathGuard guard;
+    CHECK(BatchTransform::is_supported(SimdPath::Scalar));
+    CHECK(BatchTransform::set_path(SimdPath::Scalar));
+    CHECK(BatchTransform::get_path() == SimdPath::Scalar);
+
+    if (!BatchTransform::is_supported(SimdPath::Avx2))
+    {
+        CHECK_FALSE(BatchTransform::set_path(SimdPath::Avx2));
+        CHECK(BatchTransform::get_path() == SimdPath::Scalar);
+    }
+}
@@ -0,0 +1,193 @@
+/// @file test_catalog_converter.cpp
+/// @brief Unit tests for parallax::tools::CatalogConverter.
+///
+/// Verifies that chunks without valid rows (comments, blank lines) neither
+/// produce run files nor break the merge, and that failed conversions leave
+/// no temporary files behind.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "catalog/plxcat_format.hpp"
+#include "catalog_converter.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace parallax;
+using namespace parallax::tools;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+/// Input CSV plus the output path; removes every file the converter may create.
+class TempConversion
+{
+public:
+    TempConversion(const std::string& name, const std::string& content)
+        : m_input(std::filesystem::temp_directory_path() / (name + ".csv"))
+        , m_output(std::filesystem::temp_directory_path() / (name + ".plxcat"))
+    {
+        std::ofstream file(m_input, std::ios::binary);
+        file << content;
+    }
+
+    ~TempConversion()
+    {
+        std::error_code ec;
+        std::filesystem::remove(m_input, ec);
+        std::filesystem::remove(m_output, ec);
+        std::filesystem::remove(tmp_path(), ec);
+        std::filesystem::remove_all(runs_dir(), ec);
+    }
+
+    /// One worker and a 1 MB budget, i.e. the 1 MB minimum chunk size.
+    [[nodiscard]] ConverterConfig config() const
+    {
+        return ConverterConfig{
+            .input = m_input,
+            .output = m_output,
+            .temp_dir = {},
+            .nside = 4,
+            .memory_budget_bytes = 1ull << 20,
+            .thread_count = 1,
+            .max_merge_fan_in = 64,
+        };
+    }
+
+    [[nodiscard]] const std::filesystem::path& output() const { return m_output; }
+
+    [[nodiscard]] std::filesystem::path tmp_path() const
+    {
+        auto path = m_output;
+        path += ".tmp";
+        return path;
+    }
+
+    [[nodiscard]] std::filesystem::path runs_dir() const
+    {
+        auto path = m_output;
+        path += ".runs";
+        return path;
+    }
+
+    TempConversion(const TempConversion&) = delete;
+    TempConversion& operator=(const TempConversion&) = delete;
+
+private:
+    std::filesystem::path m_input;
+    std::filesystem::path m_output;
+};
+
+static constexpr std::size_t kChunkBytes = 1u << 20;
+
+/// Header plus rows filling exactly one converter chunk, ending on a newline.
+/// @param rows Receives the number of data rows written.
+static std::string make_one_chunk_csv(u64& rows)
+{
+    std::string content = "HIP,RA_deg,Dec_deg,Vmag,BV\n";
+    const std::size_t data_start = content.size();
+
+    char line[64];
+    rows = 0;
+    while (content.size() - data_start + 2 * sizeof(line) < kChunkBytes)
+    {
+        const int n = std::snprintf(line, sizeof(line), "%u,%.4f,%.4f,%.2f,0.50\n",
+                                    static_cast<unsigned>(rows + 1), static_cast<double>(rows % 3600) * 0.1,
+                                    static_cast<double>(rows % 1700) * 0.1 - 85.0,
+                                    static_cast<double>(rows % 12));
+        content.append(line, static_cast<std::size_t>(n));
+        ++rows;
+    }
+
+    // Last row padded with blanks (trimmed by the parser) to land exactly on the chunk end
+    const std::string last = "999999,10.0,10.0,1.0,0.50";
+    content += last;
+    content.append(kChunkBytes - (content.size() - data_start) - 1, ' ');
+    content += '\n';
+    ++rows;
+
+    REQUIRE(content.size() - data_start == kChunkBytes);
+    return content;
+}
+
+// =================================================================
+// Chunks without valid rows
+// =================================================================
+
+TEST_CASE("Trailing comment chunk after a newline-aligned chunk converts")
+{
+    u64 rows = 0;
+    std::string content = make_one_chunk_csv(rows);
+
+    SUBCASE("Comment line")
+    {
+        content += "# footer\n";
+    }
+    SUBCASE("Blank lines")
+    {
+        content += "\n   \n\n";
+    }
+
+    const TempConversion conversion("test_converter_footer", content);
+    CatalogConverter converter{conversion.config()};
+    const auto stats = converter.run();
+
+    REQUIRE(stats.has_value());
+    CHECK(stats->rows_written == rows);
+    CHECK(stats->run_count == 1);
+
+    std::ifstream file(conversion.output(), std::ios::binary);
+    catalog::CatalogHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    CHECK(header.entry_count == rows);
+
+    CHECK_FALSE(std::filesystem::exists(conversion.tmp_path()));
+    CHECK_FALSE(std::filesystem::exists(conversion.runs_dir()));
+}
+
+TEST_CASE("Input without valid rows fails without leftovers")
+{
+    const TempConversion conversion("test_converter_empty", "HIP,RA_deg,Dec_deg,Vmag,BV\n# nothing\n\n");
+    CatalogConverter converter{conversion.config()};
+
+    CHECK_FALSE(converter.run().has_value());
+    CHECK_FALSE(std::filesystem::exists(conversion.output()));
+    CHECK_FALSE(std::filesystem::exists(conversion.tmp_path()));
+    CHECK_FALSE(std::filesystem::exists(conversion.runs_dir()));
+}
+
+// =================================================================
+// Write failures
+// =================================================================
+
+TEST_CASE("Unwritable output reports failure and removes the temp file")
+{
+    u64 rows = 0;
+    const TempConversion conversion("test_converter_unwritable", make_one_chunk_csv(rows));
+
+    // A directory at the destination makes the final rename fail
+    std::filesystem::create_directory(conversion.output());
+
+    CatalogConverter converter{conversion.config()};
+    CHECK_FALSE(converter.run().has_value());
+    CHECK_FALSE(std::filesystem::exists(conversion.tmp_path()));
+    CHECK_FALSE(std::filesystem::exists(conversion.runs_dir()));
+}
@@ -306,4 +306,74 @@ TEST_CASE("Brightest star in catalog is Sirius (mag -1.46)")
     }
 
     CHECK(min_mag == doctest::Approx(-1.46f).epsilon(kMagTol));
-}
\ No newline at end of file
+}
+
+// =================================================================
+// Parallel (chunked) loading
+// =================================================================
+
+/// ~1.8 MB bright-star CSV (several loader chunks) with a few empty and
+/// malformed lines scattered through it.
+static std::string make_large_csv(u32 rows)
+{
+    std::string content = "Name,RA_deg,Dec_deg,Vmag,BV\n";
+    for (u32 i = 0; i < rows; ++i)
+    {
+        if (i % 9001 == 17)
+        {
+            content += "\n";
+        }
+        else if (i % 7919 == 5)
+        {
+            content += "Broken," + std::to_string(i) + "\n";
+        }
+        else
+        {
+            content += "Star" + std::to_string(i) + "," + std::to_string((i * 37) % 360) + ".125,"
+                     + std::to_string(static_cast<int>(i % 179) - 89) + ".5,"
+                     + std::to_string(i % 13) + ".25,0.5\n";
+        }
+    }
+    return content;
+}
+
+TEST_CASE("Parallel load matches the single-threaded result")
+{
+    const TempCsvFile csv("test_parallel.csv", make_large_csv(50000));
+
+    const auto serial = CatalogLoader::load_bright_star_csv(csv.path(), 1);
+    REQUIRE(serial.has_value());
+
+    for (u32 threads : {2u, 7u, 0u})
+    {
+        CAPTURE(threads);
+        const auto parallel = CatalogLoader::load_bright_star_csv(csv.path(), threads);
+        REQUIRE(parallel.has_value());
+        REQUIRE(parallel->size() == serial->size());
+
+        bool identical = true;
+        for (std::size_t i = 0; i < serial->size(); ++i)
+        {
+            const auto& a = (*serial)[i];
+            const auto& b = (*parallel)[i];
+            identical = identical && a.ra == b.ra && a.dec == b.dec && a.mag_v == b.mag_v
+                     && a.color_bv == b.color_bv && a.catalog_id == b.catalog_id;
+        }
+        CHECK(identical);
+    }
+}
+
+TEST_CASE("Line-number catalog_id survives chunking")
+{
+    const TempCsvFile csv("test_parallel_ids.csv", make_large_csv(50000));
+
+    const auto stars = CatalogLoader::load_bright_star_csv(csv.path(), 8);
+    REQUIRE(stars.has_value());
+
+    // Rows 5, 17, 7924, ... are malformed or empty; every other row i sits
+    // on file line i + 2 and gets catalog_id i + 1.
+    CHECK((*stars)[0].catalog_id == 1);
+    CHECK((*stars)[5].catalog_id == 7);
+    CHECK(stars->back().catalog_id == 50000);
+    CHECK(stars->back().mag_v == doctest::Approx(49999 % 13 + 0.25f).epsilon(kMagTol));
+}
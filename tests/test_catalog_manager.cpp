@@ -0,0 +1,257 @@
+/// @file test_catalog_manager.cpp
+/// @brief Unit tests for parallax::catalog::CatalogManager and the .plxcat format.
+///
+/// Verifies header/index validation, zero-copy pixel views into the mapping,
+/// and magnitude packing precision.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "catalog/catalog_manager.hpp"
+#include "catalog/plxcat_format.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::catalog;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helper: write a .plxcat file with the given per-pixel star lists
+// =================================================================
+
+class TempPlxcatFile
+{
+public:
+    TempPlxcatFile(const std::string& filename,
+                   u32 nside,
+                   const std::vector<std::vector<StarEntry>>& pixels)
+        : m_path(std::filesystem::temp_directory_path() / filename)
+    {
+        u64 total = 0;
+        for (const auto& stars : pixels)
+        {
+            total += stars.size();
+        }
+
+        m_header = make_catalog_header(total, nside);
+        std::vector<HEALPixIndexEntry> index(m_header.healpix_count, HEALPixIndexEntry{});
+        std::vector<PackedStarEntry> data;
+
+        for (std::size_t pix = 0; pix < pixels.size(); ++pix)
+        {
+            index[pix].offset = data.size() * sizeof(PackedStarEntry);
+            index[pix].count = static_cast<u32>(pixels[pix].size());
+            for (const auto& star : pixels[pix])
+            {
+                data.push_back(pack_star(star));
+            }
+        }
+
+        std::ofstream file(m_path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+        file.write(reinterpret_cast<const char*>(index.data()),
+                   static_cast<std::streamsize>(index.size() * sizeof(HEALPixIndexEntry)));
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size() * sizeof(PackedStarEntry)));
+    }
+
+    ~TempPlxcatFile()
+    {
+        std::filesystem::remove(m_path);
+    }
+
+    [[nodiscard]] const std::filesystem::path& path() const { return m_path; }
+
+    /// @brief Overwrite bytes at an offset (to corrupt a valid file).
+    void patch(u64 offset, const void* bytes, std::size_t size) const
+    {
+        std::fstream file(m_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+    }
+
+    TempPlxcatFile(const TempPlxcatFile&) = delete;
+    TempPlxcatFile& operator=(const TempPlxcatFile&) = delete;
+
+private:
+    std::filesystem::path m_path;
+    CatalogHeader m_header{};
+};
+
+static constexpr f32 kMagTol = 0.001f;
+
+static StarEntry make_star(f64 ra, f64 dec, f32 mag, f32 bv, u32 id)
+{
+    return StarEntry{.ra = ra, .dec = dec, .mag_v = mag, .color_bv = bv, .catalog_id = id};
+}
+
+// =================================================================
+// Format
+// =================================================================
+
+TEST_CASE("On-disk structs have the documented sizes")
+{
+    CHECK(sizeof(CatalogHeader) == 64);
+    CHECK(sizeof(HEALPixIndexEntry) == 16);
+    CHECK(sizeof(PackedStarEntry) == 32);
+}
+
+TEST_CASE("Magnitude packing keeps 3 decimals")
+{
+    const StarEntry sirius = make_star(1.7677, -0.2917, -1.46f, 0.009f, 32349);
+    const StarEntry unpacked = unpack_star(pack_star(sirius));
+
+    CHECK(unpacked.ra == sirius.ra);
+    CHECK(unpacked.dec == sirius.dec);
+    CHECK(unpacked.mag_v == doctest::Approx(-1.46f).epsilon(kMagTol));
+    CHECK(unpacked.color_bv == doctest::Approx(0.009f).epsilon(kMagTol));
+    CHECK(unpacked.catalog_id == 32349);
+}
+
+// =================================================================
+// Loading
+// =================================================================
+
+TEST_CASE("Load maps header, index and pixel-sorted data")
+{
+    const TempPlxcatFile plxcat("test_load.plxcat", 1, {
+        {make_star(0.1, 0.2, -1.0f, 0.1f, 1), make_star(0.11, 0.21, 3.5f, 0.6f, 2)},
+        {},
+        {make_star(1.0, -0.5, 2.0f, 1.2f, 3)},
+    });
+
+    CatalogManager manager;
+    const auto view = manager.load(plxcat.path());
+
+    REQUIRE(view.has_value());
+    CHECK(view->header->healpix_nside == 1);
+    CHECK(view->index.size() == 12);
+    CHECK(view->data.size() == 3);
+    CHECK(manager.get_star_count() == 3);
+    CHECK(manager.get_catalog_count() == 1);
+
+    SUBCASE("Pixel views point into the mapping (brightest first)")
+    {
+        const auto pix0 = view->pixel_stars(0);
+        REQUIRE(pix0.size() == 2);
+        CHECK(pix0[0].source_id == 1);
+        CHECK(pix0[1].source_id == 2);
+        CHECK(pix0.data() == view->data.data());
+
+        CHECK(view->pixel_stars(1).empty());
+
+        const auto pix2 = view->pixel_stars(2);
+        REQUIRE(pix2.size() == 1);
+        CHECK(pix2[0].source_id == 3);
+    }
+
+    SUBCASE("Expansion to runtime StarEntry")
+    {
+        const StarEntry star = unpack_star(view->data[2]);
+        CHECK(star.ra == doctest::Approx(1.0));
+        CHECK(star.mag_v == doctest::Approx(2.0f).epsilon(kMagTol));
+        CHECK(star.color_bv == doctest::Approx(1.2f).epsilon(kMagTol));
+    }
+}
+
+TEST_CASE("Multiple catalogs accumulate star counts")
+{
+    const TempPlxcatFile bright("test_multi_a.plxcat", 1, {{make_star(0.0, 0.0, 1.0f, 0.0f, 1)}});
+    const TempPlxcatFile faint("test_multi_b.plxcat", 2, {{}, {make_star(0.0, 0.0, 9.0f, 0.0f, 2),
+                                                              make_star(0.0, 0.0, 9.5f, 0.0f, 3)}});
+
+    CatalogManager manager;
+    REQUIRE(manager.load(bright.path()).has_value());
+    REQUIRE(manager.load(faint.path()).has_value());
+
+    CHECK(manager.get_catalog_count() == 2);
+    CHECK(manager.get_star_count() == 3);
+    CHECK(manager.get_catalog(1).header->healpix_count == 48);
+}
+
+// =================================================================
+// Error handling
+// =================================================================
+
+TEST_CASE("Non-existent file returns nullopt")
+{
+    CatalogManager manager;
+    CHECK_FALSE(manager.load("this_file_does_not_exist.plxcat").has_value());
+    CHECK(manager.get_catalog_count() == 0);
+}
+
+TEST_CASE("Bad magic is rejected")
+{
+    const TempPlxcatFile plxcat("test_bad_magic.plxcat", 1, {{make_star(0.0, 0.0, 1.0f, 0.0f, 1)}});
+    plxcat.patch(0, "NOT_CAT", 8);
+
+    CatalogManager manager;
+    CHECK_FALSE(manager.load(plxcat.path()).has_value());
+}
+
+TEST_CASE("Star count beyond file size is rejected")
+{
+    const TempPlxcatFile plxcat("test_truncated.plxcat", 1, {{make_star(0.0, 0.0, 1.0f, 0.0f, 1)}});
+    const u64 bogus_count = 1000;
+    plxcat.patch(offsetof(CatalogHeader, entry_count), &bogus_count, sizeof(bogus_count));
+
+    CatalogManager manager;
+    CHECK_FALSE(manager.load(plxcat.path()).has_value());
+}
+
+TEST_CASE("Index entry pointing outside the data section is rejected")
+{
+    const TempPlxcatFile plxcat("test_bad_index.plxcat", 1, {{make_star(0.0, 0.0, 1.0f, 0.0f, 1)}});
+    const HEALPixIndexEntry bogus{.offset = 4096, .count = 1, .reserved = 0};
+    plxcat.patch(sizeof(CatalogHeader), &bogus, sizeof(bogus));
+
+    CatalogManager manager;
+    CHECK_FALSE(manager.load(plxcat.path()).has_value());
+}
+
+TEST_CASE("Offsets that would overflow u64 are rejected")
+{
+    const TempPlxcatFile plxcat("test_overflow.plxcat", 1, {{make_star(0.0, 0.0, 1.0f, 0.0f, 1)}});
+
+    SUBCASE("Data offset wrapping past the end")
+    {
+        // data_offset + 32 wraps to 15, which the naive sum check accepted
+        const u64 bogus_offset = ~u64{0} - 16;
+        plxcat.patch(offsetof(CatalogHeader, data_offset), &bogus_offset, sizeof(bogus_offset));
+    }
+
+    SUBCASE("Star count whose byte size wraps")
+    {
+        const u64 bogus_count = (u64{1} << 59) + 1;   // × 32 wraps to 32
+        plxcat.patch(offsetof(CatalogHeader, entry_count), &bogus_count, sizeof(bogus_count));
+    }
+
+    SUBCASE("nside whose pixel count wraps")
+    {
+        const u32 bogus_nside = u32{1} << 31;         // 12 × nside² wraps to 0
+        const u32 bogus_count = 0;
+        plxcat.patch(offsetof(CatalogHeader, healpix_nside), &bogus_nside, sizeof(bogus_nside));
+        plxcat.patch(offsetof(CatalogHeader, healpix_count), &bogus_count, sizeof(bogus_count));
+    }
+
+    CatalogManager manager;
+    CHECK_FALSE(manager.load(plxcat.path()).has_value());
+}
@@ -0,0 +1,147 @@
+/// @file test_command_line.cpp
+/// @brief Unit tests for command-line parsing (interactive vs headless options).
+///
+/// Verifies defaults, every headless and window option, and that unknown options,
+/// missing values and out-of-range values are rejected instead of being
+/// silently ignored.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "core/command_line.hpp"
+#include "core/logger.hpp"
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::core;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static std::optional<CommandLine> parse(std::initializer_list<std::string_view> args)
+{
+    const std::vector<std::string_view> list(args);
+    return parse_command_line(list);
+}
+
+// =================================================================
+// Defaults
+// =================================================================
+
+TEST_CASE("No arguments selects the interactive window")
+{
+    const auto result = parse({});
+    REQUIRE(result.has_value());
+    CHECK_FALSE(result->headless);
+    CHECK_FALSE(result->help);
+    CHECK(result->frames_in_flight == 2);
+
+    const HeadlessConfig& config = result->headless_config;
+    CHECK(config.width == 1920);
+    CHECK(config.height == 1080);
+    CHECK(config.frames == 1);
+    CHECK_FALSE(config.julian_date.has_value());
+    CHECK(config.output_dir.has_value());
+}
+
+// =================================================================
+// Headless options
+// =================================================================
+
+TEST_CASE("Headless options are parsed")
+{
+    const auto result = parse({"--headless", "--frames", "10", "--width", "640", "--height", "480",
+                               "--jd", "2451545.0", "--time-step", "60", "--lat", "-33.5", "--lon", "151.2",
+                               "--alt", "80", "--az", "180", "--fov", "20", "--gpu-cull", "--output", "out/ci"});
+    REQUIRE(result.has_value());
+    CHECK(result->headless);
+
+    const HeadlessConfig& config = result->headless_config;
+    CHECK(config.frames == 10);
+    CHECK(config.width == 640);
+    CHECK(config.height == 480);
+    REQUIRE(config.julian_date.has_value());
+    CHECK(*config.julian_date == doctest::Approx(2451545.0));
+    CHECK(config.time_step_sec == doctest::Approx(60.0));
+    CHECK(config.latitude_deg == doctest::Approx(-33.5));
+    CHECK(config.longitude_deg == doctest::Approx(151.2));
+    CHECK(config.altitude_deg == doctest::Approx(80.0));
+    CHECK(config.azimuth_deg == doctest::Approx(180.0));
+    CHECK(config.fov_deg == doctest::Approx(20.0));
+    CHECK(config.gpu_cull);
+    REQUIRE(config.output_dir.has_value());
+    CHECK(*config.output_dir == std::filesystem::path{"out/ci"});
+}
+
+TEST_CASE("--no-output disables image writing")
+{
+    const auto result = parse({"--headless", "--no-output"});
+    REQUIRE(result.has_value());
+    CHECK_FALSE(result->headless_config.output_dir.has_value());
+}
+
+// =================================================================
+// Window options
+// =================================================================
+
+TEST_CASE("--frames-in-flight accepts 1 to kMaxFramesInFlight")
+{
+    for (const u32 frames : {1u, 2u, 3u})
+    {
+        const std::string value = std::to_string(frames);
+        const auto result = parse({"--frames-in-flight", value});
+        REQUIRE(result.has_value());
+        CHECK(result->frames_in_flight == frames);
+    }
+    CHECK(CommandLine::kMaxFramesInFlight == 3);
+
+    CHECK_FALSE(parse({"--frames-in-flight", "0"}).has_value());
+    CHECK_FALSE(parse({"--frames-in-flight", "4"}).has_value());
+}
+
+TEST_CASE("--help is reported")
+{
+    const auto result = parse({"--help"});
+    REQUIRE(result.has_value());
+    CHECK(result->help);
+    CHECK(get_usage().find("--headless") != std::string_view::npos);
+}
+
+// =================================================================
+// Rejection
+// =================================================================
+
+TEST_CASE("Unknown options and missing values are rejected")
+{
+    CHECK_FALSE(parse({"--bogus"}).has_value());
+    CHECK_FALSE(parse({"--bogus", "1"}).has_value());
+    CHECK_FALSE(parse({"--headless", "--frames"}).has_value());
+}
+
+TEST_CASE("Malformed and out-of-range values are rejected")
+{
+    CHECK_FALSE(parse({"--frames", "ten"}).has_value());
+    CHECK_FALSE(parse({"--frames", "0"}).has_value());
+    CHECK_FALSE(parse({"--width", "-5"}).has_value());
+    CHECK_FALSE(parse({"--jd", "2451545.0x"}).has_value());
+    CHECK_FALSE(parse({"--lat", "91"}).has_value());
+    CHECK_FALSE(parse({"--alt", "-90.5"}).has_value());
+    CHECK_FALSE(parse({"--fov", "0"}).has_value());
+}
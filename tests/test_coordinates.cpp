@@ -3,19 +3,55 @@
 ///
 /// Verifies equatorial-to-horizontal transforms, inverse round-trips,
 /// and stereographic screen projection against known reference values.
+/// The equatorial → horizontal cases go through BatchTransform and the
+/// whole suite runs once per SIMD path the CPU supports.
 
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define DOCTEST_CONFIG_IMPLEMENT
 #include <doctest/doctest.h>
 
+#include "astro/batch_transform.hpp"
 #include "astro/coordinates.hpp"
 #include "astro/time_system.hpp"
 #include "core/types.hpp"
 
 #include <cmath>
+#include <cstdio>
 
 using namespace parallax;
 using namespace parallax::astro;
 
+// =================================================================
+// Custom main: run every case on each supported transform path
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    int result = 0;
+    for (const SimdPath path : {SimdPath::Scalar, SimdPath::Avx2})
+    {
+        if (!BatchTransform::set_path(path))
+        {
+            std::printf("[test_coordinates] %s path not supported, skipped\n",
+                        BatchTransform::get_path_name(path));
+            continue;
+        }
+        std::printf("[test_coordinates] %s path\n", BatchTransform::get_path_name(path));
+        result |= doctest::Context(argc, argv).run();
+    }
+    return result;
+}
+
+/// Single-star equatorial → horizontal through the active BatchTransform path
+static HorizontalCoord to_horizontal(const EquatorialCoord& eq, const ObserverLocation& observer, f64 lst)
+{
+    const f64 ra[] = {eq.ra};
+    const f64 dec[] = {eq.dec};
+    f64 alt[1];
+    f64 az[1];
+    BatchTransform::equatorial_to_horizontal(ra, dec, observer, lst, alt, az);
+    return HorizontalCoord{.alt = alt[0], .az = az[0]};
+}
+
 // =================================================================
 // Tolerance constants
 // =================================================================
@@ -50,7 +86,7 @@ TEST_CASE("Polaris near zenith from North Pole")
     // At the North Pole, altitude = declination for any LST
     const f64 lst = 0.0;  // LST doesn't matter for a pole observer + polar star
 
-    const auto hz = Coordinates::equatorial_to_horizontal(polaris, north_pole, lst);
+    const auto hz = to_horizontal(polaris, north_pole, lst);
 
     // Altitude should be ≈ 89.264° (essentially at zenith)
     CHECK(hz.alt == doctest::Approx(89.264 * astro_constants::kDegToRad).epsilon(kArcMinRad));
@@ -73,7 +109,7 @@ TEST_CASE("Star transiting at zenith: RA=LST, Dec=Lat → alt≈90°")
         .longitude_rad = 0.0,
     };
 
-    const auto hz = Coordinates::equatorial_to_horizontal(eq, observer, lst);
+    const auto hz = to_horizontal(eq, observer, lst);
 
     // Altitude should be 90° (zenith)
     CHECK(hz.alt == doctest::Approx(astro_constants::kHalfPi).epsilon(kArcSecRad));
@@ -97,7 +133,7 @@ TEST_CASE("Star on celestial equator due south at transit")
         .longitude_rad = 0.0,
     };
 
-    const auto hz = Coordinates::equatorial_to_horizontal(eq, observer, lst);
+    const auto hz = to_horizontal(eq, observer, lst);
 
     // Altitude = 90° - 45° = 45°
     CHECK(hz.alt == doctest::Approx(45.0 * astro_constants::kDegToRad).epsilon(kArcSecRad));
@@ -123,7 +159,7 @@ TEST_CASE("Star below horizon has negative altitude")
         .longitude_rad = 0.0,
     };
 
-    const auto hz = Coordinates::equatorial_to_horizontal(eq, observer, lst);
+    const auto hz = to_horizontal(eq, observer, lst);
 
     CHECK(hz.alt < 0.0);
 }
@@ -147,7 +183,7 @@ TEST_CASE("Altitude is always in [-π/2, π/2]")
                 .dec = dec_deg * astro_constants::kDegToRad,
             };
 
-            const auto hz = Coordinates::equatorial_to_horizontal(eq, observer, lst);
+            const auto hz = to_horizontal(eq, observer, lst);
 
             CHECK(hz.alt >= -astro_constants::kHalfPi - 1e-10);
             CHECK(hz.alt <=  astro_constants::kHalfPi + 1e-10);
@@ -176,7 +212,7 @@ TEST_CASE("Round-trip: eq → hz → eq preserves RA/Dec")
         .dec = 38.784 * astro_constants::kDegToRad,
     };
 
-    const auto hz = Coordinates::equatorial_to_horizontal(original, observer, lst);
+    const auto hz = to_horizontal(original, observer, lst);
     const auto result = Coordinates::horizontal_to_equatorial(hz, observer, lst);
 
     // RA must match within 1 arcsecond
@@ -223,7 +259,7 @@ TEST_CASE("Round-trip for multiple stars at different locations")
 
         const f64 lst = tc.lst_hours * astro_constants::kHourToRad;
 
-        const auto hz = Coordinates::equatorial_to_horizontal(original, observer, lst);
+        const auto hz = to_horizontal(original, observer, lst);
 
         // Only test round-trip if star is above horizon
         if (hz.alt < -10.0 * astro_constants::kDegToRad)
@@ -383,6 +419,84 @@ TEST_CASE("Screen projection symmetric: equal offsets left/right give equal magn
     CHECK(result_west->x < 0.0f);
 }
 
+// =================================================================
+// Vector form: unit vector × per-frame rotation matrix
+// =================================================================
+
+TEST_CASE("Rotation matrix matches equatorial_to_horizontal")
+{
+    const ObserverLocation observers[] = {
+        {.latitude_rad = 28.76 * astro_constants::kDegToRad, .longitude_rad = 0.0},
+        {.latitude_rad = -33.86 * astro_constants::kDegToRad, .longitude_rad = 0.0},
+        {.latitude_rad = 89.9 * astro_constants::kDegToRad, .longitude_rad = 0.0},
+    };
+
+    for (const auto& observer : observers)
+    {
+        for (f64 lst_hours = 0.0; lst_hours < 24.0; lst_hours += 5.5)
+        {
+            const f64 lst = lst_hours * astro_constants::kHourToRad;
+            const Mat3d eq_to_hz = Coordinates::equatorial_to_horizontal_matrix(observer, lst);
+
+            for (f64 ra_deg = 5.0; ra_deg < 360.0; ra_deg += 37.0)
+            {
+                for (f64 dec_deg = -85.0; dec_deg <= 85.0; dec_deg += 17.0)
+                {
+                    const EquatorialCoord eq = {
+                        .ra  = ra_deg * astro_constants::kDegToRad,
+                        .dec = dec_deg * astro_constants::kDegToRad,
+                    };
+
+                    const auto expected = Coordinates::equatorial_to_horizontal(eq, observer, lst);
+                    const Vec3d local = eq_to_hz * Coordinates::equatorial_to_unit_vector(eq);
+                    const auto hz = Coordinates::unit_vector_to_horizontal(local);
+
+                    CHECK(local.z == doctest::Approx(std::sin(expected.alt)).epsilon(1e-12));
+                    CHECK(std::abs(hz.alt - expected.alt) < kArcSecRad * 1e-3);
+
+                    f64 az_diff = std::abs(hz.az - expected.az);
+                    if (az_diff > astro_constants::kPi)
+                    {
+                        az_diff = astro_constants::kTwoPi - az_diff;
+                    }
+                    CHECK(az_diff < kArcSecRad * 1e-3);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Rotation matrix is orthonormal")
+{
+    const ObserverLocation observer = {
+        .latitude_rad  = 51.48 * astro_constants::kDegToRad,
+        .longitude_rad = 0.0,
+    };
+    const Mat3d m = Coordinates::equatorial_to_horizontal_matrix(observer, 1.234);
+    const Mat3d identity = glm::transpose(m) * m;
+
+    for (int col = 0; col < 3; ++col)
+    {
+        for (int row = 0; row < 3; ++row)
+        {
+            CHECK(identity[col][row] == doctest::Approx(col == row ? 1.0 : 0.0).epsilon(1e-12));
+        }
+    }
+}
+
+TEST_CASE("Unit vector conversions invert each other")
+{
+    const EquatorialCoord eq{.ra = 4.2, .dec = -0.7};
+    const auto eq_back = Coordinates::unit_vector_to_equatorial(Coordinates::equatorial_to_unit_vector(eq));
+    CHECK(eq_back.ra == doctest::Approx(eq.ra).epsilon(1e-12));
+    CHECK(eq_back.dec == doctest::Approx(eq.dec).epsilon(1e-12));
+
+    const HorizontalCoord hz{.alt = 0.3, .az = 5.9};
+    const auto hz_back = Coordinates::unit_vector_to_horizontal(Coordinates::horizontal_to_unit_vector(hz));
+    CHECK(hz_back.alt == doctest::Approx(hz.alt).epsilon(1e-12));
+    CHECK(hz_back.az == doctest::Approx(hz.az).epsilon(1e-12));
+}
+
 // =================================================================
 // Integration: full pipeline RA/Dec → Alt/Az → Screen
 // =================================================================
@@ -0,0 +1,225 @@
+/// @file test_csv_scanner.cpp
+/// @brief Unit tests for parallax::catalog::CsvScanner.
+///
+/// Verifies line/field splitting across 64-byte block boundaries, the
+/// rest-of-line last field, and agreement with a naive reference splitter
+/// on random input, for every block scanner the CPU supports.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "catalog/csv_scanner.hpp"
+#include "core/types.hpp"
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::catalog;
+
+// =================================================================
+// Helpers
+// =================================================================
+
+/// Restores the detected path when a test case forces another one
+class PathGuard
+{
+public:
+    PathGuard() : m_saved(CsvScanner::get_path()) {}
+    ~PathGuard() { CsvScanner::set_path(m_saved); }
+
+    PathGuard(const PathGuard&) = delete;
+    PathGuard& operator=(const PathGuard&) = delete;
+
+private:
+    CsvScanPath m_saved;
+};
+
+static std::vector<CsvScanPath> supported_paths()
+{
+    std::vector<CsvScanPath> paths;
+    for (const CsvScanPath path : {CsvScanPath::Scalar, CsvScanPath::Sse2, CsvScanPath::Avx2})
+    {
+        if (CsvScanner::is_supported(path))
+        {
+            paths.push_back(path);
+        }
+    }
+    return paths;
+}
+
+struct SplitLine
+{
+    std::string line;
+    std::vector<std::string> fields;
+};
+
+/// Run the scanner over `text` with `max_fields` slots per line.
+static std::vector<SplitLine> scan_all(std::string_view text, std::size_t max_fields)
+{
+    CsvScanner scanner(text);
+    std::vector<std::string_view> fields(max_fields);
+    std::string_view line;
+    std::size_t count = 0;
+
+    std::vector<SplitLine> out;
+    while (scanner.next_line(line, fields, count))
+    {
+        SplitLine split{.line = std::string(line), .fields = {}};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            split.fields.emplace_back(fields[i]);
+        }
+        out.push_back(std::move(split));
+    }
+    return out;
+}
+
+/// Byte-at-a-time reference with the same semantics.
+static std::vector<SplitLine> reference_split(std::string_view text, std::size_t max_fields)
+{
+    std::vector<SplitLine> out;
+    std::size_t pos = 0;
+    while (pos < text.size())
+    {
+        const auto newline = text.find('\n', pos);
+        const auto end = (newline == std::string_view::npos) ? text.size() : newline;
+        const std::string_view line = text.substr(pos, end - pos);
+
+        SplitLine split{.line = std::string(line), .fields = {}};
+        std::string_view rest = line;
+        while (split.fields.size() + 1 < max_fields)
+        {
+            const auto comma = rest.find(',');
+            if (comma == std::string_view::npos)
+            {
+                break;
+            }
+            split.fields.emplace_back(rest.substr(0, comma));
+            rest.remove_prefix(comma + 1);
+        }
+        split.fields.emplace_back(rest);
+        out.push_back(std::move(split));
+
+        pos = (newline == std::string_view::npos) ? text.size() : newline + 1;
+    }
+    return out;
+}
+
+// =================================================================
+// Tests
+// =================================================================
+
+TEST_CASE("Splits lines and fields")
+{
+    const auto lines = scan_all("HIP,RA\n1,2.5\n", 5);
+    REQUIRE(lines.size() == 2);
+    CHECK(lines[0].line == "HIP,RA");
+    CHECK(lines[0].fields == std::vector<std::string>{"HIP", "RA"});
+    CHECK(lines[1].fields == std::vector<std::string>{"1", "2.5"});
+}
+
+TEST_CASE("Last line without newline, empty lines and CR are preserved")
+{
+    const auto lines = scan_all("a,b\r\n\nc,d", 5);
+    REQUIRE(lines.size() == 3);
+    CHECK(lines[0].fields == std::vector<std::string>{"a", "b\r"});
+    CHECK(lines[1].line.empty());
+    CHECK(lines[1].fields == std::vector<std::string>{""});
+    CHECK(lines[2].fields == std::vector<std::string>{"c", "d"});
+}
+
+TEST_CASE("Last field takes the rest of the line")
+{
+    const auto lines = scan_all("1,2,3,4,5,6,7\n", 5);
+    REQUIRE(lines.size() == 1);
+    REQUIRE(lines[0].fields.size() == 5);
+    CHECK(lines[0].fields[4] == "5,6,7");
+}
+
+TEST_CASE("Lines spanning 64-byte blocks")
+{
+    std::string text;
+    for (int i = 0; i < 50; ++i)
+    {
+        text += std::string(static_cast<std::size_t>(i * 7 % 97), 'x') + "," + std::to_string(i) + "\n";
+    }
+
+    const PathGuard guard;
+    for (const CsvScanPath path : supported_paths())
+    {
+        CAPTURE(CsvScanner::get_path_name(path));
+        REQUIRE(CsvScanner::set_path(path));
+
+        const auto lines = scan_all(text, 5);
+        REQUIRE(lines.size() == 50);
+        for (int i = 0; i < 50; ++i)
+        {
+            REQUIRE(lines[static_cast<std::size_t>(i)].fields.size() == 2);
+            CHECK(lines[static_cast<std::size_t>(i)].fields[1] == std::to_string(i));
+        }
+    }
+}
+
+TEST_CASE("Matches the reference splitter on random input")
+{
+    const std::array<char, 6> alphabet = {',', '\n', 'a', '1', '.', ' '};
+    std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+
+    const PathGuard guard;
+    for (const CsvScanPath path : supported_paths())
+    {
+        CAPTURE(CsvScanner::get_path_name(path));
+        REQUIRE(CsvScanner::set_path(path));
+
+        std::mt19937 rng(42);
+        for (std::size_t length : {0u, 1u, 63u, 64u, 65u, 127u, 128u, 1000u, 4099u})
+        {
+            std::string text(length, ' ');
+            for (auto& c : text)
+            {
+                c = alphabet[pick(rng)];
+            }
+
+            for (std::size_t max_fields : {1u, 3u, 5u})
+            {
+                const auto got = scan_all(text, max_fields);
+                const auto expected = reference_split(text, max_fields);
+                REQUIRE(got.size() == expected.size());
+                for (std::size_t i = 0; i < got.size(); ++i)
+                {
+                    REQUIRE(got[i].line == expected[i].line);
+                    REQUIRE(got[i].fields == expected[i].fields);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Reports the selected SIMD path")
+{
+    const std::string_view path = CsvScanner::get_simd_path();
+    CHECK((path == "AVX2" || path == "SSE2" || path == "scalar"));
+    CHECK(path == CsvScanner::get_path_name(CsvScanner::get_path()));
+}
+
+TEST_CASE("Scalar path is always available; unsupported paths are refused")
+{
+    const PathGuard guard;
+    CHECK(CsvScanner::is_supported(CsvScanPath::Scalar));
+    CHECK(CsvScanner::set_path(CsvScanPath::Scalar));
+    CHECK(CsvScanner::get_path() == CsvScanPath::Scalar);
+    CHECK(std::string_view(CsvScanner::get_simd_path()) == "scalar");
+
+    for (const CsvScanPath path : {CsvScanPath::Sse2, CsvScanPath::Avx2})
+    {
+        if (!CsvScanner::is_supported(path))
+        {
+            CHECK_FALSE(CsvScanner::set_path(path));
+            CHECK(CsvScanner::get_path() == CsvScanPath::Scalar);
+        }
+    }
+}
@@ -0,0 +1,272 @@
+/// @file test_ephemeris.cpp
+/// @brief Unit tests for astro::Ephemeris and the Chebyshev helpers.
+///
+/// The fitted windows are checked against the direct series they replace:
+/// geocentric directions to 0.1 mas, positions to 1e-9 AU (150 m), and
+/// velocities against a central difference of the series.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "astro/chebyshev.hpp"
+#include "astro/ephemeris.hpp"
+#include "core/job_system.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace parallax;
+using namespace parallax::astro;
+
+// =================================================================
+// Custom main: initialize logger before tests (JobSystem logs)
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static constexpr f64 kMasPerRad = 180.0 * 3600.0 * 1000.0 / astro_constants::kPi;
+static constexpr f64 kStartJd = 2460000.5;     // 2023-02-25
+
+static constexpr std::array kGeocentricBodies = {
+    Body::Sun, Body::Moon, Body::Mercury, Body::Venus, Body::Mars,
+    Body::Jupiter, Body::Saturn, Body::Uranus, Body::Neptune,
+};
+
+static f64 angle_mas(const Vec3d& a, const Vec3d& b)
+{
+    return glm::length(a - b) / glm::length(b) * kMasPerRad;
+}
+
+static Vec3d series_velocity(Body body, f64 jd_tt)
+{
+    constexpr f64 kStep = 1.0e-3;
+    return (Ephemeris::direct_geocentric(body, jd_tt + kStep)
+            - Ephemeris::direct_geocentric(body, jd_tt - kStep)) / (2.0 * kStep);
+}
+
+// =================================================================
+// Chebyshev helpers
+// =================================================================
+
+TEST_CASE("Chebyshev fit reproduces a polynomial and its derivative")
+{
+    // p(x) = 1 − 2x + 3x³ on each axis (scaled), degree 3 < 5 coefficients
+    constexpr u32 kCount = 5;
+    std::array<f64, 3 * kCount> coefficients{};
+    for (u32 axis = 0; axis < 3; ++axis)
+    {
+        std::array<f64, kCount> samples{};
+        for (u32 k = 0; k < kCount; ++k)
+        {
+            const f64 x = chebyshev_node(k, kCount);
+            samples[k] = static_cast<f64>(axis + 1) * (1.0 - 2.0 * x + 3.0 * x * x * x);
+        }
+        fit_chebyshev(samples, std::span<f64>(coefficients.data() + axis * kCount, kCount));
+    }
+
+    for (f64 x = -1.0; x <= 1.0; x += 0.125)
+    {
+        const ChebyshevResult r = evaluate_chebyshev(coefficients.data(), kCount, x);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const f64 scale = static_cast<f64>(axis + 1);
+            CHECK(r.value[axis] == doctest::Approx(scale * (1.0 - 2.0 * x + 3.0 * x * x * x)).epsilon(1e-12));
+            CHECK(r.derivative[axis] == doctest::Approx(scale * (-2.0 + 9.0 * x * x)).epsilon(1e-12));
+        }
+    }
+}
+
+// =================================================================
+// Direct series
+// =================================================================
+
+TEST_CASE("Series put the Sun and Moon where they belong")
+{
+    // Sun at J2000.0: RA 18h45m, Dec −23.0°, 0.9833 AU
+    const Vec3d sun = Ephemeris::direct_geocentric(Body::Sun, astro_constants::kJ2000);
+    CHECK(std::atan2(sun.y, sun.x) * astro_constants::kRadToDeg + 360.0 == doctest::Approx(281.29).epsilon(2e-4));
+    CHECK(std::asin(sun.z / glm::length(sun)) * astro_constants::kRadToDeg == doctest::Approx(-23.03).epsilon(1e-3));
+    CHECK(glm::length(sun) == doctest::Approx(0.98333).epsilon(1e-4));
+
+    // Moon stays between perigee and apogee over a month
+    for (f64 jd = kStartJd; jd < kStartJd + 30.0; jd += 0.5)
+    {
+        const f64 km = glm::length(Ephemeris::direct_geocentric(Body::Moon, jd)) * 149597870.7;
+        CHECK(km > 356000.0);
+        CHECK(km < 407000.0);
+    }
+
+    // Geocentric Sun is minus the heliocentric Earth
+    CHECK(glm::length(Ephemeris::direct_heliocentric(Body::Earth, kStartJd)
+                      + Ephemeris::direct_geocentric(Body::Sun, kStartJd)) < 1e-15);
+}
+
+// =================================================================
+// Fitted windows against the series
+// =================================================================
+
+TEST_CASE("Fitted positions match the direct series over a year")
+{
+    core::JobSystem jobs(2);
+    Ephemeris ephemeris(jobs);
+
+    // Uneven step so samples land everywhere inside the windows
+    for (f64 jd = kStartJd; jd < kStartJd + 365.0; jd += 0.173)
+    {
+        ephemeris.update(jd);
+        ephemeris.wait_for_refit();
+        REQUIRE(ephemeris.covers(jd));
+
+        for (const Body body : kGeocentricBodies)
+        {
+            const Vec3d fitted = ephemeris.get_geocentric(body, jd).position;
+            const Vec3d direct = Ephemeris::direct_geocentric(body, jd);
+            CHECK(angle_mas(fitted, direct) < 0.1);
+            CHECK(glm::length(fitted - direct) < 1e-9);
+        }
+
+        const Vec3d moon = ephemeris.get_heliocentric(Body::Moon, jd).position;
+        CHECK(glm::length(moon - Ephemeris::direct_heliocentric(Body::Moon, jd)) < 1e-9);
+    }
+
+    // Served entirely from polynomials; ~2100 updates, under one refit a day
+    // (the Moon's 4-day window sets the pace)
+    CHECK(ephemeris.get_fallback_count() == 0);
+    CHECK(ephemeris.get_refit_count() > 1);
+    CHECK(ephemeris.get_refit_count() < 365);
+}
+
+TEST_CASE("Fitted velocity is the derivative of the series")
+{
+    core::JobSystem jobs(1);
+    Ephemeris ephemeris(jobs);
+
+    for (f64 jd = kStartJd; jd < kStartJd + 60.0; jd += 0.37)
+    {
+        ephemeris.update(jd);
+        ephemeris.wait_for_refit();
+
+        for (const Body body : kGeocentricBodies)
+        {
+            const Vec3d expected = series_velocity(body, jd);
+            const Vec3d fitted = ephemeris.get_geocentric(body, jd).velocity;
+            CHECK(glm::length(fitted - expected) < 1e-6 * glm::length(expected));
+        }
+    }
+
+    // The Moon moves ~13°/day at ~0.0026 AU: ~6e-4 AU/day
+    const f64 moon_speed = glm::length(ephemeris.get_geocentric(Body::Moon, kStartJd + 60.0).velocity);
+    CHECK(moon_speed > 5.0e-4);
+    CHECK(moon_speed < 7.0e-4);
+}
+
+TEST_CASE("Windows follow time running backward")
+{
+    core::JobSystem jobs(1);
+    Ephemeris ephemeris(jobs);
+
+    for (f64 jd = kStartJd; jd > kStartJd - 120.0; jd -= 0.29)
+    {
+        ephemeris.update(jd);
+        ephemeris.wait_for_refit();
+        REQUIRE(ephemeris.covers(jd));
+
+        const Vec3d fitted = ephemeris.get_geocentric(Body::Moon, jd).position;
+        CHECK(angle_mas(fitted, Ephemeris::direct_geocentric(Body::Moon, jd)) < 0.1);
+    }
+    CHECK(ephemeris.get_fallback_count() == 0);
+}
+
+// =================================================================
+// Background refit
+// =================================================================
+
+TEST_CASE("A jump outside the windows falls back to the series until the refit lands")
+{
+    core::JobSystem jobs(1);
+    Ephemeris ephemeris(jobs);
+    ephemeris.update(kStartJd);
+    REQUIRE(ephemeris.get_refit_count() == 1);
+    REQUIRE(ephemeris.covers(kStartJd));
+
+    // Ten years on: every window is stale, a refit is now in flight
+    const f64 later = kStartJd + 3652.5;
+    ephemeris.update(later);
+    CHECK_FALSE(ephemeris.covers(later));
+
+    // Still exact meanwhile: positions come from the series itself
+    const Vec3d mars = ephemeris.get_geocentric(Body::Mars, later).position;
+    CHECK(glm::length(mars - Ephemeris::direct_geocentric(Body::Mars, later)) < 1e-15);
+    CHECK(ephemeris.get_fallback_count() > 0);
+
+    // Picked up by a later update() without blocking the caller
+    while (ephemeris.get_refit_count() < 2)
+    {
+        ephemeris.update(later);
+    }
+    CHECK(ephemeris.covers(later));
+
+    const u64 fallbacks = ephemeris.get_fallback_count();
+    const Vec3d fitted = ephemeris.get_geocentric(Body::Mars, later).position;
+    CHECK(angle_mas(fitted, Ephemeris::direct_geocentric(Body::Mars, later)) < 0.1);
+    CHECK(ephemeris.get_fallback_count() == fallbacks);
+}
+
+TEST_CASE("Without worker threads refits land in the same update()")
+{
+    core::JobSystem jobs(0);
+    REQUIRE(jobs.get_thread_count() == 1);
+    Ephemeris ephemeris(jobs);
+    ephemeris.update(kStartJd);
+
+    // Nothing would run a queued job: the jump is refitted inline
+    const f64 later = kStartJd + 3652.5;
+    ephemeris.update(later);
+    CHECK(ephemeris.get_refit_count() == 2);
+    CHECK(ephemeris.covers(later));
+
+    // Ordinary margin refits as time runs forward keep the windows current
+    for (f64 jd = later; jd < later + 120.0; jd += 0.5)
+    {
+        ephemeris.update(jd);
+        REQUIRE(ephemeris.covers(jd));
+    }
+    CHECK(ephemeris.get_refit_count() > 2);
+}
+
+TEST_CASE("Window scale trades refits for accuracy")
+{
+    core::JobSystem jobs(1);
+    Ephemeris coarse(jobs, EphemerisConfig{.window_scale = 2.0});
+    Ephemeris fine(jobs, EphemerisConfig{.window_scale = 0.5});
+
+    f64 coarse_error = 0.0;
+    f64 fine_error = 0.0;
+    for (f64 jd = kStartJd; jd < kStartJd + 60.0; jd += 0.11)
+    {
+        coarse.update(jd);
+        coarse.wait_for_refit();
+        fine.update(jd);
+        fine.wait_for_refit();
+
+        const Vec3d direct = Ephemeris::direct_geocentric(Body::Moon, jd);
+        coarse_error = std::max(coarse_error, angle_mas(coarse.get_geocentric(Body::Moon, jd).position, direct));
+        fine_error = std::max(fine_error, angle_mas(fine.get_geocentric(Body::Moon, jd).position, direct));
+    }
+
+    CHECK(fine_error < coarse_error);
+    CHECK(fine.get_refit_count() > coarse.get_refit_count());
+}
@@ -0,0 +1,238 @@
+/// @file test_frame_arena.cpp
+/// @brief Unit tests for parallax::core::FrameArena and AllocationTracker.
+///
+/// Verifies bump allocation and alignment, per-frame regions, overflow
+/// behavior, concurrent allocation from jobs, the tracker's new_handler
+/// loop, and that a steady-state frame built on FrameArena + JobSystem
+/// makes zero heap allocations.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "core/allocation_tracker.hpp"
+#include "core/frame_arena.hpp"
+#include "core/job_system.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <span>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::core;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// FrameArena
+// =================================================================
+
+TEST_CASE("Allocations are aligned, disjoint and bump the offset")
+{
+    FrameArena arena(4096, 2);
+    arena.begin_frame(0);
+    CHECK(arena.get_capacity() == 4096);
+
+    auto* a = static_cast<std::byte*>(arena.allocate(3, 1));
+    auto* b = static_cast<std::byte*>(arena.allocate(8, 8));
+    const auto c = arena.allocate_array<f64>(10);
+    auto* d = static_cast<std::byte*>(arena.allocate(1, 64));
+
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(c.size() == 10);
+    REQUIRE(d != nullptr);
+
+    CHECK(reinterpret_cast<std::uintptr_t>(b) % 8 == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(c.data()) % alignof(f64) == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(d) % 64 == 0);
+    CHECK(b >= a + 3);
+    CHECK(reinterpret_cast<std::byte*>(c.data()) >= b + 8);
+    CHECK(d >= reinterpret_cast<std::byte*>(c.data() + 10));
+    CHECK(arena.get_used() == static_cast<std::size_t>(d + 1 - a));
+}
+
+TEST_CASE("begin_frame rewinds only that frame's region")
+{
+    // The default ring and the deepest one the application allows
+    for (const u32 frame_count : {2u, 3u})
+    {
+        CAPTURE(frame_count);
+        FrameArena arena(1024, frame_count);
+
+        // Every slot gets its own region; earlier frames' data survives the later ones
+        std::vector<std::span<u32>> frames;
+        for (u32 frame = 0; frame < frame_count; ++frame)
+        {
+            arena.begin_frame(frame);
+            frames.push_back(arena.allocate_array<u32>(16));
+            std::fill(frames.back().begin(), frames.back().end(), 0x01010101u * (frame + 1));
+        }
+        for (u32 frame = 0; frame < frame_count; ++frame)
+        {
+            for (u32 other = 0; other < frame; ++other)
+            {
+                CHECK(frames[frame].data() != frames[other].data());
+            }
+            const u32 pattern = 0x01010101u * (frame + 1);
+            CHECK(std::all_of(frames[frame].begin(), frames[frame].end(), [&](u32 v) { return v == pattern; }));
+        }
+
+        // Coming back to frame 0 reuses its memory from the start
+        arena.begin_frame(0);
+        CHECK(arena.get_used() == 0);
+        CHECK(arena.allocate_array<u32>(16).data() == frames[0].data());
+        CHECK(arena.get_peak() >= 64);
+    }
+}
+
+TEST_CASE("Exhausted region returns empty and keeps earlier allocations")
+{
+    FrameArena arena(256, 1);
+    arena.begin_frame(0);
+
+    const auto first = arena.allocate_array<u8>(200);
+    REQUIRE(first.size() == 200);
+    const std::size_t used = arena.get_used();
+
+    CHECK(arena.allocate_array<u8>(100).empty());
+    CHECK(arena.allocate(57, 1) == nullptr);
+    CHECK(arena.get_used() == used);
+    CHECK(arena.get_overflow_count() == 2);
+
+    CHECK(arena.allocate_array<u8>(56).size() == 56);
+    CHECK(arena.get_remaining() == 0);
+}
+
+TEST_CASE("Concurrent allocation from jobs hands out disjoint blocks")
+{
+    JobSystem jobs(3);
+    FrameArena arena(1 << 20, 1);
+    arena.begin_frame(0);
+
+    constexpr u32 kBlocks = 2000;
+    std::vector<u32*> blocks(kBlocks, nullptr);
+
+    jobs.parallel_for(kBlocks, 1, [&](u32 begin, u32 end) {
+        for (u32 i = begin; i < end; ++i)
+        {
+            const auto block = arena.allocate_array<u32>(32);
+            std::fill(block.begin(), block.end(), i);
+            blocks[i] = block.data();
+        }
+    });
+
+    for (u32 i = 0; i < kBlocks; ++i)
+    {
+        REQUIRE(blocks[i] != nullptr);
+        CHECK(std::all_of(blocks[i], blocks[i] + 32, [i](u32 v) { return v == i; }));
+    }
+    CHECK(arena.get_used() == kBlocks * 32 * sizeof(u32));
+}
+
+// =================================================================
+// AllocationTracker
+// =================================================================
+
+TEST_CASE("AllocationTracker counts operator new and delete")
+{
+    const u64 allocs_before = AllocationTracker::get_allocation_count();
+    const u64 frees_before = AllocationTracker::get_deallocation_count();
+
+    {
+        std::vector<int> values(100);
+        values[0] = 1;
+        auto* aligned = new (std::align_val_t{128}) double[4];
+        CHECK(reinterpret_cast<std::uintptr_t>(aligned) % 128 == 0);
+        ::operator delete[](aligned, std::align_val_t{128});
+    }
+
+    CHECK(AllocationTracker::get_allocation_count() - allocs_before >= 2);
+    CHECK(AllocationTracker::get_deallocation_count() - frees_before >= 2);
+}
+
+TEST_CASE("Failed allocations call the new_handler until it gives up")
+{
+    // Larger than any address space: malloc always fails
+    volatile std::size_t huge = std::numeric_limits<std::size_t>::max() / 2;
+
+    static int s_handler_calls = 0;
+    s_handler_calls = 0;
+    const std::new_handler previous = std::set_new_handler([] {
+        // Pretend to free memory twice, then uninstall so operator new throws
+        if (++s_handler_calls == 2)
+        {
+            std::set_new_handler(nullptr);
+        }
+    });
+
+    const u64 allocs_before = AllocationTracker::get_allocation_count();
+    CHECK_THROWS_AS((void)::operator new(huge), std::bad_alloc);
+    CHECK(s_handler_calls == 2);
+
+    // nothrow forms report the same failure as nullptr
+    CHECK(::operator new(huge, std::nothrow) == nullptr);
+    CHECK(::operator new[](huge, std::align_val_t{64}, std::nothrow) == nullptr);
+
+    CHECK(AllocationTracker::get_allocation_count() == allocs_before);
+    std::set_new_handler(previous);
+}
+
+TEST_CASE("Steady-state frames on FrameArena + JobSystem make no heap allocations")
+{
+    constexpr u32 kFramesInFlight = 2;
+    JobSystem jobs(3);
+    FrameArena arena(1 << 20, kFramesInFlight);
+
+    // Same shape as Starfield::update: arena scratch, parallel transform
+    // into disjoint ranges, then a sequential reduction
+    const auto run_frame = [&](u32 frame) {
+        arena.begin_frame(frame % kFramesInFlight);
+        const auto scratch = arena.allocate_array<f32>(50000);
+        jobs.parallel_for(static_cast<u32>(scratch.size()), 256, [&](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i)
+            {
+                scratch[i] = static_cast<f32>(i % 97) * 0.5f;
+            }
+        });
+        f64 sum = 0.0;
+        for (const f32 v : scratch)
+        {
+            sum += v;
+        }
+        return sum;
+    };
+
+    // Warm-up: first frames may size internal buffers
+    for (u32 frame = 0; frame < 4; ++frame)
+    {
+        (void)run_frame(frame);
+    }
+
+    const u64 before = AllocationTracker::get_allocation_count();
+    f64 checksum = 0.0;
+    for (u32 frame = 4; frame < 104; ++frame)
+    {
+        checksum += run_frame(frame);
+    }
+    const u64 allocations = AllocationTracker::get_allocation_count() - before;
+
+    CHECK(checksum > 0.0);
+    CHECK(allocations == 0);
+}
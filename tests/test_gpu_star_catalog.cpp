@@ -0,0 +1,228 @@
+/// @file test_gpu_star_catalog.cpp
+/// @brief Unit tests for the compute cull path's CPU-side data (GpuStarCatalog, StarCullPushConstants).
+///
+/// The catalog must hold every star brightest first with its color on the
+/// same row. The push constants are checked by running the cull of
+/// starfield_cull.comp on the CPU in f32 and comparing its survivors with
+/// ProjectionContext::project, which catches row/column mix-ups in the
+/// packed rotation as well as f32 precision problems.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "astro/coordinates.hpp"
+#include "catalog/magnitude_filter.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/job_system.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+#include "rendering/camera.hpp"
+#include "rendering/gpu_star_catalog.hpp"
+#include "rendering/projection_context.hpp"
+#include "rendering/star_vertex.hpp"
+
+#include <glm/geometric.hpp>
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <span>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::rendering;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static std::vector<catalog::StarEntry> random_stars(std::size_t count, u32 seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<f64> ra_dist(0.0, astro_constants::kTwoPi);
+    std::uniform_real_distribution<f64> sin_dec_dist(-1.0, 1.0);
+    std::uniform_real_distribution<f32> mag_dist(-1.5f, 12.0f);
+    std::uniform_real_distribution<f32> bv_dist(-0.4f, 2.0f);
+
+    std::vector<catalog::StarEntry> stars(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        stars[i] = catalog::StarEntry{
+            .ra = ra_dist(rng),
+            .dec = std::asin(sin_dec_dist(rng)),
+            .mag_v = mag_dist(rng),
+            .color_bv = bv_dist(rng),
+            .catalog_id = static_cast<u32>(i),
+        };
+    }
+    return stars;
+}
+
+/// CPU transcription of cull_star() in starfield_cull.comp.
+static bool shader_cull(const StarCullPushConstants& pc, const Vec4f& entry, Vec2f& screen)
+{
+    if (entry.w > pc.mag_limit)
+    {
+        return false;
+    }
+
+    const Vec3f d{entry};
+    if (glm::dot(Vec3f{pc.zenith}, d) < 0.0f)
+    {
+        return false;
+    }
+
+    const Vec3f v{glm::dot(Vec3f{pc.view_right}, d), glm::dot(Vec3f{pc.view_up}, d),
+                  glm::dot(Vec3f{pc.view_forward}, d)};
+    if (v.z < pc.zenith.w || v.z <= 0.0f)
+    {
+        return false;
+    }
+
+    screen = Vec2f{v.x, v.y} * (pc.scale / v.z);
+    return std::abs(screen.x) <= 1.0f && std::abs(screen.y) <= 1.0f;
+}
+
+// =================================================================
+// Catalog packing
+// =================================================================
+
+TEST_CASE("Catalog holds every star brightest first with its own color")
+{
+    const auto stars = random_stars(5000, 7);
+    core::JobSystem jobs(0);
+    catalog::MagnitudeFilter layers(8, jobs);
+    layers.build(stars);
+
+    const auto gpu = GpuStarCatalog::from_layers(layers);
+    REQUIRE(gpu.size() == stars.size());
+    REQUIRE(gpu.color_bv.size() == stars.size());
+
+    for (u32 i = 1; i < gpu.size(); ++i)
+    {
+        REQUIRE(gpu.direction_mag[i - 1].w <= gpu.direction_mag[i].w);
+    }
+
+    // (magnitude, color) pairs survive the reordering unchanged
+    std::multimap<f32, f32> expected;
+    for (const auto& star : stars)
+    {
+        expected.emplace(star.mag_v, star.color_bv);
+    }
+    for (u32 i = 0; i < gpu.size(); ++i)
+    {
+        const auto [first, last] = expected.equal_range(gpu.direction_mag[i].w);
+        bool found = false;
+        for (auto it = first; it != last && !found; ++it)
+        {
+            found = (it->second == gpu.color_bv[i]);
+        }
+        REQUIRE(found);
+        CHECK(glm::length(Vec3f{gpu.direction_mag[i]}) == doctest::Approx(1.0f).epsilon(1e-6));
+    }
+}
+
+TEST_CASE("Empty filter gives an empty catalog")
+{
+    core::JobSystem jobs(0);
+    catalog::MagnitudeFilter layers(8, jobs);
+    layers.build(std::vector<catalog::StarEntry>{});
+    CHECK(GpuStarCatalog::from_layers(layers).empty());
+}
+
+// =================================================================
+// Push constants vs ProjectionContext
+// =================================================================
+
+TEST_CASE("Shader cull with packed push constants matches ProjectionContext")
+{
+    core::JobSystem jobs(0);
+    catalog::MagnitudeFilter layers(8, jobs);
+    layers.build(random_stars(20000, 11));
+    const auto gpu = GpuStarCatalog::from_layers(layers);
+
+    const astro::ObserverLocation observer{
+        .latitude_rad = 28.76 * astro_constants::kDegToRad,
+        .longitude_rad = -17.89 * astro_constants::kDegToRad,
+    };
+
+    struct View
+    {
+        f64 alt_deg, az_deg, fov_deg, lst;
+        f32 mag_limit;
+    };
+    const View views[] = {
+        {45.0, 0.0, 60.0, 1.0, 6.5f},
+        {10.0, 250.0, 120.0, 4.2, 12.0f},
+        {80.0, 123.0, 5.0, 0.3, 12.0f},
+        {30.0, 90.0, 30.0, 5.9, 3.0f},
+    };
+
+    for (const auto& view : views)
+    {
+        Camera camera;
+        camera.set_pointing(view.alt_deg * astro_constants::kDegToRad, view.az_deg * astro_constants::kDegToRad);
+        camera.set_fov(view.fov_deg);
+
+        const ProjectionContext projection(
+            camera, astro::Coordinates::equatorial_to_horizontal_matrix(observer, view.lst));
+
+        // Reference: f64 projection of the same rows, magnitude cut applied first
+        u32 within = 0;
+        while (within < gpu.size() && gpu.direction_mag[within].w <= view.mag_limit)
+        {
+            ++within;
+        }
+        const auto pc = StarCullPushConstants::from_projection(projection, view.mag_limit, within);
+        CHECK(pc.star_count == within);
+
+        u32 reference_count = 0;
+        u32 shader_count = 0;
+        u32 disagreements = 0;
+        for (u32 i = 0; i < within; ++i)
+        {
+            const Vec4f& entry = gpu.direction_mag[i];
+            // Same f32 direction both sides: only the projection math differs
+            const Vec3d direction{Vec3f{entry}};
+
+            StarVertex vertex{};
+            const bool reference_visible =
+                projection.project(std::span<const f64>(&direction.x, 1), std::span<const f64>(&direction.y, 1),
+                                   std::span<const f64>(&direction.z, 1), std::span<StarVertex>(&vertex, 1)) == 1;
+
+            Vec2f screen{};
+            const bool shader_visible = shader_cull(pc, entry, screen);
+
+            reference_count += reference_visible ? 1 : 0;
+            shader_count += shader_visible ? 1 : 0;
+
+            if (reference_visible != shader_visible)
+            {
+                ++disagreements;   // f32 rounding at a cull boundary
+                continue;
+            }
+            if (reference_visible)
+            {
+                CHECK(std::abs(screen.x - vertex.screen_x) < 1e-4f);
+                CHECK(std::abs(screen.y - vertex.screen_y) < 1e-4f);
+            }
+        }
+
+        CHECK(reference_count > 0);
+        CHECK(disagreements <= 2);
+        MESSAGE("view alt " << view.alt_deg << ": " << shader_count << " / " << reference_count
+                            << " visible (shader / reference)");
+    }
+}
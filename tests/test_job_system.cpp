@@ -0,0 +1,262 @@
+/// @file test_job_system.cpp
+/// @brief Unit tests for parallax::core::JobSystem.
+///
+/// Verifies that every job runs exactly once, parallel_for covers its range
+/// without overlap, and dependency counters order job graphs.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "core/job_system.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::core;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static void increment(void* context)
+{
+    static_cast<std::atomic<u32>*>(context)->fetch_add(1);
+}
+
+/// Appends its tag to a shared log (records execution order)
+struct OrderedStep
+{
+    std::mutex* mutex;
+    std::vector<int>* log;
+    int tag;
+};
+
+static void record_step(void* context)
+{
+    const auto& step = *static_cast<const OrderedStep*>(context);
+    const std::lock_guard lock(*step.mutex);
+    step.log->push_back(step.tag);
+}
+
+// =================================================================
+// Submission
+// =================================================================
+
+TEST_CASE("Every submitted job runs exactly once")
+{
+    for (const u32 threads : {0u, 1u, 3u})
+    {
+        JobSystem jobs(threads);
+        CHECK(jobs.get_thread_count() == threads + 1);
+
+        std::atomic<u32> runs{0};
+        std::vector<Job> batch(1000, Job{.function = increment, .context = &runs});
+
+        JobCounter counter;
+        jobs.submit(batch, counter);
+        jobs.submit(Job{.function = increment, .context = &runs}, counter);
+        jobs.wait(counter);
+
+        CHECK(counter.is_done());
+        CHECK(runs.load() == 1001);
+    }
+}
+
+TEST_CASE("Without worker threads jobs run only inside wait()")
+{
+    JobSystem jobs(0);
+    REQUIRE(jobs.get_thread_count() == 1);
+
+    std::atomic<u32> runs{0};
+    JobCounter counter;
+    jobs.submit(Job{.function = increment, .context = &runs}, counter);
+    CHECK_FALSE(counter.is_done());
+    CHECK(runs.load() == 0);
+
+    jobs.wait(counter);
+    CHECK(runs.load() == 1);
+}
+
+TEST_CASE("Workers steal jobs queued by the owning thread")
+{
+    JobSystem jobs(3);
+
+    // Jobs block until several distinct threads have picked one up, which
+    // is only possible if workers steal from the owner's deque
+    std::mutex mutex;
+    std::set<std::thread::id> seen;
+    std::atomic<u32> started{0};
+
+    struct Context
+    {
+        std::mutex* mutex;
+        std::set<std::thread::id>* seen;
+        std::atomic<u32>* started;
+    } context{&mutex, &seen, &started};
+
+    std::vector<Job> batch(4, Job{
+        .function = [](void* data) {
+            auto& ctx = *static_cast<Context*>(data);
+            {
+                const std::lock_guard lock(*ctx.mutex);
+                ctx.seen->insert(std::this_thread::get_id());
+            }
+            ctx.started->fetch_add(1);
+            for (int spin = 0; spin < 2000 && ctx.started->load() < 4; ++spin)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        },
+        .context = &context,
+    });
+
+    JobCounter counter;
+    jobs.submit(batch, counter);
+    jobs.wait(counter);
+
+    CHECK(started.load() == 4);
+    CHECK(seen.size() > 1);
+}
+
+// =================================================================
+// parallel_for
+// =================================================================
+
+TEST_CASE("parallel_for covers [0, count) once, in disjoint ranges")
+{
+    for (const u32 threads : {1u, 4u})
+    {
+        JobSystem jobs(threads);
+
+        for (const u32 count : {0u, 1u, 7u, 1000u, 100003u})
+        {
+            std::vector<u32> hits(count, 0);
+            std::atomic<u32> calls{0};
+
+            jobs.parallel_for(count, 64, [&](u32 begin, u32 end) {
+                calls.fetch_add(1);
+                for (u32 i = begin; i < end; ++i)
+                {
+                    ++hits[i];
+                }
+            });
+
+            CHECK(std::all_of(hits.begin(), hits.end(), [](u32 h) { return h == 1; }));
+            CHECK(calls.load() <= jobs.get_thread_count() * 4);
+        }
+    }
+}
+
+TEST_CASE("parallel_for with per-range outputs gives a scheduling-independent result")
+{
+    JobSystem jobs(4);
+    const u32 count = 50000;
+
+    // Each range writes its own slots; the merged result must equal the
+    // sequential one regardless of which thread ran which range
+    std::vector<u64> out(count);
+    jobs.parallel_for(count, 128, [&](u32 begin, u32 end) {
+        for (u32 i = begin; i < end; ++i)
+        {
+            out[i] = static_cast<u64>(i) * i;
+        }
+    });
+
+    u64 expected = 0;
+    for (u32 i = 0; i < count; ++i)
+    {
+        expected += static_cast<u64>(i) * i;
+    }
+    CHECK(std::accumulate(out.begin(), out.end(), u64{0}) == expected);
+}
+
+TEST_CASE("Nested parallel_for inside a job does not deadlock")
+{
+    JobSystem jobs(2);
+    std::atomic<u32> total{0};
+
+    jobs.parallel_for(8, 1, [&](u32 begin, u32 end) {
+        for (u32 i = begin; i < end; ++i)
+        {
+            jobs.parallel_for(100, 10, [&](u32 b, u32 e) { total.fetch_add(e - b); });
+        }
+    });
+
+    CHECK(total.load() == 800);
+}
+
+// =================================================================
+// Dependency counters
+// =================================================================
+
+TEST_CASE("submit_after runs a job only once its dependency is done")
+{
+    for (const u32 threads : {1u, 3u})
+    {
+        JobSystem jobs(threads);
+
+        std::mutex mutex;
+        std::vector<int> log;
+        std::vector<OrderedStep> first(16);
+        std::vector<Job> first_jobs(16);
+        for (int i = 0; i < 16; ++i)
+        {
+            first[i] = OrderedStep{.mutex = &mutex, .log = &log, .tag = 1};
+            first_jobs[i] = Job{.function = record_step, .context = &first[i]};
+        }
+        OrderedStep second{.mutex = &mutex, .log = &log, .tag = 2};
+        OrderedStep third{.mutex = &mutex, .log = &log, .tag = 3};
+
+        JobCounter stage1;
+        JobCounter stage2;
+        JobCounter done;
+
+        // stage 1 (16 jobs) → second → third; stage2 is counted as soon as
+        // `second` is registered, so `third` is held back too
+        jobs.submit(first_jobs, stage1);
+        jobs.submit_after(stage1, Job{.function = record_step, .context = &second}, stage2);
+        jobs.submit_after(stage2, Job{.function = record_step, .context = &third}, done);
+
+        jobs.wait(done);
+        jobs.wait(stage2);
+
+        REQUIRE(log.size() == 18);
+        CHECK(std::all_of(log.begin(), log.begin() + 16, [](int tag) { return tag == 1; }));
+        CHECK(log[16] == 2);
+        CHECK(log[17] == 3);
+    }
+}
+
+TEST_CASE("submit_after on a finished counter runs immediately")
+{
+    JobSystem jobs(2);
+    std::atomic<u32> runs{0};
+
+    JobCounter idle;
+    JobCounter counter;
+    jobs.submit_after(idle, Job{.function = increment, .context = &runs}, counter);
+    jobs.wait(counter);
+
+    CHECK(runs.load() == 1);
+}
@@ -0,0 +1,319 @@
+/// @file test_jpl_ephemeris.cpp
+/// @brief Unit tests for astro::JplEphemeris against tests/data/de_sample.bin.
+///
+/// The sample (written by tools/de_sample_generator) has the DE440 record
+/// layout, four 32-day records from JD 2451536.5, and every series holds a
+/// known cubic, so positions (1 mm) and velocities (1 mm/day) are checked
+/// across records and sub-intervals.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "astro/jpl_ephemeris.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::astro;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static const std::filesystem::path kSamplePath = std::filesystem::path(PLX_TEST_DATA_DIR) / "de_sample.bin";
+static constexpr f64 kStartJd = 2451536.5;
+static constexpr f64 kEndJd = kStartJd + 4 * 32.0;
+static constexpr f64 kAuKm = 149597870.7;
+static constexpr f64 kEarthMoonRatio = 81.30056822149722;
+static constexpr std::size_t kRecordBytes = 1018 * sizeof(f64);
+
+/// The generator's cubic (km), and its derivative (km/day)
+static Vec3d sample_position(DeSeries series, f64 jd)
+{
+    const f64 tau = (jd - 2451600.5) / 64.0;
+    const auto s = static_cast<f64>(series);
+    Vec3d p{};
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        p[axis] = 1.0e5 * (s + 1.0) + 1.0e4 * axis + 3000.0 * tau - 200.0 * (axis + 1) * tau * tau
+                + 50.0 * tau * tau * tau;
+    }
+    return p;
+}
+
+static Vec3d sample_velocity(DeSeries series, f64 jd)
+{
+    (void)series;
+    const f64 tau = (jd - 2451600.5) / 64.0;
+    Vec3d v{};
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        v[axis] = (3000.0 - 400.0 * (axis + 1) * tau + 150.0 * tau * tau) / 64.0;
+    }
+    return v;
+}
+
+static std::vector<char> read_sample()
+{
+    std::ifstream in(kSamplePath, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), {});
+}
+
+static std::filesystem::path write_temp(const char* name, const std::vector<char>& bytes)
+{
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    return path;
+}
+
+// =================================================================
+// Header
+// =================================================================
+
+TEST_CASE("Sample header is parsed")
+{
+    JplEphemeris de(kSamplePath);
+    REQUIRE(de.is_open());
+    CHECK(de.get_de_number() == 440);
+    CHECK(de.get_start_jd() == kStartJd);
+    CHECK(de.get_end_jd() == kEndJd);
+    CHECK(de.get_record_days() == 32.0);
+    CHECK(de.get_record_count() == 4);
+    CHECK(de.get_au_km() == kAuKm);
+    CHECK(de.get_earth_moon_ratio() == kEarthMoonRatio);
+}
+
+TEST_CASE("Missing, truncated and corrupt files are rejected")
+{
+    CHECK_FALSE(JplEphemeris(std::filesystem::temp_directory_path() / "plx_no_such_de.bin").is_open());
+
+    std::vector<char> bytes = read_sample();
+    REQUIRE(bytes.size() == 6 * kRecordBytes);
+
+    // Last record cut off
+    std::vector<char> truncated(bytes.begin(), bytes.end() - 100);
+    const auto truncated_path = write_temp("plx_de_truncated.bin", truncated);
+    CHECK_FALSE(JplEphemeris(truncated_path).is_open());
+    std::filesystem::remove(truncated_path);
+
+    // Wrong first-record span (a record length mismatch looks like this)
+    std::vector<char> shifted = bytes;
+    const f64 wrong = 0.0;
+    std::memcpy(shifted.data() + 2 * kRecordBytes, &wrong, sizeof(wrong));
+    const auto shifted_path = write_temp("plx_de_shifted.bin", shifted);
+    CHECK_FALSE(JplEphemeris(shifted_path).is_open());
+    std::filesystem::remove(shifted_path);
+
+    // Byte-swapped DE number reads as a big-endian file
+    std::vector<char> swapped = bytes;
+    std::swap(swapped[2840], swapped[2843]);
+    std::swap(swapped[2841], swapped[2842]);
+    const auto swapped_path = write_temp("plx_de_swapped.bin", swapped);
+    CHECK_FALSE(JplEphemeris(swapped_path).is_open());
+    std::filesystem::remove(swapped_path);
+}
+
+TEST_CASE("Coefficient pointers past the record are rejected")
+{
+    const std::vector<char> bytes = read_sample();
+
+    // Mercury's pointer (offset, coefficients, sub-intervals) at 2696
+    const auto with_mercury = [&](i32 start, i32 count, i32 subintervals) {
+        std::vector<char> patched = bytes;
+        const i32 fields[3] = {start, count, subintervals};
+        std::memcpy(patched.data() + 2696, fields, sizeof(fields));
+        return patched;
+    };
+
+    SUBCASE("Size product wraps around 32 bits")
+    {
+        // 8 × 3 × 2^29 = 3 · 2^32: a u32 end would land back on the offset
+        const auto path = write_temp("plx_de_wrapped.bin", with_mercury(3, 8, 1 << 29));
+        CHECK_FALSE(JplEphemeris(path).is_open());
+        std::filesystem::remove(path);
+    }
+    SUBCASE("Series ends beyond what the file can hold")
+    {
+        const auto path = write_temp("plx_de_overrun.bin", with_mercury(3, 14, 1 << 20));
+        CHECK_FALSE(JplEphemeris(path).is_open());
+        std::filesystem::remove(path);
+    }
+}
+
+TEST_CASE("A corrupt record fails its queries, not the file")
+{
+    std::vector<char> bytes = read_sample();
+    const f64 wrong = 1.0;
+    std::memcpy(bytes.data() + 4 * kRecordBytes, &wrong, sizeof(wrong));    // Record 2's start JD
+    const auto path = write_temp("plx_de_bad_record.bin", bytes);
+
+    {
+        JplEphemeris de(path);
+        REQUIRE(de.is_open());
+        CHECK(de.get_series(DeSeries::Mars, kStartJd + 10.0).has_value());
+        CHECK_FALSE(de.get_series(DeSeries::Mars, kStartJd + 70.0).has_value());
+    }
+    std::filesystem::remove(path);
+}
+
+// =================================================================
+// Evaluation
+// =================================================================
+
+TEST_CASE("Every series evaluates to the generator's cubic across records and sub-intervals")
+{
+    JplEphemeris de(kSamplePath);
+    REQUIRE(de.is_open());
+
+    for (u32 s = 0; s < static_cast<u32>(DeSeries::Count); ++s)
+    {
+        const auto series = static_cast<DeSeries>(s);
+        // Step of 0.37 days hits all 8 Moon sub-intervals of every record
+        for (f64 jd = kStartJd; jd <= kEndJd; jd += 0.37)
+        {
+            const auto state = de.get_series(series, jd);
+            REQUIRE(state.has_value());
+            CHECK(glm::length(state->position - sample_position(series, jd)) < 1e-6);
+            CHECK(glm::length(state->velocity - sample_velocity(series, jd)) < 1e-6);
+        }
+    }
+}
+
+TEST_CASE("Record and span boundaries")
+{
+    JplEphemeris de(kSamplePath);
+    REQUIRE(de.is_open());
+
+    for (const f64 jd : {kStartJd, kStartJd + 32.0, kStartJd + 64.0, kEndJd})
+    {
+        const auto state = de.get_series(DeSeries::Moon, jd);
+        REQUIRE(state.has_value());
+        CHECK(glm::length(state->position - sample_position(DeSeries::Moon, jd)) < 1e-6);
+    }
+
+    CHECK_FALSE(de.get_series(DeSeries::Sun, kStartJd - 1e-6).has_value());
+    CHECK_FALSE(de.get_series(DeSeries::Sun, kEndJd + 1e-6).has_value());
+    CHECK_FALSE(de.get_geocentric(Body::Mars, kEndJd + 1.0).has_value());
+}
+
+TEST_CASE("Bodies: Earth from the barycentre and the Moon, results in AU")
+{
+    JplEphemeris de(kSamplePath);
+    REQUIRE(de.is_open());
+    const f64 jd = kStartJd + 50.25;
+
+    const Vec3d emb = sample_position(DeSeries::EarthMoonBarycenter, jd);
+    const Vec3d moon = sample_position(DeSeries::Moon, jd);
+    const Vec3d earth = emb - moon / (1.0 + kEarthMoonRatio);
+
+    const auto earth_state = de.get_barycentric(Body::Earth, jd);
+    REQUIRE(earth_state.has_value());
+    CHECK(glm::length(earth_state->position * kAuKm - earth) < 1e-6);
+
+    const auto moon_geo = de.get_geocentric(Body::Moon, jd);
+    REQUIRE(moon_geo.has_value());
+    CHECK(glm::length(moon_geo->position * kAuKm - moon) < 1e-6);
+
+    const auto moon_bary = de.get_barycentric(Body::Moon, jd);
+    REQUIRE(moon_bary.has_value());
+    CHECK(glm::length(moon_bary->position * kAuKm - (earth + moon)) < 1e-6);
+
+    const auto mars = de.get_geocentric(Body::Mars, jd);
+    REQUIRE(mars.has_value());
+    CHECK(glm::length(mars->position * kAuKm - (sample_position(DeSeries::Mars, jd) - earth)) < 1e-6);
+
+    const auto sun = de.get_geocentric(Body::Sun, jd);
+    REQUIRE(sun.has_value());
+    CHECK(glm::length(sun->position * kAuKm - (sample_position(DeSeries::Sun, jd) - earth)) < 1e-6);
+    const Vec3d sun_velocity = sample_velocity(DeSeries::Sun, jd)
+        - (sample_velocity(DeSeries::EarthMoonBarycenter, jd) - sample_velocity(DeSeries::Moon, jd) / (1.0 + kEarthMoonRatio));
+    CHECK(glm::length(sun->velocity * kAuKm - sun_velocity) < 1e-6);
+
+    const auto earth_geo = de.get_geocentric(Body::Earth, jd);
+    REQUIRE(earth_geo.has_value());
+    CHECK(glm::length(earth_geo->position) == 0.0);
+}
+
+// =================================================================
+// Record cache
+// =================================================================
+
+TEST_CASE("LRU keeps the most recently used records")
+{
+    JplEphemeris de(kSamplePath, 2);
+    REQUIRE(de.is_open());
+
+    const auto query = [&de](u32 record) {
+        REQUIRE(de.get_series(DeSeries::Venus, kStartJd + record * 32.0 + 5.0).has_value());
+    };
+
+    query(0);   // miss
+    query(0);   // hit
+    query(1);   // miss
+    query(0);   // hit (record 1 is now least recent)
+    query(2);   // miss, evicts 1
+    query(0);   // hit
+    query(1);   // miss, evicts 2
+
+    const DeCacheStats stats = de.get_cache_stats();
+    CHECK(stats.hits == 3);
+    CHECK(stats.misses == 4);
+}
+
+TEST_CASE("Concurrent queries agree with serial ones")
+{
+    JplEphemeris de(kSamplePath, 2);
+    REQUIRE(de.is_open());
+
+    constexpr u32 kThreads = 4;
+    constexpr u32 kQueries = 2000;
+    std::atomic<u32> mismatches{0};
+
+    std::vector<std::thread> threads;
+    for (u32 t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (u32 i = 0; i < kQueries; ++i)
+            {
+                // Threads walk the file at different strides so the LRU churns
+                const f64 jd = kStartJd + std::fmod(static_cast<f64>(i * (t + 1)) * 0.731, kEndJd - kStartJd);
+                const auto series = static_cast<DeSeries>((i + t) % static_cast<u32>(DeSeries::Count));
+                const auto state = de.get_series(series, jd);
+                if (!state || glm::length(state->position - sample_position(series, jd)) > 1e-6)
+                {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(mismatches.load() == 0);
+    const DeCacheStats stats = de.get_cache_stats();
+    CHECK(stats.hits + stats.misses == kThreads * kQueries);
+}
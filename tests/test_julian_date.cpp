@@ -0,0 +1,130 @@
+/// @file test_julian_date.cpp
+/// @brief Unit tests for parallax::astro::JulianDate.
+///
+/// Verifies normalization, exact accumulation of frame steps (against the
+/// drift of a plain f64 JD), differences, ordering and two-part input.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "astro/julian_date.hpp"
+#include "core/types.hpp"
+
+#include <cmath>
+
+using namespace parallax;
+using namespace parallax::astro;
+
+// =================================================================
+// Construction and normalization
+// =================================================================
+
+TEST_CASE("Seconds are normalized into [0, 86400) with the day carried")
+{
+    const JulianDate a(2451545, 90000.0);
+    CHECK(a.get_day() == 2451546);
+    CHECK(a.get_seconds() == 3600.0);
+
+    const JulianDate b(2451545, -1.0);
+    CHECK(b.get_day() == 2451544);
+    CHECK(b.get_seconds() == 86399.0);
+
+    const JulianDate c(2451545, -3.0 * 86400.0);
+    CHECK(c.get_day() == 2451542);
+    CHECK(c.get_seconds() == 0.0);
+
+    // A tiny negative rounds to a full day; it must land on the next day's 0
+    const JulianDate d(2451545, -1e-30);
+    CHECK(d.get_seconds() >= 0.0);
+    CHECK(d.get_seconds() < JulianDate::kSecondsPerDay);
+}
+
+TEST_CASE("Plain and two-part JDs convert without losing the fraction")
+{
+    const JulianDate j2000(2451545.0);
+    CHECK(j2000.get_day() == 2451545);
+    CHECK(j2000.get_seconds() == 0.0);
+    CHECK(j2000.days_since_j2000() == 0.0);
+
+    const JulianDate half(2451545.25);
+    CHECK(half.get_seconds() == 21600.0);
+    CHECK(half.get_jd() == 2451545.25);
+
+    // The small part keeps a precision a plain JD cannot hold
+    const JulianDate split = JulianDate::from_parts(2451545.0, 1e-9);
+    CHECK(split.get_day() == 2451545);
+    CHECK(std::abs(split.get_seconds() - 1e-9 * 86400.0) < 1e-15);
+    CHECK(std::abs(JulianDate(2451545.0 + 1e-9).get_seconds() - 1e-9 * 86400.0) > 1e-6);
+
+    // MJD-style split
+    const JulianDate mjd = JulianDate::from_parts(2400000.5, 51544.5);
+    CHECK(mjd == j2000);
+
+    // Parts with fractions on both sides
+    const JulianDate mixed = JulianDate::from_parts(2451544.75, 0.5);
+    CHECK(mixed.get_day() == 2451545);
+    CHECK(mixed.get_seconds() == 21600.0);
+}
+
+// =================================================================
+// Arithmetic
+// =================================================================
+
+TEST_CASE("Frame steps accumulate exactly where a plain JD drifts")
+{
+    // One hour of 60 Hz frames in 1/64 s steps (binary-exact)
+    constexpr i32 kFrames = 60 * 3600;
+    constexpr f64 kStep = 1.0 / 64.0;
+
+    JulianDate split(2460000.5);
+    f64 plain = 2460000.5;
+    for (i32 i = 0; i < kFrames; ++i)
+    {
+        split += kStep;
+        plain += kStep / 86400.0;
+    }
+
+    const JulianDate start(2460000.5);
+    CHECK((split - start) == kFrames * kStep);      // Exact
+
+    // The plain f64 accumulation is off by milliseconds already
+    const f64 plain_error_sec = std::abs((plain - 2460000.5) * 86400.0 - kFrames * kStep);
+    CHECK(plain_error_sec > 1e-4);
+}
+
+TEST_CASE("Arbitrary steps stay within picoseconds over a long session")
+{
+    // 10^6 steps of 1/60 s (not binary-exact): error bounded by counter rounding
+    JulianDate date(2460000.5);
+    const JulianDate start = date;
+    constexpr i32 kSteps = 1000000;
+    for (i32 i = 0; i < kSteps; ++i)
+    {
+        date += 1.0 / 60.0;
+    }
+    CHECK(std::abs((date - start) - kSteps / 60.0) < 1e-5);
+    CHECK(date.get_day() == 2460000 + static_cast<i64>((0.5 * 86400.0 + kSteps / 60.0) / 86400.0));
+}
+
+TEST_CASE("Addition, subtraction and ordering")
+{
+    const JulianDate a(2451545, 100.0);
+    const JulianDate b = a + 86400.0 * 2.5;
+    CHECK(b.get_day() == 2451547);
+    CHECK(b.get_seconds() == 43300.0);
+    CHECK((b - a) == 86400.0 * 2.5);
+    CHECK((a - b) == -86400.0 * 2.5);
+
+    const JulianDate c = b - 86400.0 * 2.5;
+    CHECK(c == a);
+
+    CHECK(a < b);
+    CHECK(b > a);
+    CHECK((a + 1e-6) > a);
+    CHECK(JulianDate(2451545, 86399.0) < JulianDate(2451546, 0.0));
+
+    JulianDate d = a;
+    d -= 200.0;
+    CHECK(d.get_day() == 2451544);
+    CHECK(d.get_seconds() == 86300.0);
+}
@@ -0,0 +1,385 @@
+/// @file test_magnitude_filter.cpp
+/// @brief Unit tests for parallax::catalog::MagnitudeFilter.
+///
+/// Verifies layer assignment at the layer boundaries, active layer selection
+/// for a limiting magnitude, that a pixel scan over the active layers
+/// returns exactly the stars brighter than the limit, and that mapped layers
+/// load on a job and are not reloaded by a limit hovering at a boundary.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "catalog/catalog_manager.hpp"
+#include "catalog/magnitude_filter.hpp"
+#include "catalog/plxcat_format.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/job_system.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::catalog;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static std::vector<StarEntry> make_random_stars(u32 count)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<f64> ra_dist(0.0, astro_constants::kTwoPi);
+    std::uniform_real_distribution<f64> z_dist(-1.0, 1.0);
+    std::uniform_real_distribution<f32> mag_dist(-1.5f, 22.0f);
+
+    std::vector<StarEntry> stars;
+    for (u32 i = 0; i < count; ++i)
+    {
+        stars.push_back(StarEntry{.ra = ra_dist(rng), .dec = std::asin(z_dist(rng)),
+                                  .mag_v = mag_dist(rng), .color_bv = 0.6f, .catalog_id = i});
+    }
+    return stars;
+}
+
+/// @brief Write stars as a .plxcat (pixel-sorted, brightest first), removed on destruction.
+class TempPlxcatFile
+{
+public:
+    TempPlxcatFile(const std::string& filename, u32 nside, const std::vector<StarEntry>& stars)
+        : m_path(std::filesystem::temp_directory_path() / filename)
+    {
+        const SpatialIndex grid(nside);
+        std::vector<std::vector<PackedStarEntry>> pixels(grid.get_pixel_count());
+        for (const auto& star : stars)
+        {
+            pixels[grid.ang2pix(star.ra, star.dec)].push_back(pack_star(star));
+        }
+
+        const CatalogHeader header = make_catalog_header(stars.size(), nside);
+        std::vector<HEALPixIndexEntry> index(header.healpix_count, HEALPixIndexEntry{});
+        std::vector<PackedStarEntry> data;
+        for (std::size_t pix = 0; pix < pixels.size(); ++pix)
+        {
+            std::stable_sort(pixels[pix].begin(), pixels[pix].end(),
+                             [](const PackedStarEntry& a, const PackedStarEntry& b) { return a.mag_v < b.mag_v; });
+            index[pix].offset = data.size() * sizeof(PackedStarEntry);
+            index[pix].count = static_cast<u32>(pixels[pix].size());
+            data.insert(data.end(), pixels[pix].begin(), pixels[pix].end());
+        }
+
+        std::ofstream file(m_path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(index.data()),
+                   static_cast<std::streamsize>(index.size() * sizeof(HEALPixIndexEntry)));
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size() * sizeof(PackedStarEntry)));
+    }
+
+    ~TempPlxcatFile()
+    {
+        std::filesystem::remove(m_path);
+    }
+
+    [[nodiscard]] const std::filesystem::path& path() const { return m_path; }
+
+    TempPlxcatFile(const TempPlxcatFile&) = delete;
+    TempPlxcatFile& operator=(const TempPlxcatFile&) = delete;
+
+private:
+    std::filesystem::path m_path;
+};
+
+// =================================================================
+// Layer selection
+// =================================================================
+
+TEST_CASE("Stars fall into the documented layers")
+{
+    CHECK(MagnitudeFilter::layer_for_magnitude(-1.46f) == 0);
+    CHECK(MagnitudeFilter::layer_for_magnitude(1.99f) == 0);
+    CHECK(MagnitudeFilter::layer_for_magnitude(2.0f) == 1);
+    CHECK(MagnitudeFilter::layer_for_magnitude(6.49f) == 2);
+    CHECK(MagnitudeFilter::layer_for_magnitude(6.5f) == 3);
+    CHECK(MagnitudeFilter::layer_for_magnitude(13.9f) == 4);
+    CHECK(MagnitudeFilter::layer_for_magnitude(20.9f) == 6);
+    CHECK(MagnitudeFilter::layer_for_magnitude(25.0f) == 6);   // last layer is open-ended
+}
+
+TEST_CASE("Active layer count follows the limiting magnitude")
+{
+    CHECK(MagnitudeFilter::active_layer_count(1.0f) == 1);
+    CHECK(MagnitudeFilter::active_layer_count(6.5f) == 4);   // 6.5 itself lives in layer 3
+    CHECK(MagnitudeFilter::active_layer_count(6.0f) == 3);
+    CHECK(MagnitudeFilter::active_layer_count(14.0f) == 6);
+    CHECK(MagnitudeFilter::active_layer_count(30.0f) == MagnitudeFilter::kLayerCount);
+}
+
+// =================================================================
+// Build + scan
+// =================================================================
+
+TEST_CASE("Scanning active layers yields exactly the stars within the limit")
+{
+    const std::vector<StarEntry> stars = make_random_stars(20000);
+
+    const f32 mag_limit = 9.0f;
+    std::size_t expected = 0;
+    for (const auto& s : stars)
+    {
+        expected += (s.mag_v <= mag_limit) ? 1 : 0;
+    }
+
+    core::JobSystem jobs(0);
+    MagnitudeFilter filter(8, jobs);
+    filter.build(stars);
+    CHECK(filter.get_star_count() == stars.size());
+
+    for (u32 layer = 0; layer < MagnitudeFilter::kLayerCount; ++layer)
+    {
+        for (const f32 mag : filter.get_layer(layer).get_stars().get_mag_v())
+        {
+            REQUIRE(MagnitudeFilter::layer_for_magnitude(mag) == layer);
+        }
+    }
+
+    // Whole-sky query, scanning the way Starfield does
+    std::vector<u32> pixels;
+    filter.query_disc(0.0, 0.0, astro_constants::kPi, pixels);
+
+    std::size_t found = 0;
+    std::size_t visited = 0;
+    for (u32 layer = 0; layer < MagnitudeFilter::active_layer_count(mag_limit); ++layer)
+    {
+        const auto mag = filter.get_layer(layer).get_stars().get_mag_v();
+        for (const u32 pixel : pixels)
+        {
+            const auto bucket = filter.get_layer(layer).pixel_range(pixel);
+            for (u32 i = bucket.begin; i < bucket.end; ++i)
+            {
+                ++visited;
+                if (mag[i] > mag_limit)
+                {
+                    break;
+                }
+                ++found;
+            }
+        }
+    }
+
+    CHECK(found == expected);
+    // At most one rejected star per (active layer, pixel) pair is visited
+    CHECK(visited <= found + pixels.size() * MagnitudeFilter::active_layer_count(mag_limit));
+}
+
+TEST_CASE("Building from a mapped .plxcat matches building from the star list")
+{
+    // Magnitudes on 1e-3 steps so packing does not move a star across a layer bound
+    std::vector<StarEntry> stars = make_random_stars(5000);
+    for (auto& star : stars)
+    {
+        star.mag_v = decode_magnitude(encode_magnitude(star.mag_v));
+    }
+
+    // File nside differs from the filter's: layers are re-bucketed either way
+    const TempPlxcatFile plxcat("test_magnitude_filter.plxcat", 4, stars);
+    CatalogManager manager;
+    REQUIRE(manager.load(plxcat.path()).has_value());
+
+    core::JobSystem jobs(2);
+    MagnitudeFilter from_list(8, jobs);
+    from_list.build(stars);
+    MagnitudeFilter from_mapping(8, jobs);
+    from_mapping.build(manager);
+    from_mapping.set_magnitude_limit(30.0f);
+    from_mapping.wait_for_loads();
+
+    CHECK(from_mapping.get_star_count() == stars.size());
+    for (u32 layer = 0; layer < MagnitudeFilter::kLayerCount; ++layer)
+    {
+        const auto& expected = from_list.get_layer(layer);
+        const auto& actual = from_mapping.get_layer(layer);
+        REQUIRE(actual.get_stars().size() == expected.get_stars().size());
+
+        for (u32 pixel = 0; pixel < actual.get_pixel_count(); ++pixel)
+        {
+            const auto bucket = actual.pixel_range(pixel);
+            REQUIRE(bucket.size() == expected.pixel_range(pixel).size());
+
+            // Same star set per pixel (ties in magnitude may order differently)
+            std::vector<u32> a(actual.get_stars().get_catalog_id().begin() + bucket.begin,
+                               actual.get_stars().get_catalog_id().begin() + bucket.end);
+            const auto expected_bucket = expected.pixel_range(pixel);
+            std::vector<u32> e(expected.get_stars().get_catalog_id().begin() + expected_bucket.begin,
+                               expected.get_stars().get_catalog_id().begin() + expected_bucket.end);
+            std::sort(a.begin(), a.end());
+            std::sort(e.begin(), e.end());
+            CHECK(a == e);
+        }
+    }
+}
+
+TEST_CASE("Mapped layers are resident only while the limit reaches them")
+{
+    std::vector<StarEntry> stars = make_random_stars(5000);
+    for (auto& star : stars)
+    {
+        star.mag_v = decode_magnitude(encode_magnitude(star.mag_v));
+    }
+
+    const TempPlxcatFile plxcat("test_magnitude_residency.plxcat", 8, stars);
+    CatalogManager manager;
+    REQUIRE(manager.load(plxcat.path()).has_value());
+
+    core::JobSystem jobs(2);
+    MagnitudeFilter filter(8, jobs);
+    filter.build(manager);
+    CHECK(filter.get_star_count() == stars.size());
+
+    const auto expected_size = [&](u32 layer) {
+        return static_cast<std::size_t>(std::count_if(stars.begin(), stars.end(), [&](const StarEntry& s) {
+            return MagnitudeFilter::layer_for_magnitude(s.mag_v) == layer;
+        }));
+    };
+    const auto check_residency = [&](f32 mag_limit) {
+        const u32 active = MagnitudeFilter::active_layer_count(mag_limit);
+        for (u32 layer = 0; layer < MagnitudeFilter::kLayerCount; ++layer)
+        {
+            CAPTURE(layer);
+            CHECK(filter.is_resident(layer) == (layer < active));
+            CHECK(filter.get_layer(layer).get_stars().size() == (layer < active ? expected_size(layer) : 0));
+        }
+    };
+
+    // Nothing is loaded until a limit is set
+    for (u32 layer = 0; layer < MagnitudeFilter::kLayerCount; ++layer)
+    {
+        CHECK_FALSE(filter.is_resident(layer));
+        CHECK(filter.get_layer(layer).get_stars().empty());
+    }
+
+    // 3.0 is below layers 2+ by more than the release margin
+    filter.set_magnitude_limit(5.0f);
+    filter.wait_for_loads();
+    check_residency(5.0f);
+
+    filter.set_magnitude_limit(15.0f);
+    filter.wait_for_loads();
+    check_residency(15.0f);
+
+    filter.set_magnitude_limit(3.0f);
+    filter.wait_for_loads();
+    check_residency(3.0f);
+
+    SUBCASE("Visiting every layer leaves residency unchanged")
+    {
+        std::size_t visited = 0;
+        filter.visit_all_layers([&](u32 layer, const SpatialIndex& index) {
+            CHECK(index.get_stars().size() == expected_size(layer));
+            visited += index.get_stars().size();
+        });
+        CHECK(visited == stars.size());
+        check_residency(3.0f);
+    }
+}
+
+TEST_CASE("Mapped layers load on a job and land on a later call")
+{
+    std::vector<StarEntry> stars = make_random_stars(20000);
+    const TempPlxcatFile plxcat("test_magnitude_async.plxcat", 8, stars);
+    CatalogManager manager;
+    REQUIRE(manager.load(plxcat.path()).has_value());
+
+    core::JobSystem jobs(2);
+    MagnitudeFilter filter(8, jobs);
+    filter.build(manager);
+
+    // The call that starts the load returns with the layers still empty
+    filter.set_magnitude_limit(15.0f);
+    const u32 active = MagnitudeFilter::active_layer_count(15.0f);
+    for (u32 layer = 0; layer < active; ++layer)
+    {
+        CHECK_FALSE(filter.is_resident(layer));
+        CHECK(filter.get_layer(layer).get_stars().empty());
+    }
+
+    // Later frames pick the finished job up without waiting for it
+    for (int frame = 0; frame < 10000 && !filter.is_resident(0); ++frame)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        filter.set_magnitude_limit(15.0f);
+    }
+    for (u32 layer = 0; layer < active; ++layer)
+    {
+        CHECK(filter.is_resident(layer));
+    }
+    CHECK(filter.get_layer_load_count() == active);
+}
+
+TEST_CASE("A limit moving back and forth across a boundary loads the layer once")
+{
+    std::vector<StarEntry> stars = make_random_stars(5000);
+    const TempPlxcatFile plxcat("test_magnitude_hysteresis.plxcat", 8, stars);
+    CatalogManager manager;
+    REQUIRE(manager.load(plxcat.path()).has_value());
+
+    core::JobSystem jobs(2);
+    MagnitudeFilter filter(8, jobs);
+    filter.build(manager);
+
+    const auto set_limit = [&](f32 mag_limit) {
+        filter.set_magnitude_limit(mag_limit);
+        filter.wait_for_loads();
+    };
+
+    // Layer 3 starts at 6.5: zooming across it keeps it once loaded
+    for (int i = 0; i < 20; ++i)
+    {
+        set_limit(6.6f);
+        set_limit(6.4f);
+    }
+    CHECK(filter.is_resident(3));
+    CHECK(filter.get_layer_load_count() == 4);   // layers 0-3, once each
+
+    // More than the margin below: freed, and loaded once more on return
+    set_limit(6.5f - MagnitudeFilter::kReleaseMargin - 0.1f);
+    CHECK_FALSE(filter.is_resident(3));
+    CHECK(filter.get_layer(3).get_stars().empty());
+
+    set_limit(6.6f);
+    CHECK(filter.is_resident(3));
+    CHECK(filter.get_layer_load_count() == 5);
+}
+
+TEST_CASE("Layers built from a star list stay resident")
+{
+    core::JobSystem jobs(0);
+    MagnitudeFilter filter(8, jobs);
+    filter.build(make_random_stars(1000));
+    filter.set_magnitude_limit(1.0f);
+
+    for (u32 layer = 0; layer < MagnitudeFilter::kLayerCount; ++layer)
+    {
+        CHECK(filter.is_resident(layer));
+    }
+    CHECK(filter.get_star_count() == 1000);
+}
@@ -0,0 +1,190 @@
+/// @file test_pipeline_cache_file.cpp
+/// @brief Unit tests for the on-disk pipeline cache (naming, header validation, atomic save).
+///
+/// The Vulkan blob is synthesized with a VkPipelineCacheHeaderVersionOne
+/// layout, so no device is needed: a cache must only be accepted by the
+/// vendor, device and pipelineCacheUUID it was written for.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "core/logger.hpp"
+#include "core/types.hpp"
+#include "vulkan/pipeline_cache_file.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::vulkan;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static PipelineCacheKey test_key()
+{
+    PipelineCacheKey key{.vendor_id = 0x10DE, .device_id = 0x2684};
+    for (std::size_t i = 0; i < key.uuid.size(); ++i)
+    {
+        key.uuid[i] = static_cast<u8>(0xA0 + i);
+    }
+    return key;
+}
+
+static void put_u32(std::vector<std::byte>& out, std::size_t offset, u32 value)
+{
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        out[offset + i] = static_cast<std::byte>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+/// What vkGetPipelineCacheData returns: 32-byte header, then driver data.
+static std::vector<std::byte> vk_blob(const PipelineCacheKey& key, std::size_t payload_bytes)
+{
+    std::vector<std::byte> blob(32 + payload_bytes);
+    put_u32(blob, 0, 32);
+    put_u32(blob, 4, 1);
+    put_u32(blob, 8, key.vendor_id);
+    put_u32(blob, 12, key.device_id);
+    for (std::size_t i = 0; i < key.uuid.size(); ++i)
+    {
+        blob[16 + i] = static_cast<std::byte>(key.uuid[i]);
+    }
+    for (std::size_t i = 0; i < payload_bytes; ++i)
+    {
+        blob[32 + i] = static_cast<std::byte>(i * 7);
+    }
+    return blob;
+}
+
+static std::filesystem::path temp_dir()
+{
+    const auto dir = std::filesystem::temp_directory_path() / "plx_pipeline_cache_test";
+    std::filesystem::remove_all(dir);
+    return dir;
+}
+
+// =================================================================
+// Header validation
+// =================================================================
+
+TEST_CASE("Header matches only its own device")
+{
+    const auto key = test_key();
+    const auto blob = vk_blob(key, 64);
+    CHECK(pipeline_cache_matches(blob, key));
+
+    auto other_vendor = key;
+    other_vendor.vendor_id = 0x1002;
+    CHECK_FALSE(pipeline_cache_matches(blob, other_vendor));
+
+    auto other_device = key;
+    other_device.device_id += 1;
+    CHECK_FALSE(pipeline_cache_matches(blob, other_device));
+
+    // A driver update changes the UUID
+    auto other_driver = key;
+    other_driver.uuid[15] ^= 1;
+    CHECK_FALSE(pipeline_cache_matches(blob, other_driver));
+}
+
+TEST_CASE("Malformed headers are rejected")
+{
+    const auto key = test_key();
+
+    auto truncated = vk_blob(key, 0);
+    truncated.resize(31);
+    CHECK_FALSE(pipeline_cache_matches(truncated, key));
+
+    auto bad_version = vk_blob(key, 16);
+    put_u32(bad_version, 4, 2);
+    CHECK_FALSE(pipeline_cache_matches(bad_version, key));
+
+    auto oversized_header = vk_blob(key, 16);
+    put_u32(oversized_header, 0, 4096);
+    CHECK_FALSE(pipeline_cache_matches(oversized_header, key));
+}
+
+// =================================================================
+// File round trip
+// =================================================================
+
+TEST_CASE("Cache file name carries vendor and device ids")
+{
+    const auto path = pipeline_cache_path("cache", test_key());
+    CHECK(path.filename().string() == "pipelines_10de_2684.bin");
+    CHECK(path.parent_path() == std::filesystem::path("cache"));
+}
+
+TEST_CASE("Saved cache loads back for the same device only")
+{
+    const auto dir = temp_dir();
+    const auto key = test_key();
+    const auto path = pipeline_cache_path(dir / "nested", key);
+
+    const PipelineCacheBlob saved{.data = vk_blob(key, 1000), .cold_build_us = 123456};
+    REQUIRE(save_pipeline_cache_file(path, saved));
+
+    // Written through a temp file that no longer exists
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+    CHECK(std::filesystem::exists(path));
+    CHECK_FALSE(std::filesystem::exists(tmp_path));
+
+    const auto loaded = load_pipeline_cache_file(path, key);
+    REQUIRE(loaded.has_value());
+    CHECK(loaded->data == saved.data);
+    CHECK(loaded->cold_build_us == saved.cold_build_us);
+
+    auto other = key;
+    other.uuid[0] ^= 0xFF;
+    CHECK_FALSE(load_pipeline_cache_file(path, other).has_value());
+
+    // Overwriting replaces the file in place
+    const PipelineCacheBlob updated{.data = vk_blob(key, 10), .cold_build_us = 99};
+    REQUIRE(save_pipeline_cache_file(path, updated));
+    CHECK(load_pipeline_cache_file(path, key)->data == updated.data);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Missing, truncated and foreign files are ignored")
+{
+    const auto dir = temp_dir();
+    std::filesystem::create_directories(dir);
+    const auto key = test_key();
+
+    CHECK_FALSE(load_pipeline_cache_file(dir / "missing.bin", key).has_value());
+
+    {
+        std::ofstream out(dir / "short.bin", std::ios::binary);
+        out << "PLXP";
+    }
+    CHECK_FALSE(load_pipeline_cache_file(dir / "short.bin", key).has_value());
+
+    // A raw driver blob without the Parallax header
+    {
+        const auto raw = vk_blob(key, 100);
+        std::ofstream out(dir / "raw.bin", std::ios::binary);
+        out.write(reinterpret_cast<const char*>(raw.data()), static_cast<std::streamsize>(raw.size()));
+    }
+    CHECK_FALSE(load_pipeline_cache_file(dir / "raw.bin", key).has_value());
+
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,189 @@
+/// @file test_precession.cpp
+/// @brief Unit tests for astro::Precession (IAU 2006 precession, IAU 2000A nutation).
+///
+/// Reference values are the IAU SOFA library's own test cases (t_sofa_c.c),
+/// at SOFA's tolerances. Nutation at further epochs was evaluated with
+/// iauNut00a as distributed in ERFA.
+///
+/// SOFA matrices are r[row][column]; glm is m[column][row].
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "astro/precession.hpp"
+#include "astro/time_system.hpp"
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace parallax;
+using namespace parallax::astro;
+
+static constexpr f64 kMjdZero = 2400000.5;
+static constexpr f64 kMasToRad = astro_constants::kPi / (180.0 * 3600.0 * 1000.0);
+
+// =================================================================
+// Model against SOFA
+// =================================================================
+
+TEST_CASE("IAU 2000A nutation matches iauNut00a")
+{
+    const Nutation nut = Precession::nutation(kMjdZero + 53736.0);
+    CHECK(std::abs(nut.dpsi - -0.9630909107115518431e-5) < 1e-13);
+    CHECK(std::abs(nut.deps - 0.4063239174001678710e-4) < 1e-13);
+}
+
+TEST_CASE("IAU 2000A nutation matches iauNut00a from 1900 to 2059")
+{
+    struct Epoch
+    {
+        f64 mjd;
+        f64 dpsi;
+        f64 deps;
+    };
+    constexpr Epoch kEpochs[] = {
+        {15020.0,  8.4520648962990995e-05, -1.1102960658473682e-05},   // 1900 Jan 0.5
+        {51544.5, -6.7544224264172976e-05, -2.7970831192374137e-05},   // J2000
+        {60310.5, -2.6049918527164841e-05,  3.9215462411657389e-05},   // 2024 Jan 1
+        {73051.0, -8.2184332345850599e-05,  1.6604902580146364e-05},   // 2059 Jan 1
+    };
+
+    for (const Epoch& epoch : kEpochs)
+    {
+        CAPTURE(epoch.mjd);
+        const Nutation nut = Precession::nutation(kMjdZero + epoch.mjd);
+        CHECK(std::abs(nut.dpsi - epoch.dpsi) < 1e-13);
+        CHECK(std::abs(nut.deps - epoch.deps) < 1e-13);
+    }
+}
+
+TEST_CASE("Fukushima-Williams angles match iauPfw06")
+{
+    const PrecessionAngles angles = Precession::precession_angles(kMjdZero + 50123.9999);
+    CHECK(std::abs(angles.gamma_bar - -0.2243387670997995690e-5) < 1e-14);
+    CHECK(std::abs(angles.phi_bar - 0.4091014602391312808) < 1e-12);
+    CHECK(std::abs(angles.psi_bar - -0.9501954178013031895e-3) < 1e-13);
+    CHECK(std::abs(angles.epsilon_a - 0.4091014316587367491) < 1e-12);
+}
+
+TEST_CASE("Mean obliquity matches iauObl06")
+{
+    CHECK(std::abs(Precession::mean_obliquity(kMjdZero + 54388.0) - 0.4090749229387258204) < 1e-14);
+}
+
+TEST_CASE("Bias-precession-nutation matrix matches iauPnm06a")
+{
+    const Mat3d m = Precession::bias_precession_nutation_matrix(kMjdZero + 50123.9999);
+
+    constexpr f64 kTol = 1e-12;
+    CHECK(std::abs(m[0][0] - 0.9999995832794205484) < kTol);
+    CHECK(std::abs(m[1][0] - 0.8372382772630962111e-3) < kTol);
+    CHECK(std::abs(m[2][0] - 0.3639684771140623099e-3) < kTol);
+    CHECK(std::abs(m[0][1] - -0.8372533744743683605e-3) < kTol);
+    CHECK(std::abs(m[1][1] - 0.9999996486492861646) < kTol);
+    CHECK(std::abs(m[2][1] - 0.4132905944611019498e-4) < kTol);
+    CHECK(std::abs(m[0][2] - -0.3639337469629464969e-3) < kTol);
+    CHECK(std::abs(m[1][2] - -0.4163377605910663999e-4) < kTol);
+    CHECK(std::abs(m[2][2] - 0.9999999329094390695) < kTol);
+}
+
+TEST_CASE("Earth rotation and sidereal time match iauEra00 / iauGmst06 / iauGst06a")
+{
+    CHECK(std::abs(Precession::earth_rotation_angle(kMjdZero + 54388.0) - 0.4022837240028158102) < 1e-12);
+
+    const f64 jd = kMjdZero + 53736.0;
+    CHECK(std::abs(Precession::gmst(jd, jd) - 1.754174971870091203) < 1e-12);
+
+    Precession precession;
+    precession.update(jd, jd);
+    CHECK(std::abs(precession.get_gast() - 1.754166137675019159) < 1e-10);
+}
+
+// =================================================================
+// Truncation
+// =================================================================
+
+TEST_CASE("Truncated nutation stays within its stated accuracy")
+{
+    // Sample a full 18.6-year nodal cycle
+    f64 worst_1e4 = 0.0;
+    f64 worst_1e6 = 0.0;
+    for (f64 jd = 2451545.0; jd < 2451545.0 + 6800.0; jd += 1.3)
+    {
+        const Nutation full = Precession::nutation(jd);
+        const Nutation cut_1e4 = Precession::nutation(jd, 1e4);
+        const Nutation cut_1e6 = Precession::nutation(jd, 1e6);
+
+        worst_1e4 = std::max({worst_1e4, std::abs(full.dpsi - cut_1e4.dpsi), std::abs(full.deps - cut_1e4.deps)});
+        worst_1e6 = std::max({worst_1e6, std::abs(full.dpsi - cut_1e6.dpsi), std::abs(full.deps - cut_1e6.deps)});
+    }
+
+    MESSAGE("truncation error: " << worst_1e4 / kMasToRad << " mas (13 terms), "
+            << worst_1e6 / kMasToRad << " mas (2 terms)");
+    CHECK(worst_1e4 < 50.0 * kMasToRad);
+    CHECK(worst_1e6 < 710.0 * kMasToRad);
+}
+
+// =================================================================
+// Cache
+// =================================================================
+
+TEST_CASE("Bias-precession-nutation is rebuilt only outside the tolerance")
+{
+    Precession precession({.nutation_threshold_uas = 0.0, .tolerance_days = 1.0 / 96.0});
+
+    const f64 jd = 2460000.5;
+    precession.update(jd, jd);
+    CHECK(precession.get_rebuild_count() == 1);
+
+    // A frame at 60 Hz later: same N×P×B, new Earth rotation
+    const f64 gast_before = precession.get_gast();
+    precession.update(jd + 1.0 / (60.0 * 86400.0), jd + 1.0 / (60.0 * 86400.0));
+    CHECK(precession.get_rebuild_count() == 1);
+    CHECK(precession.get_gast() != gast_before);
+
+    // 20 minutes later: rebuilt
+    precession.update(jd + 20.0 / 1440.0, jd + 20.0 / 1440.0);
+    CHECK(precession.get_rebuild_count() == 2);
+}
+
+TEST_CASE("Cached matrix stays within 1 mas of a fresh one across the tolerance window")
+{
+    Precession precession;
+    const f64 jd = 2460310.5;
+    precession.update(jd, jd);
+
+    // End of the default window: compare the cached N×P×B with an exact one
+    const f64 later = jd + 10.0 / 1440.0 - 1e-9;
+    precession.update(later, later);
+    REQUIRE(precession.get_rebuild_count() == 1);
+
+    const Mat3d exact = Precession::bias_precession_nutation_matrix(later);
+    const Mat3d& cached = precession.get_bias_precession_nutation();
+    f64 worst = 0.0;
+    for (int c = 0; c < 3; ++c)
+    {
+        for (int r = 0; r < 3; ++r)
+        {
+            worst = std::max(worst, std::abs(exact[c][r] - cached[c][r]));
+        }
+    }
+    CHECK(worst < kMasToRad);
+}
+
+TEST_CASE("Horizontal matrix is orthonormal and puts the celestial pole at the latitude")
+{
+    Precession precession;
+    const f64 jd = 2460310.5;
+    precession.update(jd, jd);
+
+    const ObserverLocation observer{.latitude_rad = 0.5, .longitude_rad = -0.3};
+    const Mat3d m = precession.get_celestial_to_horizontal(observer);
+
+    // The CIP is within ~1' of the GCRS pole today: altitude of the pole ≈ latitude
+    const Vec3d pole = m * Vec3d{0.0, 0.0, 1.0};
+    CHECK(std::asin(pole.z) == doctest::Approx(0.5).epsilon(1e-3));
+    // (north, east, zenith) is left-handed, as in equatorial_to_horizontal_matrix
+    CHECK(std::abs(glm::determinant(m)) == doctest::Approx(1.0).epsilon(1e-12));
+}
@@ -0,0 +1,247 @@
+/// @file test_projection_context.cpp
+/// @brief Unit tests for parallax::rendering::ProjectionContext.
+///
+/// Verifies the batch projection against the scalar reference
+/// Coordinates::horizontal_to_screen (same visibility, same screen position),
+/// both for horizontal-frame vectors and for J2000 vectors through the
+/// per-frame equatorial → horizontal matrix, and that compaction keeps
+/// order and per-star attributes.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "astro/coordinates.hpp"
+#include "core/types.hpp"
+#include "rendering/camera.hpp"
+#include "rendering/projection_context.hpp"
+#include "rendering/star_vertex.hpp"
+
+#include <cmath>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::astro;
+using namespace parallax::rendering;
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static Vec3d horizontal_to_vector(const HorizontalCoord& hz)
+{
+    return Vec3d{std::cos(hz.alt) * std::cos(hz.az), std::cos(hz.alt) * std::sin(hz.az), std::sin(hz.alt)};
+}
+
+/// Reference path used by Starfield before ProjectionContext.
+static std::optional<Vec2f> reference_project(const HorizontalCoord& hz, const Camera& camera)
+{
+    if (hz.alt < 0.0)
+    {
+        return std::nullopt;
+    }
+    return Coordinates::horizontal_to_screen(hz, camera.get_pointing(), camera.get_fov_rad());
+}
+
+/// True when a star sits so close to a cull boundary that f32/f64 rounding
+/// may legitimately decide either way.
+static bool near_boundary(const Vec3d& view, const ProjectionContext& ctx, f64 fov_rad, f64 alt)
+{
+    const f64 scale = 1.0 / std::tan(fov_rad * 0.5);
+    const f64 sx = std::abs(view.x / view.z * scale);
+    const f64 sy = std::abs(view.y / view.z * scale);
+    return std::abs(view.z - ctx.get_cos_cull()) < 1e-9 || std::abs(sx - 1.0) < 1e-5
+        || std::abs(sy - 1.0) < 1e-5 || std::abs(alt) < 1e-12;
+}
+
+/// Unit vectors split into x/y/z columns, the layout project() reads.
+struct DirectionColumns
+{
+    std::vector<f64> x, y, z;
+
+    void push_back(const Vec3d& d)
+    {
+        x.push_back(d.x);
+        y.push_back(d.y);
+        z.push_back(d.z);
+    }
+
+    [[nodiscard]] Vec3d operator[](std::size_t i) const { return Vec3d{x[i], y[i], z[i]}; }
+};
+
+static u32 project(const ProjectionContext& ctx, const DirectionColumns& directions,
+                   std::vector<StarVertex>& vertices)
+{
+    return ctx.project(directions.x, directions.y, directions.z, vertices);
+}
+
+static Camera make_camera(f64 alt_deg, f64 az_deg, f64 fov_deg)
+{
+    Camera camera;
+    camera.set_pointing(alt_deg * astro_constants::kDegToRad, az_deg * astro_constants::kDegToRad);
+    camera.set_fov(fov_deg);
+    return camera;
+}
+
+// =================================================================
+// Agreement with horizontal_to_screen
+// =================================================================
+
+TEST_CASE("Batch projection matches horizontal_to_screen")
+{
+    std::mt19937 rng(2024);
+    std::uniform_real_distribution<f64> az_dist(0.0, astro_constants::kTwoPi);
+    std::uniform_real_distribution<f64> z_dist(-0.3, 1.0);
+
+    const Camera cameras[] = {
+        make_camera(45.0, 0.0, 60.0),
+        make_camera(10.0, 250.0, 120.0),
+        make_camera(80.0, 123.0, 5.0),
+        make_camera(-5.0, 90.0, 30.0),
+    };
+
+    for (const auto& camera : cameras)
+    {
+        // Stars concentrated around the pointing so every camera sees some
+        std::vector<HorizontalCoord> stars;
+        const auto p = camera.get_pointing();
+        const f64 spread = camera.get_fov_rad();
+        std::uniform_real_distribution<f64> offset(-spread, spread);
+        for (int i = 0; i < 20000; ++i)
+        {
+            stars.push_back((i % 2 == 0)
+                ? HorizontalCoord{.alt = std::asin(z_dist(rng)), .az = az_dist(rng)}
+                : HorizontalCoord{.alt = std::clamp(p.alt + offset(rng), -1.5, 1.5),
+                                  .az = p.az + offset(rng)});
+        }
+
+        DirectionColumns directions;
+        std::vector<StarVertex> vertices;
+        for (std::size_t i = 0; i < stars.size(); ++i)
+        {
+            directions.push_back(horizontal_to_vector(stars[i]));
+            vertices.push_back(StarVertex{.screen_x = 0.0f, .screen_y = 0.0f,
+                                          .brightness = static_cast<f32>(i), .color_bv = 0.0f});
+        }
+
+        const ProjectionContext ctx(camera);
+        const u32 visible = project(ctx, directions, vertices);
+
+        u32 expected_visible = 0;
+        u32 out = 0;
+        for (std::size_t i = 0; i < stars.size(); ++i)
+        {
+            const auto expected = reference_project(stars[i], camera);
+            const bool got = out < visible && vertices[out].brightness == static_cast<f32>(i);
+
+            if (expected.has_value() != got)
+            {
+                REQUIRE(near_boundary(ctx.get_view_matrix() * directions[i], ctx,
+                                      camera.get_fov_rad(), stars[i].alt));
+            }
+            else if (got)
+            {
+                CHECK(vertices[out].screen_x == doctest::Approx(expected->x).epsilon(1e-5));
+                CHECK(vertices[out].screen_y == doctest::Approx(expected->y).epsilon(1e-5));
+            }
+
+            expected_visible += expected.has_value() ? 1 : 0;
+            out += got ? 1 : 0;
+        }
+
+        CHECK(out == visible);
+        CHECK(visible > 0);
+        CHECK(std::abs(static_cast<int>(visible) - static_cast<int>(expected_visible)) <= 2);
+    }
+}
+
+TEST_CASE("J2000 vectors through the equatorial → horizontal matrix")
+{
+    const ObserverLocation observer{.latitude_rad = 28.76 * astro_constants::kDegToRad,
+                                    .longitude_rad = 0.0};
+    const f64 lst = 2.1;
+    const Camera camera = make_camera(30.0, 200.0, 90.0);
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<f64> ra_dist(0.0, astro_constants::kTwoPi);
+    std::uniform_real_distribution<f64> z_dist(-1.0, 1.0);
+
+    std::vector<EquatorialCoord> stars;
+    DirectionColumns directions;
+    std::vector<StarVertex> vertices;
+    for (int i = 0; i < 20000; ++i)
+    {
+        stars.push_back(EquatorialCoord{.ra = ra_dist(rng), .dec = std::asin(z_dist(rng))});
+        directions.push_back(Coordinates::equatorial_to_unit_vector(stars.back()));
+        vertices.push_back(StarVertex{.screen_x = 0.0f, .screen_y = 0.0f,
+                                      .brightness = static_cast<f32>(i), .color_bv = 0.5f});
+    }
+
+    const ProjectionContext ctx(camera, Coordinates::equatorial_to_horizontal_matrix(observer, lst));
+    const u32 visible = project(ctx, directions, vertices);
+
+    u32 matched = 0;
+    u32 expected_visible = 0;
+    for (u32 k = 0; k < visible; ++k)
+    {
+        const auto i = static_cast<std::size_t>(vertices[k].brightness);
+        const auto hz = Coordinates::equatorial_to_horizontal(stars[i], observer, lst);
+        const auto expected = reference_project(hz, camera);
+        if (expected.has_value())
+        {
+            CHECK(vertices[k].screen_x == doctest::Approx(expected->x).epsilon(1e-5));
+            CHECK(vertices[k].screen_y == doctest::Approx(expected->y).epsilon(1e-5));
+            ++matched;
+        }
+    }
+    for (const auto& star : stars)
+    {
+        const auto hz = Coordinates::equatorial_to_horizontal(star, observer, lst);
+        expected_visible += reference_project(hz, camera).has_value() ? 1 : 0;
+    }
+
+    CHECK(visible > 1000);
+    CHECK(std::abs(static_cast<int>(matched) - static_cast<int>(expected_visible)) <= 2);
+}
+
+// =================================================================
+// Compaction
+// =================================================================
+
+TEST_CASE("Survivors are compacted in order with their attributes")
+{
+    const Camera camera = make_camera(45.0, 0.0, 60.0);
+    const ProjectionContext ctx(camera);
+
+    const Vec3d center = horizontal_to_vector(camera.get_pointing());
+    const Vec3d below = Vec3d{1.0, 0.0, -0.5} / std::sqrt(1.25);
+    const Vec3d behind = -center;
+
+    DirectionColumns directions;
+    for (const Vec3d& d : {below, center, behind, center})
+    {
+        directions.push_back(d);
+    }
+    std::vector<StarVertex> vertices = {
+        {.screen_x = 9.0f, .screen_y = 9.0f, .brightness = 0.1f, .color_bv = 1.0f},
+        {.screen_x = 9.0f, .screen_y = 9.0f, .brightness = 0.2f, .color_bv = 2.0f},
+        {.screen_x = 9.0f, .screen_y = 9.0f, .brightness = 0.3f, .color_bv = 3.0f},
+        {.screen_x = 9.0f, .screen_y = 9.0f, .brightness = 0.4f, .color_bv = 4.0f},
+    };
+
+    REQUIRE(project(ctx, directions, vertices) == 2);
+    CHECK(vertices[0].brightness == 0.2f);
+    CHECK(vertices[0].color_bv == 2.0f);
+    CHECK(vertices[1].brightness == 0.4f);
+    CHECK(vertices[1].color_bv == 4.0f);
+    CHECK(std::abs(vertices[0].screen_x) < 1e-6f);
+    CHECK(std::abs(vertices[0].screen_y) < 1e-6f);
+}
+
+TEST_CASE("Empty batch projects nothing")
+{
+    const ProjectionContext ctx(make_camera(45.0, 0.0, 60.0));
+    std::vector<StarVertex> vertices;
+    CHECK(project(ctx, DirectionColumns{}, vertices) == 0);
+}
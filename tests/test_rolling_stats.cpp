@@ -0,0 +1,96 @@
+/// @file test_rolling_stats.cpp
+/// @brief Unit tests for RollingStats (min / avg / p99 over a fixed window).
+///
+/// GpuProfiler reports per-pass timings through this window, so the
+/// eviction order and the nearest-rank percentile are checked directly.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "core/rolling_stats.hpp"
+#include "core/types.hpp"
+
+using namespace parallax;
+using namespace parallax::core;
+
+// =================================================================
+// Summary
+// =================================================================
+
+TEST_CASE("Empty window summarizes to zeros")
+{
+    const RollingStats<8> stats;
+    const RollingSummary summary = stats.summarize();
+    CHECK(summary.count == 0);
+    CHECK(summary.min == 0.0);
+    CHECK(summary.avg == 0.0);
+    CHECK(summary.p99 == 0.0);
+}
+
+TEST_CASE("Min, average and last of a partial window")
+{
+    RollingStats<8> stats;
+    stats.add(3.0);
+    stats.add(1.0);
+    stats.add(2.0);
+
+    const RollingSummary summary = stats.summarize();
+    CHECK(summary.count == 3);
+    CHECK(summary.min == 1.0);
+    CHECK(summary.avg == doctest::Approx(2.0));
+    CHECK(summary.p99 == 3.0);
+    CHECK(summary.last == 2.0);
+}
+
+TEST_CASE("p99 is the nearest-rank percentile")
+{
+    // 1..200 shuffled: ceil(0.99 × 200) = 198th smallest
+    RollingStats<256> stats;
+    for (int i = 0; i < 200; ++i)
+    {
+        stats.add(static_cast<f64>((i * 37) % 200 + 1));
+    }
+    CHECK(stats.summarize().p99 == 198.0);
+
+    // A single spike in 100 samples is the p99
+    RollingStats<100> spiky;
+    for (int i = 0; i < 99; ++i)
+    {
+        spiky.add(1.0);
+    }
+    spiky.add(50.0);
+    CHECK(spiky.summarize().p99 == 1.0);
+    CHECK(spiky.summarize().avg == doctest::Approx(1.49));
+}
+
+// =================================================================
+// Window
+// =================================================================
+
+TEST_CASE("Oldest samples are evicted once the window is full")
+{
+    RollingStats<4> stats;
+    for (int i = 1; i <= 10; ++i)
+    {
+        stats.add(static_cast<f64>(i));
+    }
+
+    const RollingSummary summary = stats.summarize();
+    CHECK(summary.count == 4);
+    CHECK(summary.min == 7.0);
+    CHECK(summary.avg == doctest::Approx(8.5));
+    CHECK(summary.p99 == 10.0);
+    CHECK(summary.last == 10.0);
+}
+
+TEST_CASE("clear() empties the window")
+{
+    RollingStats<4> stats;
+    stats.add(5.0);
+    stats.clear();
+    CHECK(stats.get_count() == 0);
+
+    stats.add(2.0);
+    CHECK(stats.summarize().min == 2.0);
+    CHECK(stats.summarize().last == 2.0);
+}
@@ -0,0 +1,260 @@
+/// @file test_spatial_index.cpp
+/// @brief Unit tests for parallax::catalog::SpatialIndex.
+///
+/// Verifies nested HEALPix pixel/center round-trips, that disc and polygon
+/// queries never miss a pixel containing a point inside the region, and
+/// star bucketing order.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "catalog/spatial_index.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::catalog;
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static Vec3d to_vec(f64 ra, f64 dec)
+{
+    return Vec3d{std::cos(dec) * std::cos(ra), std::cos(dec) * std::sin(ra), std::sin(dec)};
+}
+
+static f64 angle_between(const Vec3d& a, const Vec3d& b)
+{
+    return std::atan2(glm::length(glm::cross(a, b)), glm::dot(a, b));
+}
+
+/// Uniformly distributed random directions on the sphere, as (ra, dec).
+static std::vector<Vec2d> random_directions(std::size_t count, u32 seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<f64> ra_dist(0.0, astro_constants::kTwoPi);
+    std::uniform_real_distribution<f64> z_dist(-1.0, 1.0);
+
+    std::vector<Vec2d> dirs;
+    dirs.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        dirs.emplace_back(ra_dist(rng), std::asin(z_dist(rng)));
+    }
+    return dirs;
+}
+
+static bool contains(const std::vector<u32>& sorted_pixels, u32 pixel)
+{
+    return std::binary_search(sorted_pixels.begin(), sorted_pixels.end(), pixel);
+}
+
+// =================================================================
+// Pixel geometry
+// =================================================================
+
+TEST_CASE("Pixel count and order")
+{
+    const SpatialIndex index(64);
+    CHECK(index.get_nside() == 64);
+    CHECK(index.get_order() == 6);
+    CHECK(index.get_pixel_count() == 49152);
+}
+
+TEST_CASE("pix2ang → ang2pix round-trips every pixel")
+{
+    for (const u32 nside : {1u, 2u, 16u, 64u})
+    {
+        const SpatialIndex index(nside);
+        for (u32 pix = 0; pix < index.get_pixel_count(); ++pix)
+        {
+            const Vec2d center = index.pix2ang(pix);
+            REQUIRE(index.ang2pix(center.x, center.y) == pix);
+        }
+    }
+}
+
+TEST_CASE("Poles and equator map to the expected base pixels")
+{
+    const SpatialIndex index(1);
+    CHECK(index.ang2pix(0.1, astro_constants::kHalfPi) < 4);       // north cap faces 0..3
+    CHECK(index.ang2pix(0.1, -astro_constants::kHalfPi) >= 8);     // south cap faces 8..11
+    CHECK(index.ang2pix(0.0, 0.0) == 4);                            // face 4 straddles RA 0
+}
+
+TEST_CASE("Pixels hold roughly equal star counts (equal area)")
+{
+    const SpatialIndex index(4);
+    std::vector<u32> counts(index.get_pixel_count(), 0);
+    const auto dirs = random_directions(192000, 1);
+    for (const auto& d : dirs)
+    {
+        ++counts[index.ang2pix(d.x, d.y)];
+    }
+
+    // 1000 expected per pixel; 6σ ≈ 190
+    for (const u32 c : counts)
+    {
+        CHECK(c > 800);
+        CHECK(c < 1200);
+    }
+}
+
+TEST_CASE("max_pixrad bounds the distance from any point to its pixel center")
+{
+    const SpatialIndex index(32);
+    const auto dirs = random_directions(50000, 2);
+    for (const auto& d : dirs)
+    {
+        const u32 pix = index.ang2pix(d.x, d.y);
+        REQUIRE(angle_between(to_vec(d.x, d.y), index.pix2vec(pix)) <= index.max_pixrad());
+    }
+}
+
+// =================================================================
+// Queries
+// =================================================================
+
+TEST_CASE("query_disc returns every pixel containing a point in the disc")
+{
+    const SpatialIndex index(64);
+    const auto dirs = random_directions(100000, 3);
+    std::vector<u32> pixels;
+
+    struct Disc { f64 ra_deg, dec_deg, radius_deg; };
+    for (const Disc disc : {Disc{10.0, 20.0, 0.5}, Disc{250.0, -45.0, 5.0}, Disc{0.0, 89.9, 3.0},
+                            Disc{180.0, -88.0, 10.0}, Disc{359.9, 0.0, 30.0}})
+    {
+        const f64 ra = disc.ra_deg * astro_constants::kDegToRad;
+        const f64 dec = disc.dec_deg * astro_constants::kDegToRad;
+        const f64 radius = disc.radius_deg * astro_constants::kDegToRad;
+        index.query_disc(ra, dec, radius, pixels);
+
+        CHECK(std::is_sorted(pixels.begin(), pixels.end()));
+        CHECK(std::adjacent_find(pixels.begin(), pixels.end()) == pixels.end());
+
+        const Vec3d center = to_vec(ra, dec);
+        for (const auto& d : dirs)
+        {
+            if (angle_between(center, to_vec(d.x, d.y)) <= radius)
+            {
+                REQUIRE(contains(pixels, index.ang2pix(d.x, d.y)));
+            }
+        }
+
+        // The center pixel is always included
+        CHECK(contains(pixels, index.ang2pix(ra, dec)));
+    }
+}
+
+TEST_CASE("query_disc is tight for narrow fields")
+{
+    const SpatialIndex index(64);
+    std::vector<u32> pixels;
+
+    // 0.5° FOV: a handful of ~0.9° pixels, not a large fraction of the sky
+    index.query_disc(1.0, 0.3, 0.25 * astro_constants::kDegToRad, pixels);
+    CHECK(!pixels.empty());
+    CHECK(pixels.size() <= 16);
+
+    // Whole sky
+    index.query_disc(1.0, 0.3, astro_constants::kPi, pixels);
+    CHECK(pixels.size() == index.get_pixel_count());
+}
+
+TEST_CASE("query_polygon returns every pixel containing a point in the polygon")
+{
+    const SpatialIndex index(32);
+    const auto dirs = random_directions(100000, 4);
+    std::vector<u32> pixels;
+
+    // A 20° × 10° quadrilateral, given in both winding orders
+    std::vector<Vec3d> corners = {
+        to_vec(0.5, 0.1), to_vec(0.85, 0.1), to_vec(0.85, 0.27), to_vec(0.5, 0.27),
+    };
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        index.query_polygon(corners, pixels);
+        CHECK(std::is_sorted(pixels.begin(), pixels.end()));
+        CHECK(pixels.size() < index.get_pixel_count() / 10);
+
+        std::vector<Vec3d> normals;
+        for (std::size_t i = 0; i < corners.size(); ++i)
+        {
+            normals.push_back(glm::cross(corners[i], corners[(i + 1) % corners.size()]));
+        }
+        const f64 sign = glm::dot(normals[0], to_vec(0.675, 0.185)) > 0.0 ? 1.0 : -1.0;
+
+        for (const auto& d : dirs)
+        {
+            const Vec3d v = to_vec(d.x, d.y);
+            const bool inside = std::all_of(normals.begin(), normals.end(),
+                                            [&](const Vec3d& n) { return sign * glm::dot(n, v) >= 0.0; });
+            if (inside)
+            {
+                REQUIRE(contains(pixels, index.ang2pix(d.x, d.y)));
+            }
+        }
+
+        std::reverse(corners.begin(), corners.end());
+    }
+}
+
+TEST_CASE("Degenerate polygon yields no pixels")
+{
+    const SpatialIndex index(8);
+    std::vector<u32> pixels = {1, 2, 3};
+    const std::vector<Vec3d> two = {to_vec(0.0, 0.0), to_vec(0.1, 0.0)};
+    index.query_polygon(two, pixels);
+    CHECK(pixels.empty());
+}
+
+// =================================================================
+// Star buckets
+// =================================================================
+
+TEST_CASE("build() buckets stars by pixel, brightest first")
+{
+    SpatialIndex index(16);
+    CHECK(index.pixel_range(0).empty());
+
+    std::vector<StarEntry> stars;
+    const auto dirs = random_directions(5000, 5);
+    u32 id = 0;
+    for (const auto& d : dirs)
+    {
+        stars.push_back(StarEntry{.ra = d.x, .dec = d.y, .mag_v = static_cast<f32>(id % 13),
+                                  .color_bv = 0.5f, .catalog_id = id});
+        ++id;
+    }
+
+    index.build(stars);
+    CHECK(index.get_stars().size() == stars.size());
+
+    const auto ra = index.get_stars().get_ra();
+    const auto dec = index.get_stars().get_dec();
+    const auto mag = index.get_stars().get_mag_v();
+
+    std::size_t total = 0;
+    for (u32 pix = 0; pix < index.get_pixel_count(); ++pix)
+    {
+        const auto bucket = index.pixel_range(pix);
+        total += bucket.size();
+        for (u32 i = bucket.begin; i < bucket.end; ++i)
+        {
+            REQUIRE(index.ang2pix(ra[i], dec[i]) == pix);
+            if (i > bucket.begin)
+            {
+                REQUIRE(mag[i - 1] <= mag[i]);
+            }
+        }
+    }
+    CHECK(total == stars.size());
+}
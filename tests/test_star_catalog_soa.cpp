@@ -0,0 +1,101 @@
+/// @file test_star_catalog_soa.cpp
+/// @brief Unit tests for parallax::catalog::StarCatalogSoA.
+///
+/// Verifies AoS → SoA conversion order, row reassembly, column alignment and
+/// the derived unit-vector columns.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "catalog/star_catalog_soa.hpp"
+#include "catalog/star_entry.hpp"
+#include "core/types.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::catalog;
+
+static std::vector<StarEntry> make_stars(u32 count)
+{
+    std::vector<StarEntry> stars;
+    for (u32 i = 0; i < count; ++i)
+    {
+        stars.push_back(StarEntry{.ra = 0.01 * i, .dec = -0.005 * i,
+                                  .mag_v = 0.1f * static_cast<f32>(i),
+                                  .color_bv = 0.5f, .catalog_id = 1000 + i});
+    }
+    return stars;
+}
+
+static bool is_aligned(const void* ptr)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % StarCatalogSoA::kAlignment == 0;
+}
+
+TEST_CASE("from_entries keeps row order in every column")
+{
+    const auto stars = make_stars(100);
+    const auto soa = StarCatalogSoA::from_entries(stars);
+
+    REQUIRE(soa.size() == stars.size());
+    for (std::size_t i = 0; i < stars.size(); ++i)
+    {
+        REQUIRE(soa.get_ra()[i] == stars[i].ra);
+        REQUIRE(soa.get_dec()[i] == stars[i].dec);
+        REQUIRE(soa.get_mag_v()[i] == stars[i].mag_v);
+        REQUIRE(soa.get_color_bv()[i] == stars[i].color_bv);
+        REQUIRE(soa.get_catalog_id()[i] == stars[i].catalog_id);
+    }
+}
+
+TEST_CASE("get_entry reassembles a row")
+{
+    StarCatalogSoA soa;
+    for (const auto& star : make_stars(3))
+    {
+        soa.push_back(star);
+    }
+
+    const StarEntry row = soa.get_entry(2);
+    CHECK(row.ra == doctest::Approx(0.02));
+    CHECK(row.dec == doctest::Approx(-0.01));
+    CHECK(row.catalog_id == 1002);
+
+    soa.clear();
+    CHECK(soa.empty());
+}
+
+TEST_CASE("Columns start on a cache line")
+{
+    const auto soa = StarCatalogSoA::from_entries(make_stars(37));
+
+    CHECK(is_aligned(soa.get_direction_x().data()));
+    CHECK(is_aligned(soa.get_direction_y().data()));
+    CHECK(is_aligned(soa.get_direction_z().data()));
+    CHECK(is_aligned(soa.get_ra().data()));
+    CHECK(is_aligned(soa.get_dec().data()));
+    CHECK(is_aligned(soa.get_mag_v().data()));
+    CHECK(is_aligned(soa.get_color_bv().data()));
+    CHECK(is_aligned(soa.get_catalog_id().data()));
+}
+
+TEST_CASE("Direction columns hold the J2000 unit vector")
+{
+    const auto stars = make_stars(50);
+    const auto soa = StarCatalogSoA::from_entries(stars);
+
+    REQUIRE(soa.get_direction_x().size() == stars.size());
+    REQUIRE(soa.get_direction_y().size() == stars.size());
+    REQUIRE(soa.get_direction_z().size() == stars.size());
+    for (std::size_t i = 0; i < stars.size(); ++i)
+    {
+        const Vec3d d{soa.get_direction_x()[i], soa.get_direction_y()[i], soa.get_direction_z()[i]};
+        REQUIRE(soa.get_direction(i) == d);
+        REQUIRE(glm::length(d) == doctest::Approx(1.0).epsilon(1e-12));
+        REQUIRE(std::asin(d.z) == doctest::Approx(stars[i].dec).epsilon(1e-12));
+        REQUIRE(std::atan2(d.y, d.x) == doctest::Approx(stars[i].ra).epsilon(1e-12));
+    }
+}
@@ -0,0 +1,98 @@
+/// @file test_star_vertex.cpp
+/// @brief Unit tests for the 8-byte PackedStarVertex encoding.
+///
+/// Verifies the round trip through pack_star_vertex / unpack_star_vertex
+/// (the decode starfield.vert performs): screen position within 1/8 pixel
+/// on a 4K target, brightness and B-V within half-float precision, and the
+/// edges of the screen mapping exactly.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "core/types.hpp"
+#include "rendering/star_vertex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace parallax;
+using namespace parallax::rendering;
+
+// =================================================================
+// Round trip
+// =================================================================
+
+TEST_CASE("Packed vertex is half the size of StarVertex")
+{
+    CHECK(sizeof(PackedStarVertex) * 2 == sizeof(StarVertex));
+}
+
+TEST_CASE("Screen position error stays below 1/8 pixel at 4K")
+{
+    constexpr f32 kWidthPx = 3840.0f;
+    constexpr f32 kHeightPx = 2160.0f;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<f32> ndc_dist(-1.0f, 1.0f);
+
+    f32 max_error_x_px = 0.0f;
+    f32 max_error_y_px = 0.0f;
+    for (int i = 0; i < 200000; ++i)
+    {
+        const StarVertex vertex{
+            .screen_x = ndc_dist(rng),
+            .screen_y = ndc_dist(rng),
+            .brightness = 0.5f,
+            .color_bv = 0.6f,
+        };
+        const StarVertex decoded = unpack_star_vertex(pack_star_vertex(vertex));
+
+        // NDC span of 2 covers the full width / height
+        max_error_x_px = std::max(max_error_x_px, std::abs(decoded.screen_x - vertex.screen_x) * kWidthPx * 0.5f);
+        max_error_y_px = std::max(max_error_y_px, std::abs(decoded.screen_y - vertex.screen_y) * kHeightPx * 0.5f);
+    }
+
+    MESSAGE("max position error at 4K: " << max_error_x_px << " px (x), " << max_error_y_px << " px (y)");
+    CHECK(max_error_x_px < 0.125f);
+    CHECK(max_error_y_px < 0.125f);
+}
+
+TEST_CASE("Screen edges and center survive quantization")
+{
+    const StarVertex corners[] = {
+        {.screen_x = -1.0f, .screen_y = -1.0f, .brightness = 1.0f, .color_bv = 0.0f},
+        {.screen_x = 1.0f, .screen_y = 1.0f, .brightness = 1.0f, .color_bv = 0.0f},
+    };
+    for (const auto& vertex : corners)
+    {
+        const StarVertex decoded = unpack_star_vertex(pack_star_vertex(vertex));
+        CHECK(decoded.screen_x == vertex.screen_x);
+        CHECK(decoded.screen_y == vertex.screen_y);
+    }
+
+    const StarVertex center = unpack_star_vertex(pack_star_vertex({0.0f, 0.0f, 1.0f, 0.0f}));
+    CHECK(std::abs(center.screen_x) < 2.0f / 65535.0f);
+    CHECK(std::abs(center.screen_y) < 2.0f / 65535.0f);
+}
+
+TEST_CASE("Brightness and B-V keep half-float precision")
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<f32> mag_dist(-1.5f, 21.0f);
+    std::uniform_real_distribution<f32> bv_dist(-0.4f, 2.0f);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        // Pogson brightness over the catalog's magnitude range, as Starfield normalizes it
+        const f32 brightness = std::min(std::pow(10.0f, -0.4f * mag_dist(rng)) / 3.98f, 1.0f);
+        const StarVertex vertex{.screen_x = 0.0f, .screen_y = 0.0f, .brightness = brightness, .color_bv = bv_dist(rng)};
+        const StarVertex decoded = unpack_star_vertex(pack_star_vertex(vertex));
+
+        // Half floats: 11 significant bits (subnormals below 6e-5 lose
+        // relative precision but stay within 3e-8 absolute)
+        REQUIRE(std::abs(decoded.brightness - vertex.brightness)
+                <= std::max(vertex.brightness * 0x1p-11f, 3e-8f));
+        REQUIRE(std::abs(decoded.color_bv - vertex.color_bv) <= 1e-3f);
+    }
+}
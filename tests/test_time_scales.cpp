@@ -0,0 +1,400 @@
+/// @file test_time_scales.cpp
+/// @brief Unit tests for astro::TimeScales (UTC / TAI / TT / UT1).
+///
+/// Verifies the leap-second table at its steps, the ΔT polynomial against
+/// its published coefficients, round trips between every pair of scales,
+/// IERS table interpolation across a leap second, the frame cache and the
+/// bulk conversion.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest/doctest.h>
+
+#include "astro/time_scales.hpp"
+#include "astro/time_system.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace parallax;
+using namespace parallax::astro;
+
+// =================================================================
+// Custom main: initialize logger before tests
+// =================================================================
+
+int main(int argc, char** argv)
+{
+    parallax::core::Logger::init();
+    const int result = doctest::Context(argc, argv).run();
+    parallax::core::Logger::shutdown();
+    return result;
+}
+
+// =================================================================
+// Helpers
+// =================================================================
+
+static constexpr std::array<TimeScale, 4> kScales = {TimeScale::Utc, TimeScale::Tai, TimeScale::Tt, TimeScale::Ut1};
+
+static JulianDate utc(i32 year, i32 month, i32 day, i32 hour = 0, i32 minute = 0, f64 second = 0.0)
+{
+    return TimeSystem::to_precise_julian_date(DateTime{
+        .year = year, .month = month, .day = day, .hour = hour, .minute = minute, .second = second,
+    });
+}
+
+/// 2017-01-01 0h UTC, just after the last leap second
+static const JulianDate kLeap2017 = utc(2017, 1, 1);
+static constexpr i64 kLeap2017Mjd = 57754;
+
+/// One finals2000A row with only the columns TimeScales reads filled in
+static std::string finals_row(i64 mjd, const char* ut1_minus_utc)
+{
+    std::string row(188, ' ');
+    char field[16];
+    std::snprintf(field, sizeof(field), "%8.2f", static_cast<f64>(mjd));
+    row.replace(7, 8, field);
+    if (ut1_minus_utc != nullptr)
+    {
+        std::snprintf(field, sizeof(field), "%10s", ut1_minus_utc);
+        row[57] = 'I';
+        row.replace(58, 10, field);
+    }
+    return row;
+}
+
+static std::filesystem::path write_finals(const char* name, const std::vector<std::string>& rows)
+{
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream out(path, std::ios::trunc);
+    for (const auto& row : rows)
+    {
+        out << row << '\n';
+    }
+    return path;
+}
+
+/// UT1 − TAI falling 1 ms/day through the 2017 leap second; UT1 − UTC jumps by +1 s
+static f64 sample_ut1_minus_tai(i64 mjd)
+{
+    return -36.4 - 0.001 * static_cast<f64>(mjd - 57740);
+}
+
+static std::vector<std::string> sample_finals_rows()
+{
+    std::vector<std::string> rows;
+    rows.push_back(finals_row(57739, nullptr));     // No UT1 yet: skipped
+    for (i64 mjd = 57740; mjd <= 57770; ++mjd)
+    {
+        const f64 tai_minus_utc = mjd < kLeap2017Mjd ? 36.0 : 37.0;
+        char value[16];
+        std::snprintf(value, sizeof(value), "%.7f", sample_ut1_minus_tai(mjd) + tai_minus_utc);
+        rows.push_back(finals_row(mjd, value));
+    }
+    rows.push_back(finals_row(57771, nullptr));     // Past the predictions: ends the table
+    rows.push_back(finals_row(57772, nullptr));
+    return rows;
+}
+
+// =================================================================
+// Leap seconds and ΔT
+// =================================================================
+
+TEST_CASE("Leap-second table steps at 0h UTC")
+{
+    CHECK(TimeScales::leap_seconds(utc(1960, 1, 1)) == 10.0);
+    CHECK(TimeScales::leap_seconds(utc(1972, 1, 1)) == 10.0);
+    CHECK(TimeScales::leap_seconds(utc(1972, 7, 1)) == 11.0);
+    CHECK(TimeScales::leap_seconds(utc(1998, 12, 31, 23, 59, 59.9)) == 31.0);
+    CHECK(TimeScales::leap_seconds(utc(1999, 1, 1)) == 32.0);
+    CHECK(TimeScales::leap_seconds(utc(2016, 12, 31, 23, 59, 59.5)) == 36.0);
+    CHECK(TimeScales::leap_seconds(kLeap2017) == 37.0);
+    CHECK(TimeScales::leap_seconds(utc(2024, 6, 15, 22, 30)) == 37.0);
+}
+
+TEST_CASE("ΔT polynomial matches its anchor values and observed ΔT")
+{
+    // Constant terms of the Espenak–Meeus segments
+    CHECK(TimeScales::delta_t_model(1900.0) == doctest::Approx(-2.79).epsilon(1e-12));
+    CHECK(TimeScales::delta_t_model(1950.0) == doctest::Approx(29.07).epsilon(1e-12));
+    CHECK(TimeScales::delta_t_model(1975.0) == doctest::Approx(45.45).epsilon(1e-12));
+    CHECK(TimeScales::delta_t_model(2000.0) == doctest::Approx(63.86).epsilon(1e-12));
+
+    // Observed: 42.23 s at 1972.0, 63.83 s at 2000.0
+    CHECK(std::abs(TimeScales::delta_t_model(1972.0) - 42.23) < 0.1);
+    CHECK(std::abs(TimeScales::delta_t_model(2000.0) - 63.83) < 0.1);
+
+    // Segments join within a couple of seconds (mostly far better)
+    for (const f64 year : {-500.0, 500.0, 1600.0, 1700.0, 1800.0, 1860.0, 1900.0, 1920.0,
+                           1941.0, 1961.0, 1986.0, 2005.0, 2050.0, 2150.0})
+    {
+        CAPTURE(year);
+        CHECK(std::abs(TimeScales::delta_t_model(year - 1e-9) - TimeScales::delta_t_model(year)) < 2.0);
+    }
+}
+
+// =================================================================
+// Conversions without an IERS table
+// =================================================================
+
+TEST_CASE("TT − UTC steps by one second across the 2017 leap second")
+{
+    const TimeScales scales;
+
+    const JulianDate date = utc(2024, 6, 15, 22, 30);
+    CHECK((scales.convert(date, TimeScale::Utc, TimeScale::Tt) - date) == doctest::Approx(69.184));
+    CHECK((scales.convert(date, TimeScale::Utc, TimeScale::Tai) - date) == doctest::Approx(37.0));
+
+    // Half a second either side of midnight: 1 s of UTC, 2 s of TT
+    const JulianDate before = kLeap2017 - 0.5;
+    const JulianDate after = kLeap2017 + 0.5;
+    const f64 tt_elapsed = scales.convert(after, TimeScale::Utc, TimeScale::Tt)
+                         - scales.convert(before, TimeScale::Utc, TimeScale::Tt);
+    CHECK(tt_elapsed == doctest::Approx(2.0));
+
+    // TAI inside 23:59:60 lands in the first second of the new day
+    const JulianDate in_leap = kLeap2017 + 36.5;
+    CHECK((scales.convert(in_leap, TimeScale::Tai, TimeScale::Utc) - kLeap2017) == doctest::Approx(0.5));
+}
+
+TEST_CASE("Before 1972 UTC is UT1 and TT − UT1 is the ΔT model")
+{
+    const TimeScales scales;
+
+    const JulianDate date = utc(1950, 6, 1, 12);
+    const TimeScaleOffsets offsets = scales.get_offsets(date);
+    CHECK(offsets.ut1_minus_utc == 0.0);
+    CHECK(scales.get_delta_t(date) == doctest::Approx(TimeScales::delta_t_model(1950.415)).epsilon(1e-4));
+
+    // The handover to the leap-second table is nearly seamless (42.25 s vs 42.184 s)
+    const f64 jump = scales.get_delta_t(utc(1972, 1, 1)) - scales.get_delta_t(utc(1971, 12, 31, 23, 59, 59.0));
+    CHECK(std::abs(jump) < 0.1);
+}
+
+TEST_CASE("DUT1 defaults to zero and can be set")
+{
+    TimeScales scales;
+    const JulianDate date = utc(2024, 6, 15, 22, 30);
+
+    CHECK(scales.get_offsets(date).ut1_minus_utc == 0.0);
+    CHECK(scales.get_delta_t(date) == doctest::Approx(69.184));
+
+    scales.set_dut1(0.25);
+    CHECK(scales.get_offsets(date).ut1_minus_utc == doctest::Approx(0.25));
+    CHECK((scales.convert(date, TimeScale::Utc, TimeScale::Ut1) - date) == doctest::Approx(0.25));
+    CHECK(scales.get_delta_t(date) == doctest::Approx(68.934));
+}
+
+TEST_CASE("Without an IERS table a 2026 date takes UT1 from UTC + DUT1")
+{
+    TimeScales scales;
+    REQUIRE_FALSE(scales.has_iers_table());
+
+    // Past kLeapSecondsKnownUntilMjd but inside the assumed horizon
+    const JulianDate date = utc(2026, 10, 16, 21);
+    CHECK(scales.get_offsets(date).tai_minus_utc == 37.0);
+    CHECK(scales.get_offsets(date).ut1_minus_utc == 0.0);
+    CHECK(scales.get_delta_t(date) == doctest::Approx(69.184));
+
+    scales.set_dut1(0.06);
+    CHECK(scales.get_offsets(date).ut1_minus_utc == doctest::Approx(0.06));
+    CHECK((scales.convert(date, TimeScale::Utc, TimeScale::Ut1) - date) == doctest::Approx(0.06));
+    CHECK(scales.get_delta_t(date) == doctest::Approx(69.124));
+}
+
+TEST_CASE("ΔT past the leap-second horizon follows the model's trend without a jump")
+{
+    const TimeScales scales;
+    const JulianDate horizon(TimeScales::kLeapSecondsAssumedUntilMjd + 2400000, 43200.0);
+
+    const f64 before = scales.get_delta_t(horizon - 1.0);
+    const f64 after = scales.get_delta_t(horizon + 1.0);
+    CHECK(std::abs(after - before) < 1e-3);
+    CHECK(before == doctest::Approx(69.184));
+
+    // Growing, as the model does; TAI − UTC stays at 37 s
+    const JulianDate later = utc(2100, 1, 1);
+    CHECK(scales.get_delta_t(later) > 100.0);
+    CHECK(scales.get_offsets(later).tai_minus_utc == 37.0);
+}
+
+TEST_CASE("Round trips between every pair of scales")
+{
+    const TimeScales scales;
+
+    for (const JulianDate& date : {utc(1800, 3, 1, 6), utc(1950, 6, 1, 12), utc(1971, 12, 31, 18),
+                                   utc(1999, 1, 1, 0, 0, 10.0), utc(2016, 12, 31, 23, 59, 58.0),
+                                   utc(2024, 6, 15, 22, 30), utc(2080, 1, 1, 3), utc(2300, 7, 4)})
+    {
+        for (const TimeScale from : kScales)
+        {
+            for (const TimeScale to : kScales)
+            {
+                const JulianDate there = scales.convert(date, from, to);
+                const JulianDate back = scales.convert(there, to, from);
+                CAPTURE(date.get_jd());
+                CHECK(std::abs(back - date) < 1e-6);
+            }
+        }
+    }
+}
+
+// =================================================================
+// IERS table
+// =================================================================
+
+TEST_CASE("IERS rows are interpolated as UT1 − TAI across a leap second")
+{
+    const auto path = write_finals("plx_finals_sample.txt", sample_finals_rows());
+    TimeScales scales;
+    REQUIRE(scales.load_iers_table(path));
+    CHECK(scales.has_iers_table());
+
+    // On a row: the tabulated value
+    const JulianDate row_date = utc(2016, 12, 31);
+    CHECK(scales.get_offsets(row_date).ut1_minus_utc
+          == doctest::Approx(sample_ut1_minus_tai(kLeap2017Mjd - 1) + 36.0).epsilon(1e-12));
+
+    // Noon before the leap: halfway in UT1 − TAI, not halfway across the 1 s step
+    const JulianDate noon = utc(2016, 12, 31, 12);
+    const f64 expected = 0.5 * (sample_ut1_minus_tai(kLeap2017Mjd - 1) + sample_ut1_minus_tai(kLeap2017Mjd)) + 36.0;
+    CHECK(scales.get_offsets(noon).ut1_minus_utc == doctest::Approx(expected).epsilon(1e-12));
+
+    // UT1 runs on smoothly through the leap second
+    const f64 ut1_elapsed = scales.convert(kLeap2017 + 0.5, TimeScale::Utc, TimeScale::Ut1)
+                          - scales.convert(kLeap2017 - 0.5, TimeScale::Utc, TimeScale::Ut1);
+    CHECK(std::abs(ut1_elapsed - 2.0) < 1e-6);
+
+    // Past the last row ΔT continues from it; before the first, DUT1 is the default
+    const JulianDate last_row(57770 + 2400000, 43200.0);
+    CHECK(std::abs(scales.get_delta_t(last_row + 1.0) - scales.get_delta_t(last_row - 1.0)) < 1e-3);
+    CHECK(scales.get_offsets(utc(2010, 1, 1)).ut1_minus_utc == 0.0);
+
+    scales.clear_iers_table();
+    CHECK_FALSE(scales.has_iers_table());
+    CHECK(scales.get_offsets(noon).ut1_minus_utc == 0.0);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Missing, malformed and gapped IERS files are rejected")
+{
+    TimeScales scales;
+    CHECK_FALSE(scales.load_iers_table(std::filesystem::temp_directory_path() / "plx_no_such_finals.txt"));
+
+    const auto good = write_finals("plx_finals_good.txt", sample_finals_rows());
+    REQUIRE(scales.load_iers_table(good));
+    const f64 loaded = scales.get_offsets(utc(2016, 12, 31, 12)).ut1_minus_utc;
+
+    std::vector<std::string> gapped = sample_finals_rows();
+    gapped.erase(gapped.begin() + 10);
+    const auto gapped_path = write_finals("plx_finals_gapped.txt", gapped);
+    CHECK_FALSE(scales.load_iers_table(gapped_path));
+
+    std::vector<std::string> malformed = sample_finals_rows();
+    malformed[5].replace(58, 10, "  0.12x456");
+    const auto malformed_path = write_finals("plx_finals_malformed.txt", malformed);
+    CHECK_FALSE(scales.load_iers_table(malformed_path));
+
+    // The table loaded first is kept
+    CHECK(scales.has_iers_table());
+    CHECK(scales.get_offsets(utc(2016, 12, 31, 12)).ut1_minus_utc == loaded);
+
+    for (const auto& path : {good, gapped_path, malformed_path})
+    {
+        std::filesystem::remove(path);
+    }
+}
+
+// =================================================================
+// Frame cache and bulk conversion
+// =================================================================
+
+TEST_CASE("Conversions within the frame's UTC day are served from the cache")
+{
+    TimeScales scales;
+    const JulianDate date = utc(2024, 6, 15, 22, 30);
+    scales.update(date);
+
+    const FrameTimes& frame = scales.get_frame();
+    CHECK(frame.utc == date);
+    CHECK((frame.tai - date) == doctest::Approx(37.0));
+    CHECK((frame.tt - date) == doctest::Approx(69.184));
+    CHECK((frame.ut1 - date) == doctest::Approx(0.0));
+
+    const u64 searches = scales.get_search_count();
+    for (i32 i = 0; i < 1000; ++i)
+    {
+        const JulianDate t = date + i * 0.05;
+        CHECK(std::abs(scales.convert(t, TimeScale::Utc, TimeScale::Tt) - (frame.tt + i * 0.05)) < 1e-9);
+    }
+    CHECK(scales.get_search_count() == searches);
+
+    // A later frame in the same day reuses the segment; another day does not
+    scales.update(date + 60.0);
+    CHECK(scales.get_search_count() == searches);
+    (void)scales.get_delta_t(date + 7 * 86400.0);
+    CHECK(scales.get_search_count() > searches);
+}
+
+TEST_CASE("Bulk conversion agrees with per-instant conversion, across a leap second")
+{
+    const auto path = write_finals("plx_finals_bulk.txt", sample_finals_rows());
+    TimeScales scales;
+    REQUIRE(scales.load_iers_table(path));
+    std::filesystem::remove(path);
+
+    // Sorted UTC series from 2016-12-30 to 2017-01-03, plus one in reverse
+    std::vector<f64> series;
+    for (f64 jd = kLeap2017.get_jd() - 2.0; jd < kLeap2017.get_jd() + 2.0; jd += 0.013)
+    {
+        series.push_back(jd);
+    }
+    std::vector<f64> reversed(series.rbegin(), series.rend());
+
+    // TAI steps through the inserted second itself
+    std::vector<f64> tai_series;
+    for (f64 s = 30.0; s < 40.0; s += 0.25)
+    {
+        tai_series.push_back((kLeap2017 + s).get_jd());
+    }
+
+    constexpr f64 kToleranceDays = 2e-9;    // A few f64 JD ulps (~40 µs each)
+    const auto check = [&](const std::vector<f64>& input) {
+        for (const TimeScale from : kScales)
+        {
+            for (const TimeScale to : kScales)
+            {
+                std::vector<f64> out(input.size());
+                scales.convert(input, from, to, out);
+                for (std::size_t i = 0; i < input.size(); ++i)
+                {
+                    const f64 expected = scales.convert(JulianDate(input[i]), from, to).get_jd();
+                    CAPTURE(input[i]);
+                    CHECK(std::abs(out[i] - expected) < kToleranceDays);
+                }
+            }
+        }
+    };
+    check(series);
+    check(reversed);
+    check(tai_series);
+
+    // In place
+    std::vector<f64> in_place = series;
+    scales.convert(in_place, TimeScale::Utc, TimeScale::Tt, in_place);
+    CHECK(std::abs(in_place.back() - scales.convert(JulianDate(series.back()), TimeScale::Utc, TimeScale::Tt).get_jd())
+          < kToleranceDays);
+
+    // Sorted input costs about one search per day
+    const u64 searches = scales.get_search_count();
+    std::vector<f64> out(series.size());
+    scales.convert(series, TimeScale::Utc, TimeScale::Tt, out);
+    CHECK(scales.get_search_count() - searches < 16);
+}
@@ -2,7 +2,8 @@
 /// @brief Unit tests for parallax::astro::TimeSystem.
 ///
 /// Verifies Julian Date conversion (Meeus algorithm), GMST (IAU 1982),
-/// LMST, and round-trip consistency against known reference values.
+/// LMST, the JulianDate overloads, and round-trip consistency against known
+/// reference values.
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
@@ -10,6 +11,7 @@
 #include "astro/time_system.hpp"
 #include "core/types.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 using namespace parallax;
@@ -270,4 +272,48 @@ TEST_CASE("now_as_jd returns a reasonable Julian Date")
     // Should be after 2020-01-01 (JD ~2458849.5) and before 2100
     CHECK(jd > 2458849.5);
     CHECK(jd < 2488070.0);
-}
\ No newline at end of file
+}
+
+// =================================================================
+// JulianDate overloads
+// =================================================================
+
+TEST_CASE("Precise Julian Date matches the f64 conversion and round-trips")
+{
+    const DateTime dt{.year = 2024, .month = 6, .day = 15, .hour = 22, .minute = 30, .second = 12.25};
+    const JulianDate precise = TimeSystem::to_precise_julian_date(dt);
+    CHECK(std::abs(precise.get_jd() - TimeSystem::to_julian_date(dt)) < kJdTolerance);
+
+    const DateTime back = TimeSystem::from_julian_date(precise);
+    CHECK(back.year == 2024);
+    CHECK(back.month == 6);
+    CHECK(back.day == 15);
+    CHECK(back.hour == 22);
+    CHECK(back.minute == 30);
+    CHECK(std::abs(back.second - 12.25) < 1e-6);
+}
+
+TEST_CASE("GMST from a JulianDate agrees with the f64 form")
+{
+    for (const f64 jd : {2451545.0, 2460000.5, 2460000.8765, 2470000.25})
+    {
+        const f64 precise = TimeSystem::gmst(JulianDate(jd));
+        const f64 plain = TimeSystem::gmst(jd);
+        f64 diff = std::abs(precise - plain);
+        diff = std::min(diff, astro_constants::kTwoPi - diff);
+        CHECK(diff < 1e-8);
+    }
+
+    const f64 lon = 12.5 * astro_constants::kDegToRad;
+    const JulianDate date(2460000.8765);
+    f64 diff = std::abs(TimeSystem::lmst(date, lon) - TimeSystem::lmst(date.get_jd(), lon));
+    diff = std::min(diff, astro_constants::kTwoPi - diff);
+    CHECK(diff < 1e-8);
+}
+
+TEST_CASE("now_as_julian_date agrees with now_as_jd")
+{
+    const f64 plain = TimeSystem::now_as_jd();
+    const JulianDate precise = TimeSystem::now_as_julian_date();
+    CHECK(std::abs(precise.get_jd() - plain) * JulianDate::kSecondsPerDay < 5.0);
+}
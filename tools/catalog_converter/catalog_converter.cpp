@@ -0,0 +1,686 @@
+/// @file catalog_converter.cpp
+/// @brief Implementation of the streaming CSV → .plxcat converter.
+
+#include "catalog_converter.hpp"
+
+#include "core/logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <queue>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#ifdef PLX_PLATFORM_WINDOWS
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+
+using namespace parallax;
+
+// -----------------------------------------------------------------
+// CSV field helpers (same rules as CatalogLoader)
+// -----------------------------------------------------------------
+
+std::string_view trim(std::string_view sv)
+{
+    while (!sv.empty() && (sv.front() == ' ' || sv.front() == '\t' || sv.front() == '\r'))
+    {
+        sv.remove_prefix(1);
+    }
+    while (!sv.empty() && (sv.back() == ' ' || sv.back() == '\t' || sv.back() == '\r'))
+    {
+        sv.remove_suffix(1);
+    }
+    return sv;
+}
+
+template <typename T>
+bool parse_number(std::string_view sv, T& value)
+{
+    sv = trim(sv);
+    if (sv.empty())
+    {
+        return false;
+    }
+    const auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), value);
+    return ec == std::errc{} && ptr == sv.data() + sv.size();
+}
+
+/// @brief Pop the next comma-separated field off the front of a line.
+bool next_field(std::string_view& line, std::string_view& field)
+{
+    const auto comma = line.find(',');
+    if (comma == std::string_view::npos)
+    {
+        return false;
+    }
+    field = line.substr(0, comma);
+    line.remove_prefix(comma + 1);
+    return true;
+}
+
+// -----------------------------------------------------------------
+// Buffered run file reader
+// -----------------------------------------------------------------
+
+template <typename Record>
+class RunReader
+{
+public:
+    RunReader(const std::filesystem::path& path, std::size_t buffer_records)
+        : m_file(path, std::ios::binary)
+        , m_opened(m_file.is_open())
+        , m_buffer(buffer_records)
+    {
+        refill();
+    }
+
+    /// Whether the file could be opened; stream state after the first
+    /// read is not a valid test (a short run already hit EOF)
+    [[nodiscard]] bool is_open() const { return m_opened; }
+    [[nodiscard]] bool empty() const { return m_pos >= m_size; }
+    [[nodiscard]] const Record& front() const { return m_buffer[m_pos]; }
+
+    void pop()
+    {
+        if (++m_pos >= m_size)
+        {
+            refill();
+        }
+    }
+
+private:
+    void refill()
+    {
+        m_pos = 0;
+        m_size = 0;
+        if (!m_file)
+        {
+            return;
+        }
+        m_file.read(reinterpret_cast<char*>(m_buffer.data()),
+                    static_cast<std::streamsize>(m_buffer.size() * sizeof(Record)));
+        m_size = static_cast<std::size_t>(m_file.gcount()) / sizeof(Record);
+    }
+
+    std::ifstream m_file;
+    bool m_opened = false;
+    std::vector<Record> m_buffer;
+    std::size_t m_pos = 0;
+    std::size_t m_size = 0;
+};
+
+/// @brief Write a span of PODs to a stream in one call.
+template <typename T>
+void write_all(std::ofstream& out, const std::vector<T>& values)
+{
+    out.write(reinterpret_cast<const char*>(values.data()),
+              static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+} // anonymous namespace
+
+namespace parallax::tools
+{
+
+// -----------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------
+
+CatalogConverter::CatalogConverter(ConverterConfig config)
+    : m_config{std::move(config)}
+    , m_index{m_config.nside}
+{
+    if (m_config.thread_count == 0)
+    {
+        m_config.thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (m_config.temp_dir.empty())
+    {
+        m_config.temp_dir = m_config.output;
+        m_config.temp_dir += ".runs";
+    }
+
+    // Pass 1 keeps up to (threads + 1) chunks alive; each chunk costs its text
+    // plus the parsed records (roughly the same size again).
+    const u64 in_flight = static_cast<u64>(m_config.thread_count) + 1;
+    m_chunk_bytes = static_cast<std::size_t>(
+        std::max<u64>(m_config.memory_budget_bytes / (2 * in_flight), 1ull << 20));
+
+    // Pass 2 keeps one buffer per merge input plus one output buffer per
+    // concurrent merge.
+    const u64 merge_buffers = static_cast<u64>(m_config.max_merge_fan_in + 1) * m_config.thread_count;
+    m_merge_buffer_records = static_cast<std::size_t>(
+        std::max<u64>(m_config.memory_budget_bytes / merge_buffers / sizeof(RunRecord), 1024));
+}
+
+// -----------------------------------------------------------------
+// run() — both passes + statistics
+// -----------------------------------------------------------------
+
+std::optional<ConverterStats> CatalogConverter::run()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_config.temp_dir, ec);
+    if (ec)
+    {
+        PLX_CORE_ERROR("CatalogConverter: Cannot create temp dir {}: {}",
+                       m_config.temp_dir.string(), ec.message());
+        return std::nullopt;
+    }
+
+    PLX_CORE_INFO("CatalogConverter: {} → {} (nside {}, {} threads, {} MB budget, {} MB chunks)",
+                  m_config.input.string(), m_config.output.string(), m_config.nside,
+                  m_config.thread_count, m_config.memory_budget_bytes >> 20, m_chunk_bytes >> 20);
+
+    ConverterStats stats;
+    const bool ok = generate_runs(stats) && merge_runs(stats);
+
+    std::filesystem::remove_all(m_config.temp_dir, ec);
+
+    if (!ok)
+    {
+        return std::nullopt;
+    }
+
+    stats.elapsed_sec = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+    stats.peak_rss_bytes = peak_rss_bytes();
+    return stats;
+}
+
+// -----------------------------------------------------------------
+// Pass 1 — stream input in newline-aligned chunks to worker threads
+// -----------------------------------------------------------------
+
+bool CatalogConverter::generate_runs(ConverterStats& stats)
+{
+    std::ifstream input(m_config.input, std::ios::binary);
+    if (!input.is_open())
+    {
+        PLX_CORE_ERROR("CatalogConverter: Failed to open input: {}", m_config.input.string());
+        return false;
+    }
+
+    // Skip header line
+    std::string header;
+    if (!std::getline(input, header))
+    {
+        PLX_CORE_ERROR("CatalogConverter: Input is empty: {}", m_config.input.string());
+        return false;
+    }
+    stats.input_bytes = header.size() + 1;
+
+    // Bounded hand-off queue: the reader blocks once every worker is busy
+    // and one chunk is waiting, which caps memory at (threads + 1) chunks.
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<std::string> queue;
+    bool done = false;
+
+    std::vector<u64> skipped(m_config.thread_count, 0);
+    std::vector<std::thread> workers;
+    workers.reserve(m_config.thread_count);
+
+    for (u32 t = 0; t < m_config.thread_count; ++t)
+    {
+        workers.emplace_back([&, t] {
+            for (;;)
+            {
+                std::string chunk;
+                {
+                    std::unique_lock lock(queue_mutex);
+                    queue_cv.wait(lock, [&] { return !queue.empty() || done; });
+                    if (queue.empty())
+                    {
+                        return;
+                    }
+                    chunk = std::move(queue.front());
+                    queue.pop_front();
+                }
+                queue_cv.notify_all();
+                process_chunk(std::move(chunk), skipped[t]);
+            }
+        });
+    }
+
+    std::string carry;
+    while (input)
+    {
+        std::string chunk = std::move(carry);
+        carry.clear();
+
+        const std::size_t old_size = chunk.size();
+        chunk.resize(old_size + m_chunk_bytes);
+        input.read(chunk.data() + old_size, static_cast<std::streamsize>(m_chunk_bytes));
+        const auto got = static_cast<std::size_t>(input.gcount());
+        chunk.resize(old_size + got);
+        stats.input_bytes += got;
+
+        // Cut at the last newline; the partial line starts the next chunk
+        if (input)
+        {
+            const auto last_newline = chunk.rfind('\n');
+            if (last_newline == std::string::npos)
+            {
+                carry = std::move(chunk);
+                continue;
+            }
+            carry.assign(chunk, last_newline + 1);
+            chunk.resize(last_newline + 1);
+        }
+
+        if (chunk.empty())
+        {
+            continue;
+        }
+
+        std::unique_lock lock(queue_mutex);
+        queue_cv.wait(lock, [&] { return queue.size() < 1; });
+        queue.push_back(std::move(chunk));
+        lock.unlock();
+        queue_cv.notify_all();
+    }
+
+    {
+        std::lock_guard lock(queue_mutex);
+        done = true;
+    }
+    queue_cv.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const u64 s : skipped)
+    {
+        stats.rows_skipped += s;
+    }
+    stats.run_count = m_runs.size();
+
+    if (stats.rows_skipped > 0)
+    {
+        PLX_CORE_WARN("CatalogConverter: Skipped {} malformed lines", stats.rows_skipped);
+    }
+    PLX_CORE_INFO("CatalogConverter: Pass 1 produced {} sorted runs", m_runs.size());
+
+    if (m_run_write_failed)
+    {
+        PLX_CORE_ERROR("CatalogConverter: Pass 1 failed writing sorted runs");
+        return false;
+    }
+    if (m_runs.empty())
+    {
+        PLX_CORE_ERROR("CatalogConverter: No valid stars found in: {}", m_config.input.string());
+        return false;
+    }
+    return true;
+}
+
+void CatalogConverter::process_chunk(std::string chunk, u64& skipped)
+{
+    std::vector<RunRecord> records;
+    records.reserve(chunk.size() / 40);
+
+    std::string_view text{chunk};
+    while (!text.empty())
+    {
+        const auto newline = text.find('\n');
+        const std::string_view line = text.substr(0, newline);
+        text.remove_prefix(newline == std::string_view::npos ? text.size() : newline + 1);
+
+        if (trim(line).empty())
+        {
+            continue;
+        }
+
+        RunRecord record{};
+        if (parse_line(line, record))
+        {
+            records.push_back(record);
+        }
+        else
+        {
+            ++skipped;
+        }
+    }
+
+    // Release the text before sorting so only the records stay resident
+    chunk = std::string{};
+
+    // Comment-only or blank chunks produce no run at all
+    if (records.empty())
+    {
+        return;
+    }
+
+    std::sort(records.begin(), records.end(), record_less);
+
+    const auto path = make_run_path();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    write_all(out, records);
+    out.close();
+    if (!out)
+    {
+        PLX_CORE_ERROR("CatalogConverter: Failed writing run file {}", path.string());
+        m_run_write_failed = true;
+        return;
+    }
+
+    std::lock_guard lock(m_runs_mutex);
+    m_runs.push_back(path);
+}
+
+// -----------------------------------------------------------------
+// Line parser: HIP,RA_deg,Dec_deg,Vmag,BV
+// -----------------------------------------------------------------
+
+bool CatalogConverter::parse_line(std::string_view line, RunRecord& out) const
+{
+    std::string_view hip_str;
+    std::string_view ra_str;
+    std::string_view dec_str;
+    std::string_view mag_str;
+
+    if (!next_field(line, hip_str) || !next_field(line, ra_str)
+        || !next_field(line, dec_str) || !next_field(line, mag_str))
+    {
+        return false;
+    }
+
+    u32 hip = 0;
+    f64 ra_deg = 0.0;
+    f64 dec_deg = 0.0;
+    f64 mag_v = 0.0;
+    f64 bv = 0.0;
+
+    if (!parse_number(hip_str, hip) || !parse_number(ra_str, ra_deg)
+        || !parse_number(dec_str, dec_deg) || !parse_number(mag_str, mag_v)
+        || !parse_number(line, bv))
+    {
+        return false;
+    }
+
+    const catalog::StarEntry star{
+        .ra         = ra_deg * astro_constants::kDegToRad,
+        .dec        = dec_deg * astro_constants::kDegToRad,
+        .mag_v      = static_cast<f32>(mag_v),
+        .color_bv   = static_cast<f32>(bv),
+        .catalog_id = hip,
+    };
+
+    out.pixel = m_index.ang2pix(star.ra, star.dec);
+    out.reserved = 0;
+    out.star = catalog::pack_star(star);
+    return true;
+}
+
+bool CatalogConverter::record_less(const RunRecord& a, const RunRecord& b)
+{
+    const auto key = [](const RunRecord& r) {
+        return std::tuple{r.pixel, static_cast<i16>(r.star.mag_v), static_cast<u32>(r.star.source_id),
+                          static_cast<f64>(r.star.ra), static_cast<f64>(r.star.dec),
+                          static_cast<i16>(r.star.mag_b)};
+    };
+    return key(a) < key(b);
+}
+
+// -----------------------------------------------------------------
+// Pass 2 — merge passes
+// -----------------------------------------------------------------
+
+bool CatalogConverter::merge_runs(ConverterStats& stats)
+{
+    const std::size_t fan_in = std::max<u32>(2, m_config.max_merge_fan_in);
+
+    // Intermediate passes: merge disjoint groups concurrently
+    while (m_runs.size() > fan_in)
+    {
+        std::vector<std::vector<std::filesystem::path>> groups;
+        for (std::size_t i = 0; i < m_runs.size(); i += fan_in)
+        {
+            const auto end = std::min(i + fan_in, m_runs.size());
+            groups.emplace_back(m_runs.begin() + static_cast<std::ptrdiff_t>(i),
+                                m_runs.begin() + static_cast<std::ptrdiff_t>(end));
+        }
+
+        std::vector<std::filesystem::path> outputs(groups.size());
+        for (auto& path : outputs)
+        {
+            path = make_run_path();
+        }
+
+        std::atomic<std::size_t> next_group{0};
+        std::atomic<bool> failed{false};
+        std::vector<std::thread> workers;
+        const u32 worker_count = std::min<u32>(m_config.thread_count, static_cast<u32>(groups.size()));
+
+        for (u32 t = 0; t < worker_count; ++t)
+        {
+            workers.emplace_back([&] {
+                for (std::size_t g = next_group++; g < groups.size(); g = next_group++)
+                {
+                    std::ofstream out(outputs[g], std::ios::binary | std::ios::trunc);
+                    std::vector<RunRecord> buffer;
+                    buffer.reserve(m_merge_buffer_records);
+
+                    const bool ok = merge_files(groups[g], [&](const RunRecord& record) {
+                        buffer.push_back(record);
+                        if (buffer.size() == m_merge_buffer_records)
+                        {
+                            write_all(out, buffer);
+                            buffer.clear();
+                        }
+                    });
+                    write_all(out, buffer);
+
+                    if (!ok || !out)
+                    {
+                        failed = true;
+                    }
+                    for (const auto& input : groups[g])
+                    {
+                        std::error_code ec;
+                        std::filesystem::remove(input, ec);
+                    }
+                }
+            });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        if (failed)
+        {
+            PLX_CORE_ERROR("CatalogConverter: Intermediate merge failed");
+            return false;
+        }
+
+        ++stats.merge_passes;
+        m_runs = std::move(outputs);
+        PLX_CORE_INFO("CatalogConverter: Merge pass {} → {} runs", stats.merge_passes, m_runs.size());
+    }
+
+    ++stats.merge_passes;
+    return write_plxcat(m_runs, stats);
+}
+
+bool CatalogConverter::merge_files(const std::vector<std::filesystem::path>& inputs,
+                                   const std::function<void(const RunRecord&)>& sink) const
+{
+    std::vector<RunReader<RunRecord>> readers;
+    readers.reserve(inputs.size());
+    for (const auto& path : inputs)
+    {
+        readers.emplace_back(path, m_merge_buffer_records);
+        if (!readers.back().is_open())
+        {
+            PLX_CORE_ERROR("CatalogConverter: Failed to open run file {}", path.string());
+            return false;
+        }
+    }
+
+    // Min-heap of reader indices keyed by each reader's current record
+    const auto greater = [&](std::size_t a, std::size_t b) {
+        return record_less(readers[b].front(), readers[a].front());
+    };
+    std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(greater)> heap(greater);
+
+    for (std::size_t i = 0; i < readers.size(); ++i)
+    {
+        if (!readers[i].empty())
+        {
+            heap.push(i);
+        }
+    }
+
+    while (!heap.empty())
+    {
+        const std::size_t i = heap.top();
+        heap.pop();
+
+        sink(readers[i].front());
+        readers[i].pop();
+
+        if (!readers[i].empty())
+        {
+            heap.push(i);
+        }
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------
+// Final merge — header + index + data, written via a temp file and
+// renamed into place so a crash never leaves a truncated catalog.
+// -----------------------------------------------------------------
+
+bool CatalogConverter::write_plxcat(const std::vector<std::filesystem::path>& inputs,
+                                    ConverterStats& stats) const
+{
+    auto tmp_path = m_config.output;
+    tmp_path += ".tmp";
+
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        PLX_CORE_ERROR("CatalogConverter: Failed to create {}", tmp_path.string());
+        return false;
+    }
+
+    // Every failure below leaves no partial .tmp behind
+    const auto discard_tmp = [&] {
+        out.close();
+        std::error_code ec;
+        std::filesystem::remove(tmp_path, ec);
+    };
+
+    // Reserve header + index; both are rewritten once counts are known
+    auto header = catalog::make_catalog_header(0, m_config.nside);
+    std::vector<catalog::HEALPixIndexEntry> index(header.healpix_count, catalog::HEALPixIndexEntry{});
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    write_all(out, index);
+
+    std::vector<catalog::PackedStarEntry> buffer;
+    buffer.reserve(m_merge_buffer_records);
+    u64 written = 0;
+
+    const bool ok = merge_files(inputs, [&](const RunRecord& record) {
+        auto& entry = index[record.pixel];
+        if (entry.count == 0)
+        {
+            entry.offset = written * sizeof(catalog::PackedStarEntry);
+        }
+        ++entry.count;
+        ++written;
+
+        buffer.push_back(record.star);
+        if (buffer.size() == m_merge_buffer_records)
+        {
+            write_all(out, buffer);
+            buffer.clear();
+        }
+    });
+    write_all(out, buffer);
+
+    header.entry_count = written;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    write_all(out, index);
+    out.close();
+
+    if (!ok || !out)
+    {
+        PLX_CORE_ERROR("CatalogConverter: Failed writing {}", tmp_path.string());
+        discard_tmp();
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, m_config.output, ec);
+    if (ec)
+    {
+        PLX_CORE_ERROR("CatalogConverter: Failed to move {} into place: {}",
+                       tmp_path.string(), ec.message());
+        discard_tmp();
+        return false;
+    }
+
+    stats.rows_written = written;
+    return true;
+}
+
+// -----------------------------------------------------------------
+// Helpers
+// -----------------------------------------------------------------
+
+std::filesystem::path CatalogConverter::make_run_path()
+{
+    return m_config.temp_dir / ("run_" + std::to_string(m_next_run_id++) + ".bin");
+}
+
+u64 CatalogConverter::peak_rss_bytes()
+{
+#ifdef PLX_PLATFORM_WINDOWS
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return static_cast<u64>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+    return static_cast<u64>(usage.ru_maxrss) * 1024;  // Linux reports kilobytes
+#endif
+}
+
+} // namespace parallax::tools
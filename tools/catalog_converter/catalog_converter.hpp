@@ -0,0 +1,120 @@
+#pragma once
+
+/// @file catalog_converter.hpp
+/// @brief Streaming CSV → .plxcat converter with a bounded-memory external merge sort.
+
+#include "catalog/plxcat_format.hpp"
+#include "catalog/spatial_index.hpp"
+#include "core/types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace parallax::tools
+{
+    /// @brief Converter settings (filled from the command line).
+    struct ConverterConfig
+    {
+        std::filesystem::path input;            ///< Hipparcos-style CSV: HIP,RA_deg,Dec_deg,Vmag,BV
+        std::filesystem::path output;           ///< Destination .plxcat
+        std::filesystem::path temp_dir;         ///< Sorted run files (default: next to output)
+        u32 nside = 64;                         ///< HEALPix resolution of the index
+        u64 memory_budget_bytes = 1ull << 30;   ///< Upper bound for in-flight chunks + merge buffers
+        u32 thread_count = 0;                   ///< 0 = std::thread::hardware_concurrency()
+        u32 max_merge_fan_in = 64;              ///< Runs merged per pass (bounds open files)
+    };
+
+    /// @brief Summary reported after a conversion.
+    struct ConverterStats
+    {
+        u64 input_bytes = 0;
+        u64 rows_written = 0;
+        u64 rows_skipped = 0;
+        u64 run_count = 0;          ///< Sorted runs produced by the first pass
+        u32 merge_passes = 0;       ///< Including the final merge into the .plxcat
+        f64 elapsed_sec = 0.0;
+        u64 peak_rss_bytes = 0;
+    };
+
+    /// @brief Converts arbitrarily large CSV catalogs into the binary .plxcat format.
+    ///
+    /// Pipeline:
+    /// 1. The reader thread streams the input in newline-aligned chunks.
+    /// 2. Worker threads parse each chunk, assign a nested HEALPix pixel per
+    ///    star, sort by (pixel, magnitude) and spill the chunk as a sorted run.
+    /// 3. Runs are k-way merged (in parallel groups while there are more than
+    ///    max_merge_fan_in of them) and the final merge streams the star data
+    ///    and index table into the output file.
+    ///
+    /// At most thread_count + 1 chunks are in flight, so peak memory is set by
+    /// memory_budget_bytes rather than by the input size.
+    class CatalogConverter
+    {
+    public:
+        explicit CatalogConverter(ConverterConfig config);
+
+        /// @brief Run the full conversion.
+        /// @return Statistics on success, std::nullopt on failure (reason is logged).
+        [[nodiscard]] std::optional<ConverterStats> run();
+
+        /// @brief Peak resident set size of the current process in bytes.
+        [[nodiscard]] static u64 peak_rss_bytes();
+
+    private:
+        /// @brief One star plus its sort key, as stored in run files.
+        struct RunRecord
+        {
+            u32 pixel;
+            u32 reserved;
+            catalog::PackedStarEntry star;
+        };
+        static_assert(sizeof(RunRecord) == 40, "RunRecord must be 40 bytes");
+
+        /// @brief Total order: pixel, magnitude (brightest first), then remaining
+        /// fields so output bytes do not depend on thread scheduling.
+        [[nodiscard]] static bool record_less(const RunRecord& a, const RunRecord& b);
+
+        /// @brief Parse one CSV line into a record. Returns false if malformed.
+        [[nodiscard]] bool parse_line(std::string_view line, RunRecord& out) const;
+
+        /// @brief Pass 1: read, parse, sort and spill runs.
+        [[nodiscard]] bool generate_runs(ConverterStats& stats);
+
+        /// @brief Parse + sort one chunk and write it as a run file (none if
+        /// the chunk has no valid rows). Write errors set m_run_write_failed.
+        void process_chunk(std::string chunk, u64& skipped);
+
+        /// @brief Pass 2: merge groups of runs until one final merge remains.
+        [[nodiscard]] bool merge_runs(ConverterStats& stats);
+
+        /// @brief K-way merge of run files into a record sink.
+        [[nodiscard]] bool merge_files(const std::vector<std::filesystem::path>& inputs,
+                                       const std::function<void(const RunRecord&)>& sink) const;
+
+        /// @brief Final merge: write header, index and star data.
+        [[nodiscard]] bool write_plxcat(const std::vector<std::filesystem::path>& inputs,
+                                        ConverterStats& stats) const;
+
+        /// @brief Unique path in temp_dir for a new run file (not yet registered).
+        [[nodiscard]] std::filesystem::path make_run_path();
+
+        ConverterConfig m_config;
+        catalog::SpatialIndex m_index;
+
+        std::size_t m_chunk_bytes = 0;          ///< Input bytes per parse chunk
+        std::size_t m_merge_buffer_records = 0; ///< Records buffered per merge input
+
+        std::mutex m_runs_mutex;                ///< Guards m_runs (workers spill concurrently)
+        std::vector<std::filesystem::path> m_runs;
+        std::atomic<u64> m_next_run_id{0};
+        std::atomic<bool> m_run_write_failed{false};
+    };
+
+} // namespace parallax::tools
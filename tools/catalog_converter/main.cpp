@@ -0,0 +1,121 @@
+/// @file main.cpp
+/// @brief catalog_converter entry point — command-line parsing and reporting.
+///
+/// Usage:
+///   catalog_converter <input.csv> <output.plxcat>
+///                     [--nside N] [--memory-mb M] [--threads T] [--fan-in K] [--temp-dir DIR]
+
+#include "catalog_converter.hpp"
+
+#include "core/logger.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <string_view>
+
+namespace
+{
+
+void print_usage()
+{
+    PLX_CORE_INFO("Usage: catalog_converter <input.csv> <output.plxcat> "
+                  "[--nside N] [--memory-mb M] [--threads T] [--fan-in K] [--temp-dir DIR]");
+}
+
+template <typename T>
+bool parse_arg(std::string_view text, T& value)
+{
+    const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc{} && ptr == text.data() + text.size();
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    using namespace parallax;
+
+    core::Logger::init();
+
+    tools::ConverterConfig config;
+    int positional = 0;
+    bool ok = true;
+
+    for (int i = 1; i < argc && ok; ++i)
+    {
+        const std::string_view arg{argv[i]};
+        const bool has_value = i + 1 < argc;
+
+        if (arg == "--nside" && has_value)
+        {
+            ok = parse_arg(argv[++i], config.nside);
+        }
+        else if (arg == "--memory-mb" && has_value)
+        {
+            u64 mb = 0;
+            ok = parse_arg(argv[++i], mb) && mb > 0;
+            config.memory_budget_bytes = mb << 20;
+        }
+        else if (arg == "--threads" && has_value)
+        {
+            ok = parse_arg(argv[++i], config.thread_count);
+        }
+        else if (arg == "--fan-in" && has_value)
+        {
+            ok = parse_arg(argv[++i], config.max_merge_fan_in) && config.max_merge_fan_in >= 2;
+        }
+        else if (arg == "--temp-dir" && has_value)
+        {
+            config.temp_dir = argv[++i];
+        }
+        else if (!arg.starts_with("--") && positional == 0)
+        {
+            config.input = arg;
+            ++positional;
+        }
+        else if (!arg.starts_with("--") && positional == 1)
+        {
+            config.output = arg;
+            ++positional;
+        }
+        else
+        {
+            ok = false;
+        }
+    }
+
+    const bool nside_ok = config.nside >= 1 && config.nside <= catalog::SpatialIndex::kMaxNside
+                       && (config.nside & (config.nside - 1)) == 0;
+
+    if (!ok || positional != 2 || !nside_ok)
+    {
+        if (!nside_ok)
+        {
+            PLX_CORE_ERROR("--nside must be a power of two in [1, {}]", catalog::SpatialIndex::kMaxNside);
+        }
+        print_usage();
+        core::Logger::shutdown();
+        return EXIT_FAILURE;
+    }
+
+    tools::CatalogConverter converter{config};
+    const auto stats = converter.run();
+    if (!stats)
+    {
+        core::Logger::shutdown();
+        return EXIT_FAILURE;
+    }
+
+    const f64 seconds = std::max(stats->elapsed_sec, 1e-9);
+    PLX_CORE_INFO("Wrote {} stars ({} skipped) in {:.2f} s", stats->rows_written,
+                  stats->rows_skipped, stats->elapsed_sec);
+    PLX_CORE_INFO("Throughput: {:.0f} rows/s, {:.1f} MB/s",
+                  static_cast<f64>(stats->rows_written) / seconds,
+                  static_cast<f64>(stats->input_bytes) / (1024.0 * 1024.0) / seconds);
+    PLX_CORE_INFO("Runs: {}, merge passes: {}, peak RSS: {:.1f} MB", stats->run_count,
+                  stats->merge_passes, static_cast<f64>(stats->peak_rss_bytes) / (1024.0 * 1024.0));
+
+    core::Logger::shutdown();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,222 @@
+/// @file main.cpp
+/// @brief de_sample_generator — writes a small synthetic JPL DE binary file.
+///
+/// Usage:
+///   de_sample_generator <output.bin>
+///
+/// The file has the exact DE440 record layout (1018 coefficients per
+/// record, the same series pointers and sub-intervals) but only four
+/// 32-day records, and every series holds a known cubic instead of an
+/// orbit, so a reader can be checked to rounding error offline:
+///
+///     τ = (JD − 2451600.5) / 64
+///     value(series, axis) = 1e5·(series + 1) + 1e4·axis + 3000·τ − 200·(axis + 1)·τ² + 50·τ³   [km]
+///
+/// tests/data/de_sample.bin is this tool's output; tests/test_jpl_ephemeris.cpp
+/// evaluates the same cubic.
+
+#include "astro/chebyshev.hpp"
+#include "core/logger.hpp"
+#include "core/types.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+using namespace parallax;
+
+constexpr u32 kRecordDoubles = 1018;
+constexpr f64 kStartJd = 2451536.5;
+constexpr f64 kRecordDays = 32.0;
+constexpr u32 kRecordCount = 4;
+constexpr i32 kDeNumber = 440;
+constexpr f64 kAuKm = 149597870.7;
+constexpr f64 kEarthMoonRatio = 81.30056822149722;
+
+/// DE440 pointers: (offset, coefficients, sub-intervals) for the 11 series,
+/// nutations and librations
+struct Pointer
+{
+    i32 offset;
+    i32 count;
+    i32 subintervals;
+};
+
+constexpr std::array<Pointer, 11> kSeries = {{
+    {3, 14, 4},     // Mercury
+    {171, 10, 2},   // Venus
+    {231, 13, 2},   // Earth-Moon barycentre
+    {309, 11, 1},   // Mars
+    {342, 8, 1},    // Jupiter
+    {366, 7, 1},    // Saturn
+    {387, 6, 1},    // Uranus
+    {405, 6, 1},    // Neptune
+    {423, 6, 1},    // Pluto
+    {441, 13, 8},   // Moon (geocentric)
+    {753, 11, 2},   // Sun
+}};
+constexpr Pointer kNutations = {819, 10, 4};
+constexpr Pointer kLibrations = {899, 10, 4};
+
+constexpr std::array<std::string_view, 3> kConstantNames = {"AU", "EMRAT", "DENUM"};
+
+f64 sample_value(u32 series, u32 axis, f64 jd)
+{
+    const f64 tau = (jd - 2451600.5) / 64.0;
+    return 1.0e5 * (series + 1) + 1.0e4 * axis + 3000.0 * tau - 200.0 * (axis + 1) * tau * tau + 50.0 * tau * tau * tau;
+}
+
+template <typename T>
+void put(std::vector<std::byte>& record, std::size_t offset, T value)
+{
+    std::memcpy(record.data() + offset, &value, sizeof(T));
+}
+
+void put_text(std::vector<std::byte>& record, std::size_t offset, std::string_view text, std::size_t width)
+{
+    for (std::size_t i = 0; i < width; ++i)
+    {
+        record[offset + i] = static_cast<std::byte>(i < text.size() ? text[i] : ' ');
+    }
+}
+
+void put_pointer(std::vector<std::byte>& record, std::size_t offset, const Pointer& pointer)
+{
+    put<i32>(record, offset, pointer.offset);
+    put<i32>(record, offset + 4, pointer.count);
+    put<i32>(record, offset + 8, pointer.subintervals);
+}
+
+std::vector<std::byte> make_header()
+{
+    std::vector<std::byte> record(kRecordDoubles * sizeof(f64));
+
+    put_text(record, 0, "JPL Planetary Ephemeris DE440 layout", 84);
+    put_text(record, 84, "SYNTHETIC TEST DATA - cubic polynomials, not an ephemeris", 84);
+    put_text(record, 168, "Written by tools/de_sample_generator", 84);
+
+    for (std::size_t i = 0; i < 400; ++i)
+    {
+        put_text(record, 252 + i * 6, i < kConstantNames.size() ? kConstantNames[i] : "", 6);
+    }
+
+    put<f64>(record, 2652, kStartJd);
+    put<f64>(record, 2660, kStartJd + kRecordCount * kRecordDays);
+    put<f64>(record, 2668, kRecordDays);
+    put<i32>(record, 2676, static_cast<i32>(kConstantNames.size()));
+    put<f64>(record, 2680, kAuKm);
+    put<f64>(record, 2688, kEarthMoonRatio);
+    for (std::size_t i = 0; i < kSeries.size(); ++i)
+    {
+        put_pointer(record, 2696 + i * 12, kSeries[i]);
+    }
+    put_pointer(record, 2696 + 11 * 12, kNutations);
+    put<i32>(record, 2840, kDeNumber);
+    put_pointer(record, 2844, kLibrations);
+    return record;
+}
+
+std::vector<std::byte> make_constants()
+{
+    std::vector<std::byte> record(kRecordDoubles * sizeof(f64));
+    put<f64>(record, 0, kAuKm);
+    put<f64>(record, 8, kEarthMoonRatio);
+    put<f64>(record, 16, static_cast<f64>(kDeNumber));
+    return record;
+}
+
+std::vector<std::byte> make_record(u32 index)
+{
+    std::vector<f64> values(kRecordDoubles, 0.0);
+    const f64 start = kStartJd + index * kRecordDays;
+    values[0] = start;
+    values[1] = start + kRecordDays;
+
+    for (u32 s = 0; s < kSeries.size(); ++s)
+    {
+        const auto count = static_cast<u32>(kSeries[s].count);
+        const auto subintervals = static_cast<u32>(kSeries[s].subintervals);
+        const f64 sub_days = kRecordDays / subintervals;
+
+        for (u32 sub = 0; sub < subintervals; ++sub)
+        {
+            for (u32 axis = 0; axis < 3; ++axis)
+            {
+                std::array<f64, astro::kMaxChebyshevCoefficients> samples{};
+                for (u32 k = 0; k < count; ++k)
+                {
+                    const f64 x = astro::chebyshev_node(k, count);
+                    samples[k] = sample_value(s, axis, start + (sub + 0.5 * (x + 1.0)) * sub_days);
+                }
+
+                const std::size_t first = (kSeries[s].offset - 1) + (sub * 3 + axis) * count;
+                astro::fit_chebyshev(std::span<const f64>(samples.data(), count),
+                                     std::span<f64>(values.data() + first, count));
+            }
+        }
+    }
+
+    std::vector<std::byte> record(kRecordDoubles * sizeof(f64));
+    std::memcpy(record.data(), values.data(), record.size());
+    return record;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    core::Logger::init();
+
+    if (argc != 2)
+    {
+        PLX_CORE_INFO("Usage: de_sample_generator <output.bin>");
+        core::Logger::shutdown();
+        return 1;
+    }
+
+    // JPL distributes little-endian files; the reader accepts nothing else
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        PLX_CORE_ERROR("de_sample_generator must run on a little-endian host");
+        core::Logger::shutdown();
+        return 1;
+    }
+
+    std::ofstream out(argv[1], std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        PLX_CORE_ERROR("Failed to create {}", argv[1]);
+        core::Logger::shutdown();
+        return 1;
+    }
+
+    const auto write = [&out](const std::vector<std::byte>& record) {
+        out.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+    };
+    write(make_header());
+    write(make_constants());
+    for (u32 i = 0; i < kRecordCount; ++i)
+    {
+        write(make_record(i));
+    }
+    out.close();
+
+    const bool ok = static_cast<bool>(out);
+    if (ok)
+    {
+        PLX_CORE_INFO("Wrote {} ({} records of {} coefficients)", argv[1], kRecordCount, kRecordDoubles);
+    }
+    else
+    {
+        PLX_CORE_ERROR("Failed to write {}", argv[1]);
+    }
+
+    core::Logger::shutdown();
+    return ok ? 0 : 1;
+}